@@ -4,6 +4,7 @@
 
 #include "program_options.hpp"
 
+#include "../../library/src/include/tuning_db.hpp"
 #include "rocblas.h"
 #include "rocblas.hpp"
 #include "rocblas_data.hpp"
@@ -15,14 +16,19 @@
 #include <cctype>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 // aux
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_async_panels.hpp"
 #include "testing_set_get_vector.hpp"
 #include "testing_set_get_vector_async.hpp"
 // blas1
@@ -289,6 +295,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"set_get_vector_async", testing_set_get_vector_async<T>},
                 {"set_get_matrix", testing_set_get_matrix<T>},
                 {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+                {"set_get_matrix_async_panels", testing_set_get_matrix_async_panels<T>},
                 // L1
                 {"asum", testing_asum<T>},
                 {"asum_batched", testing_asum_batched<T>},
@@ -459,6 +466,7 @@ struct perf_blas<T,
                 {"set_get_vector_async", testing_set_get_vector_async<T>},
                 {"set_get_matrix", testing_set_get_matrix<T>},
                 {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+                {"set_get_matrix_async_panels", testing_set_get_matrix_async_panels<T>},
                 // L1
                 {"asum", testing_asum<T>},
                 {"asum_batched", testing_asum_batched<T>},
@@ -1131,11 +1139,9 @@ void fix_batch(int argc, char* argv[])
         }
 }
 
-int main(int argc, char* argv[])
-try
+// Values of rocblas-bench options which are not stored directly in Arguments
+struct bench_options
 {
-    fix_batch(argc, argv);
-    Arguments   arg;
     std::string function;
     std::string precision;
     std::string a_type;
@@ -1145,13 +1151,17 @@ try
     std::string compute_type;
     std::string initialization;
     std::string filter;
+    std::string replay;
+    std::string tune;
     rocblas_int device_id;
     int         flags               = 0;
-    bool        datafile            = rocblas_parse_data(argc, argv);
     bool        atomics_not_allowed = false;
     bool        log_function_name   = false;
+};
 
-    options_description desc("rocblas-bench command line options");
+// Add the rocblas-bench command line options to desc, storing their values in arg and opt
+void add_bench_options(options_description& desc, Arguments& arg, bench_options& opt)
+{
     desc.add_options()
         // clang-format off
         ("sizem,m",
@@ -1250,35 +1260,35 @@ try
          value<double>(&arg.betai)->default_value(0.0), "specifies the imaginary part of the scalar beta")
 
         ("function,f",
-         value<std::string>(&function),
+         value<std::string>(&opt.function),
          "BLAS function to test.")
 
         ("precision,r",
-         value<std::string>(&precision)->default_value("f32_r"), "Precision. "
+         value<std::string>(&opt.precision)->default_value("f32_r"), "Precision. "
          "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
 
         ("a_type",
-         value<std::string>(&a_type), "Precision of matrix A. "
+         value<std::string>(&opt.a_type), "Precision of matrix A. "
          "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
 
         ("b_type",
-         value<std::string>(&b_type), "Precision of matrix B. "
+         value<std::string>(&opt.b_type), "Precision of matrix B. "
          "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
 
         ("c_type",
-         value<std::string>(&c_type), "Precision of matrix C. "
+         value<std::string>(&opt.c_type), "Precision of matrix C. "
          "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
 
         ("d_type",
-         value<std::string>(&d_type), "Precision of matrix D. "
+         value<std::string>(&opt.d_type), "Precision of matrix D. "
          "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
 
         ("compute_type",
-         value<std::string>(&compute_type), "Precision of computation. "
+         value<std::string>(&opt.compute_type), "Precision of computation. "
          "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
 
         ("initialization",
-         value<std::string>(&initialization)->default_value("rand_int"),
+         value<std::string>(&opt.initialization)->default_value("rand_int"),
          "Intialize with random integers, trig functions sin and cos, or hpl-like input. "
          "Options: rand_int, trig_float, hpl")
 
@@ -1331,15 +1341,15 @@ try
          "extended precision gemm solution index")
 
         ("flags",
-         value<int>(&flags)->default_value(rocblas_gemm_flags_none),
+         value<int>(&opt.flags)->default_value(rocblas_gemm_flags_none),
          "gemm_ex flags, 1: Use packed-i8, 0: (default) uses unpacked-i8, available on matrix-inst-supported device")
 
         ("atomics_not_allowed",
-         bool_switch(&atomics_not_allowed)->default_value(false),
+         bool_switch(&opt.atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
 
         ("device",
-         value<rocblas_int>(&device_id)->default_value(0),
+         value<rocblas_int>(&opt.device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
 
         ("c_noalias_d",
@@ -1355,19 +1365,403 @@ try
          "Set fixed workspace memory size instead of using rocblas managed memory")
 
         ("log_function_name",
-         bool_switch(&log_function_name)->default_value(false),
+         bool_switch(&opt.log_function_name)->default_value(false),
          "Function name precedes other itmes.")
 
         ("function_filter",
-         value<std::string>(&filter),
+         value<std::string>(&opt.filter),
          "Simple strstr filter on function name only without wildcards")
 
+        ("replay",
+         value<std::string>(&opt.replay),
+         "Run each rocblas-bench command line in a file, such as a ROCBLAS_LAYER=2 bench log, "
+         "in one process. Problems are grouped by function and precision, and device memory "
+         "is reused within each group.")
+
+        ("tune",
+         value<std::string>(&opt.tune),
+         "Time each Tensile solution which can compute the gemm problem, or each gemm problem "
+         "of the --replay file, and append the fastest solutions to this tuning database file. "
+         "rocBLAS uses them when the ROCBLAS_TENSILE_TUNING_DB environment variable names it.")
+
         ("help,h", "produces this help message")
 
         ("version", "Prints the version number");
     // clang-format on
+}
+
+// Validate the options of a single problem, and transfer them to arg
+void set_bench_arguments(Arguments& arg, const bench_options& opt)
+{
+    std::string precision = opt.precision;
+    std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
+    auto prec = string2rocblas_datatype(precision);
+    if(prec == static_cast<rocblas_datatype>(-1))
+        throw std::invalid_argument("Invalid value for --precision " + precision);
+
+    arg.a_type = opt.a_type == "" ? prec : string2rocblas_datatype(opt.a_type);
+    if(arg.a_type == static_cast<rocblas_datatype>(-1))
+        throw std::invalid_argument("Invalid value for --a_type " + opt.a_type);
+
+    arg.b_type = opt.b_type == "" ? prec : string2rocblas_datatype(opt.b_type);
+    if(arg.b_type == static_cast<rocblas_datatype>(-1))
+        throw std::invalid_argument("Invalid value for --b_type " + opt.b_type);
+
+    arg.c_type = opt.c_type == "" ? prec : string2rocblas_datatype(opt.c_type);
+    if(arg.c_type == static_cast<rocblas_datatype>(-1))
+        throw std::invalid_argument("Invalid value for --c_type " + opt.c_type);
+
+    arg.d_type = opt.d_type == "" ? prec : string2rocblas_datatype(opt.d_type);
+    if(arg.d_type == static_cast<rocblas_datatype>(-1))
+        throw std::invalid_argument("Invalid value for --d_type " + opt.d_type);
+
+    arg.compute_type = opt.compute_type == "" ? prec : string2rocblas_datatype(opt.compute_type);
+    if(arg.compute_type == static_cast<rocblas_datatype>(-1))
+        throw std::invalid_argument("Invalid value for --compute_type " + opt.compute_type);
+
+    arg.initialization = string2rocblas_initialization(opt.initialization);
+    if(arg.initialization == static_cast<rocblas_initialization>(-1))
+        throw std::invalid_argument("Invalid value for --initialization " + opt.initialization);
+
+    if(arg.M < 0)
+        throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
+    if(arg.N < 0)
+        throw std::invalid_argument("Invalid value for -n " + std::to_string(arg.N));
+    if(arg.K < 0)
+        throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
+
+    int copied = snprintf(arg.function, sizeof(arg.function), "%s", opt.function.c_str());
+    if(copied <= 0 || copied >= sizeof(arg.function))
+        throw std::invalid_argument("Invalid value for --function");
 
-    // parse command line into arg structure and stack variables using desc
+    arg.atomics_mode
+        = opt.atomics_not_allowed ? rocblas_atomics_not_allowed : rocblas_atomics_allowed;
+    arg.flags = rocblas_gemm_flags(opt.flags);
+}
+
+// Read the rocblas-bench command lines of a replay file into problems, returning -1 if any
+// line cannot be parsed
+int rocblas_bench_read_replay(const std::string& replay_file, std::vector<Arguments>& problems)
+{
+    std::ifstream ifs(replay_file);
+    if(!ifs)
+        throw std::invalid_argument("Cannot open replay file " + replay_file);
+
+    static constexpr char   bench[]   = "rocblas-bench";
+    static constexpr size_t bench_len = sizeof(bench) - 1;
+
+    std::string line;
+    size_t      line_num = 0;
+    int         ret      = 0;
+
+    while(std::getline(ifs, line))
+    {
+        ++line_num;
+
+        // Arguments follow the rocblas-bench executable, which may have a path or a prefix
+        std::istringstream       iss(line);
+        std::vector<std::string> tokens;
+        for(std::string token; iss >> token;)
+            if(!tokens.empty()
+               || (token.size() >= bench_len
+                   && !token.compare(token.size() - bench_len, bench_len, bench)))
+                tokens.push_back(std::move(token));
+
+        if(tokens.empty())
+            continue;
+
+        std::vector<char*> argv;
+        for(auto& token : tokens)
+            argv.push_back(&token[0]);
+        argv.push_back(nullptr);
+
+        try
+        {
+            // Defaults are set when options are added, so each line needs its own options
+            Arguments           arg{};
+            bench_options       opt;
+            options_description desc("rocblas-bench command line options");
+            add_bench_options(desc, arg, opt);
+            fix_batch(int(tokens.size()), argv.data());
+
+            variables_map vm;
+            store(parse_command_line(int(tokens.size()), argv.data(), desc), vm);
+            notify(vm);
+
+            set_bench_arguments(arg, opt);
+            problems.push_back(arg);
+        }
+        catch(const std::invalid_argument& exp)
+        {
+            rocblas_cerr << replay_file << ":" << line_num << ": " << exp.what() << std::endl;
+            ret = -1;
+        }
+    }
+    return ret;
+}
+
+// Run each rocblas-bench command line in a file, such as a bench log written with
+// ROCBLAS_LAYER=2, in this process, so that HIP and Tensile are initialized only once.
+// Problems are grouped by function and data types, keeping their order within each group,
+// and device memory is reused across the problems of a group.
+int rocblas_bench_replay(const std::string& replay_file, const std::string& filter)
+{
+    std::vector<Arguments> problems;
+    int                    ret = rocblas_bench_read_replay(replay_file, problems);
+
+    auto group_less = [](const Arguments& a, const Arguments& b) {
+        int cmp = strcmp(a.function, b.function);
+        if(cmp)
+            return cmp < 0;
+        return std::tie(a.a_type, a.b_type, a.c_type, a.d_type, a.compute_type)
+               < std::tie(b.a_type, b.b_type, b.c_type, b.d_type, b.compute_type);
+    };
+    std::stable_sort(problems.begin(), problems.end(), group_less);
+
+    // Each row of output names its function, and a CSV header is printed only when it changes
+    ArgumentModel_set_log_function_name(true);
+    ArgumentModel_set_log_repeated_header(false);
+    d_vector_cache::enable(true);
+
+    for(size_t i = 0; i < problems.size(); ++i)
+    {
+        // Release the device memory of the previous group
+        if(i && group_less(problems[i - 1], problems[i]))
+            d_vector_cache::clear();
+
+        try
+        {
+            ret |= run_bench_test(problems[i], filter);
+        }
+        catch(const std::invalid_argument& exp)
+        {
+            rocblas_cerr << exp.what() << std::endl;
+            ret = -1;
+        }
+    }
+
+    d_vector_cache::enable(false);
+    test_cleanup::cleanup();
+    return ret;
+}
+
+#if BUILD_WITH_TENSILE
+
+// Whether rocblas-bench --tune can tune the solutions of a function
+bool rocblas_bench_tunable(const char* function)
+{
+    for(auto name : {"gemm",
+                     "gemm_batched",
+                     "gemm_strided_batched",
+                     "gemm_ex",
+                     "gemm_batched_ex",
+                     "gemm_strided_batched_ex"})
+        if(!strcmp(function, name))
+            return true;
+    return false;
+}
+
+// Store the alpha and beta of arg as scalars of type
+void rocblas_bench_scalars(const Arguments& arg,
+                           rocblas_datatype type,
+                           rocblas_union_t& alpha,
+                           rocblas_union_t& beta)
+{
+    switch(type)
+    {
+    case rocblas_datatype_f16_r:
+        alpha.h = arg.get_alpha<rocblas_half>();
+        beta.h  = arg.get_beta<rocblas_half>();
+        break;
+    case rocblas_datatype_f32_r:
+        alpha.s = arg.get_alpha<float>();
+        beta.s  = arg.get_beta<float>();
+        break;
+    case rocblas_datatype_f64_r:
+        alpha.d = arg.get_alpha<double>();
+        beta.d  = arg.get_beta<double>();
+        break;
+    case rocblas_datatype_i32_r:
+        alpha.i = arg.get_alpha<int32_t>();
+        beta.i  = arg.get_beta<int32_t>();
+        break;
+    case rocblas_datatype_f32_c:
+        alpha.c = arg.get_alpha<rocblas_float_complex>();
+        beta.c  = arg.get_beta<rocblas_float_complex>();
+        break;
+    case rocblas_datatype_f64_c:
+        alpha.z = arg.get_alpha<rocblas_double_complex>();
+        beta.z  = arg.get_beta<rocblas_double_complex>();
+        break;
+    default:
+        break;
+    }
+}
+
+// Return the tuning database key of the gemm problem of arg
+rocblas_tuning_db_key rocblas_bench_tuning_key(const Arguments& arg)
+{
+    bool ex      = strstr(arg.function, "_ex") != nullptr;
+    bool batched = strstr(arg.function, "batched") != nullptr;
+    return {rocblas_datatype2string(arg.a_type),
+            rocblas_datatype2string(arg.c_type),
+            rocblas_datatype2string(arg.compute_type),
+            arg.transA,
+            arg.transB,
+            arg.M,
+            arg.N,
+            arg.K,
+            batched ? arg.batch_count : 1,
+            arg.lda,
+            arg.ldb,
+            arg.ldc,
+            ex ? arg.ldd : arg.ldc};
+}
+
+// Return the indices of the Tensile solutions which can compute the gemm problem of arg
+std::vector<int32_t> rocblas_bench_solution_candidates(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+    auto                 key      = rocblas_bench_tuning_key(arg);
+    bool                 strided  = strstr(arg.function, "strided") != nullptr;
+    rocblas_int          a_cols   = arg.transA == 'N' ? arg.K : arg.M;
+    rocblas_int          b_cols   = arg.transB == 'N' ? arg.N : arg.K;
+    rocblas_stride       stride_a = strided ? arg.stride_a : rocblas_stride(arg.lda) * a_cols;
+    rocblas_stride       stride_b = strided ? arg.stride_b : rocblas_stride(arg.ldb) * b_cols;
+    rocblas_stride       stride_c = strided ? arg.stride_c : rocblas_stride(arg.ldc) * arg.N;
+    rocblas_stride       stride_d = strided && arg.stride_d ? arg.stride_d : stride_c;
+    rocblas_union_t      alpha{}, beta{};
+    rocblas_bench_scalars(arg, arg.compute_type, alpha, beta);
+
+    // The query stores the candidates instead of computing the problem, so no matrices are needed
+    auto query = [&] {
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex(handle,
+                                                            char2rocblas_operation(arg.transA),
+                                                            char2rocblas_operation(arg.transB),
+                                                            arg.M,
+                                                            arg.N,
+                                                            arg.K,
+                                                            &alpha,
+                                                            nullptr,
+                                                            arg.a_type,
+                                                            arg.lda,
+                                                            stride_a,
+                                                            nullptr,
+                                                            arg.b_type,
+                                                            arg.ldb,
+                                                            stride_b,
+                                                            &beta,
+                                                            nullptr,
+                                                            arg.c_type,
+                                                            arg.ldc,
+                                                            stride_c,
+                                                            nullptr,
+                                                            arg.d_type,
+                                                            rocblas_int(key.ldd),
+                                                            stride_d,
+                                                            rocblas_int(key.batch_count),
+                                                            arg.compute_type,
+                                                            rocblas_gemm_algo_standard,
+                                                            0,
+                                                            arg.flags));
+    };
+
+    rocblas_int count = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_candidates_query(handle, nullptr, 0, &count));
+    query();
+
+    std::vector<int32_t> indices(count);
+    CHECK_ROCBLAS_ERROR(
+        rocblas_set_solution_candidates_query(handle, indices.data(), count, &count));
+    query();
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_candidates_query(handle, nullptr, 0, nullptr));
+
+    indices.resize(std::min(size_t(count), indices.size()));
+    return indices;
+}
+
+// Time Tensile's selection and each candidate solution of each gemm problem, and append the
+// fastest solutions to the tuning database file
+int rocblas_bench_tune(std::vector<Arguments>& problems,
+                       const std::string&      db_file,
+                       const std::string&      filter)
+{
+    std::ofstream db(db_file, std::ios::app);
+    if(!db)
+        throw std::invalid_argument("Cannot open tuning database " + db_file);
+
+    const std::string arch = rocblas_internal_get_arch_name();
+    int               ret  = 0;
+
+    // Run a problem, returning its time per call, or NA_value if it was not run
+    auto time_problem = [&](Arguments& arg) {
+        ArgumentModel_set_last_gpu_us(ArgumentLogging::NA_value);
+        ret |= run_bench_test(arg, filter);
+        return ArgumentModel_get_last_gpu_us();
+    };
+
+    for(auto& arg : problems)
+    {
+        if(!rocblas_bench_tunable(arg.function))
+        {
+            rocblas_cerr << "rocblas-bench: --tune skips " << arg.function
+                         << ", which is not a gemm" << std::endl;
+            continue;
+        }
+
+        // Tensile's selection is timed first; run_bench_test also fixes the leading dimensions
+        arg.algo          = rocblas_gemm_algo_standard;
+        double default_us = time_problem(arg);
+        if(default_us == ArgumentLogging::NA_value)
+            continue;
+
+        int32_t best_index = -1;
+        double  best_us    = default_us;
+        for(int32_t index : rocblas_bench_solution_candidates(arg))
+        {
+            Arguments candidate      = arg;
+            candidate.algo           = rocblas_gemm_algo_solution_index;
+            candidate.solution_index = index;
+            double us                = time_problem(candidate);
+            if(us != ArgumentLogging::NA_value && (best_index < 0 || us < best_us))
+            {
+                best_index = index;
+                best_us    = us;
+            }
+        }
+
+        auto key = rocblas_bench_tuning_key(arg);
+        if(best_index < 0)
+        {
+            rocblas_cerr << "rocblas-bench: --tune found no solutions for " << arg.function
+                         << std::endl;
+            ret = -1;
+            continue;
+        }
+
+        rocblas_tuning_db::write(db, arch, key, best_index);
+        db.flush();
+        rocblas_cout << "rocblas-bench: tuned " << arg.function << ": solution " << best_index
+                     << ", " << best_us << " us, speedup " << default_us / best_us
+                     << " over Tensile's selection" << std::endl;
+    }
+    return ret;
+}
+
+#endif
+
+int main(int argc, char* argv[])
+try
+{
+    fix_batch(argc, argv);
+    Arguments     arg;
+    bench_options opt;
+    bool          datafile = rocblas_parse_data(argc, argv);
+
+    options_description desc("rocblas-bench command line options");
+    add_bench_options(desc, arg, opt);
+
+    // parse command line into arg structure and opt using desc
     variables_map vm;
     store(parse_command_line(argc, argv, desc), vm);
     notify(vm);
@@ -1386,68 +1780,44 @@ try
         return 0;
     }
 
-    // transfer local variable state
-
-    arg.atomics_mode = atomics_not_allowed ? rocblas_atomics_not_allowed : rocblas_atomics_allowed;
-    arg.flags        = rocblas_gemm_flags(flags);
-    ArgumentModel_set_log_function_name(log_function_name);
+    ArgumentModel_set_log_function_name(opt.log_function_name);
 
     // Device Query
     rocblas_int device_count = query_device_property();
 
     rocblas_cout << std::endl;
-    if(device_count <= device_id)
+    if(device_count <= opt.device_id)
         throw std::invalid_argument("Invalid Device ID");
-    set_device(device_id);
+    set_device(opt.device_id);
 
     if(datafile)
-        return rocblas_bench_datafile(filter);
-
-    // single bench run
-
-    // validate arguments
-
-    std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
-    auto prec = string2rocblas_datatype(precision);
-    if(prec == static_cast<rocblas_datatype>(-1))
-        throw std::invalid_argument("Invalid value for --precision " + precision);
-
-    arg.a_type = a_type == "" ? prec : string2rocblas_datatype(a_type);
-    if(arg.a_type == static_cast<rocblas_datatype>(-1))
-        throw std::invalid_argument("Invalid value for --a_type " + a_type);
-
-    arg.b_type = b_type == "" ? prec : string2rocblas_datatype(b_type);
-    if(arg.b_type == static_cast<rocblas_datatype>(-1))
-        throw std::invalid_argument("Invalid value for --b_type " + b_type);
-
-    arg.c_type = c_type == "" ? prec : string2rocblas_datatype(c_type);
-    if(arg.c_type == static_cast<rocblas_datatype>(-1))
-        throw std::invalid_argument("Invalid value for --c_type " + c_type);
-
-    arg.d_type = d_type == "" ? prec : string2rocblas_datatype(d_type);
-    if(arg.d_type == static_cast<rocblas_datatype>(-1))
-        throw std::invalid_argument("Invalid value for --d_type " + d_type);
-
-    arg.compute_type = compute_type == "" ? prec : string2rocblas_datatype(compute_type);
-    if(arg.compute_type == static_cast<rocblas_datatype>(-1))
-        throw std::invalid_argument("Invalid value for --compute_type " + compute_type);
+        return rocblas_bench_datafile(opt.filter);
 
-    arg.initialization = string2rocblas_initialization(initialization);
-    if(arg.initialization == static_cast<rocblas_initialization>(-1))
-        throw std::invalid_argument("Invalid value for --initialization " + initialization);
+    if(!opt.tune.empty())
+    {
+#if BUILD_WITH_TENSILE
+        std::vector<Arguments> problems;
+        int                    ret = 0;
+        if(!opt.replay.empty())
+            ret = rocblas_bench_read_replay(opt.replay, problems);
+        else
+        {
+            set_bench_arguments(arg, opt);
+            problems.push_back(arg);
+        }
+        return ret | rocblas_bench_tune(problems, opt.tune, opt.filter);
+#else
+        throw std::invalid_argument("--tune requires rocBLAS to be built with Tensile");
+#endif
+    }
 
-    if(arg.M < 0)
-        throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
-    if(arg.N < 0)
-        throw std::invalid_argument("Invalid value for -n " + std::to_string(arg.N));
-    if(arg.K < 0)
-        throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
+    if(!opt.replay.empty())
+        return rocblas_bench_replay(opt.replay, opt.filter);
 
-    int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
-    if(copied <= 0 || copied >= sizeof(arg.function))
-        throw std::invalid_argument("Invalid value for --function");
+    // single bench run
+    set_bench_arguments(arg, opt);
 
-    return run_bench_test(arg, filter);
+    return run_bench_test(arg, opt.filter);
 }
 catch(const std::invalid_argument& exp)
 {
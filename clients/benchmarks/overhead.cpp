@@ -0,0 +1,508 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocblas-overhead measures the host time spent in the rocBLAS call path,
+ *  which is what limits launch-bound workloads of small problems.
+ *
+ *  Each function is called repeatedly in a number of scenarios, and the host time
+ *  per call is reported. The stages of the call path are isolated by the differences
+ *  between scenarios:
+ *
+ *  invalid_size   argument validation only (a negative size is rejected)
+ *  quick_return   argument validation and the quick return for a size of 0
+ *  size_query     the workspace size query, which stops before any launch
+ *  call           the full call with host scalars and no logging
+ *  device_scalars the full call with device scalars, which are copied to the host
+ *                 by functions calling copy_alpha_beta_to_host_if_on_device
+ *  new_shapes     the full call cycling through more shapes than the Tensile
+ *                 solution cache holds, so that each call looks up a solution
+ *  log_trace      the full call with ROCBLAS_LAYER=1
+ *  log_bench      the full call with ROCBLAS_LAYER=2
+ *  log_profile    the full call with ROCBLAS_LAYER=4
+ *
+ *  The logs are written to /dev/null. Workspace allocation with device_malloc is
+ *  part of the call of the functions which use workspace (dot, trsm, and gemm_ex
+ *  with f16 inputs), and its cost is also the difference between call and
+ *  size_query. Running under the null device library (see BUILD_CLIENTS_NULL_DEVICE)
+ *  leaves only the host cost, without queuing delays of a real device.
+ */
+
+#include "program_options.hpp"
+
+#include "rocblas.h"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace roc; // For emulated program_options
+
+namespace
+{
+    // Number of distinct shapes of the new_shapes scenario, more than the default
+    // ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE
+    constexpr rocblas_int overhead_shapes = 4096;
+
+    // Problem passed to each function. n is the size of the call, which is
+    // negative or zero in the invalid_size and quick_return scenarios, and m is
+    // the number of rows of the gemm problems, which varies in new_shapes.
+    struct overhead_problem
+    {
+        rocblas_int   m;
+        rocblas_int   n;
+        const float*  alpha;
+        const float*  beta;
+        float*        A;
+        float*        B;
+        float*        C;
+        rocblas_half* hA;
+        rocblas_half* hB;
+        rocblas_half* hC;
+        float*        result;
+    };
+
+    struct overhead_function
+    {
+        const char* name;
+        bool        tensile; // Whether the new_shapes scenario applies
+        std::function<rocblas_status(rocblas_handle, const overhead_problem&)> call;
+    };
+
+    const std::vector<overhead_function>& overhead_functions()
+    {
+        static const std::vector<overhead_function> functions = {
+            {"rocblas_saxpy",
+             false,
+             [](rocblas_handle handle, const overhead_problem& p) {
+                 return rocblas_saxpy(handle, p.n, p.alpha, p.A, 1, p.B, 1);
+             }},
+            {"rocblas_sdot",
+             false,
+             [](rocblas_handle handle, const overhead_problem& p) {
+                 return rocblas_sdot(handle, p.n, p.A, 1, p.B, 1, p.result);
+             }},
+            {"rocblas_sgemv",
+             false,
+             [](rocblas_handle handle, const overhead_problem& p) {
+                 return rocblas_sgemv(handle,
+                                      rocblas_operation_none,
+                                      p.n,
+                                      p.n,
+                                      p.alpha,
+                                      p.A,
+                                      std::max(p.n, 1),
+                                      p.B,
+                                      1,
+                                      p.beta,
+                                      p.C,
+                                      1);
+             }},
+            {"rocblas_sgemm",
+             true,
+             [](rocblas_handle handle, const overhead_problem& p) {
+                 rocblas_int ldm = std::max(p.m, 1), ldn = std::max(p.n, 1);
+                 return rocblas_sgemm(handle,
+                                      rocblas_operation_none,
+                                      rocblas_operation_none,
+                                      p.m,
+                                      p.n,
+                                      p.n,
+                                      p.alpha,
+                                      p.A,
+                                      ldm,
+                                      p.B,
+                                      ldn,
+                                      p.beta,
+                                      p.C,
+                                      ldm);
+             }},
+            {"rocblas_gemm_ex_f32",
+             true,
+             [](rocblas_handle handle, const overhead_problem& p) {
+                 rocblas_int ldm = std::max(p.m, 1), ldn = std::max(p.n, 1);
+                 return rocblas_gemm_ex(handle,
+                                        rocblas_operation_none,
+                                        rocblas_operation_none,
+                                        p.m,
+                                        p.n,
+                                        p.n,
+                                        p.alpha,
+                                        p.A,
+                                        rocblas_datatype_f32_r,
+                                        ldm,
+                                        p.B,
+                                        rocblas_datatype_f32_r,
+                                        ldn,
+                                        p.beta,
+                                        p.C,
+                                        rocblas_datatype_f32_r,
+                                        ldm,
+                                        p.C,
+                                        rocblas_datatype_f32_r,
+                                        ldm,
+                                        rocblas_datatype_f32_r,
+                                        rocblas_gemm_algo_standard,
+                                        0,
+                                        0);
+             }},
+            {"rocblas_gemm_ex_f16_f32",
+             true,
+             [](rocblas_handle handle, const overhead_problem& p) {
+                 rocblas_int ldm = std::max(p.m, 1), ldn = std::max(p.n, 1);
+                 return rocblas_gemm_ex(handle,
+                                        rocblas_operation_none,
+                                        rocblas_operation_none,
+                                        p.m,
+                                        p.n,
+                                        p.n,
+                                        p.alpha,
+                                        p.hA,
+                                        rocblas_datatype_f16_r,
+                                        ldm,
+                                        p.hB,
+                                        rocblas_datatype_f16_r,
+                                        ldn,
+                                        p.beta,
+                                        p.hC,
+                                        rocblas_datatype_f16_r,
+                                        ldm,
+                                        p.hC,
+                                        rocblas_datatype_f16_r,
+                                        ldm,
+                                        rocblas_datatype_f32_r,
+                                        rocblas_gemm_algo_standard,
+                                        0,
+                                        0);
+             }},
+            {"rocblas_strsm",
+             false,
+             [](rocblas_handle handle, const overhead_problem& p) {
+                 rocblas_int ld = std::max(p.n, 1);
+                 return rocblas_strsm(handle,
+                                      rocblas_side_left,
+                                      rocblas_fill_lower,
+                                      rocblas_operation_none,
+                                      rocblas_diagonal_unit,
+                                      p.n,
+                                      p.n,
+                                      p.alpha,
+                                      p.A,
+                                      ld,
+                                      p.B,
+                                      ld);
+             }},
+        };
+        return functions;
+    }
+
+    struct overhead_result
+    {
+        std::string function;
+        std::string scenario;
+        size_t      calls;
+        double      ns_per_call; // median of the repeats
+        double      min_ns_per_call;
+    };
+
+    struct overhead_options
+    {
+        rocblas_int size;
+        rocblas_int iterations;
+        rocblas_int repeats;
+        std::string json;
+        std::string filter;
+    };
+
+    // Time repeats batches of iterations calls, synchronizing between batches
+    // outside of the timed region
+    template <typename F>
+    overhead_result overhead_time(const char*             function,
+                                  const char*             scenario,
+                                  rocblas_handle          handle,
+                                  const overhead_options& opt,
+                                  F&&                     call)
+    {
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        // One untimed batch, for lazy initialization in rocBLAS and HIP
+        for(rocblas_int i = 0; i < opt.iterations; ++i)
+            call(i);
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        std::vector<double> ns(opt.repeats);
+        for(auto& t : ns)
+        {
+            double start = get_time_us_no_sync();
+            for(rocblas_int i = 0; i < opt.iterations; ++i)
+                call(i);
+            t = (get_time_us_no_sync() - start) * 1000 / opt.iterations;
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+        std::sort(ns.begin(), ns.end());
+
+        return {function,
+                scenario,
+                size_t(opt.iterations) * opt.repeats,
+                ns[ns.size() / 2],
+                ns.front()};
+    }
+
+    // The log streams of a handle are opened when the handle is created, from the
+    // environment at that time
+    void overhead_set_layer(const char* layer)
+    {
+        if(layer)
+        {
+            setenv("ROCBLAS_LAYER", layer, 1);
+            setenv("ROCBLAS_LOG_TRACE_PATH", "/dev/null", 1);
+            setenv("ROCBLAS_LOG_BENCH_PATH", "/dev/null", 1);
+            setenv("ROCBLAS_LOG_PROFILE_PATH", "/dev/null", 1);
+        }
+        else
+            unsetenv("ROCBLAS_LAYER");
+    }
+
+    std::vector<overhead_result> overhead_run(const overhead_options& opt)
+    {
+        // Device memory for the largest shape of the new_shapes scenario
+        size_t elems = (size_t(opt.size) + overhead_shapes) * opt.size;
+
+        device_vector<float>        dA(elems), dB(elems), dC(elems), dScalars(3);
+        device_vector<rocblas_half> dhA(elems), dhB(elems), dhC(elems);
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dScalars.memcheck());
+        CHECK_DEVICE_ALLOCATION(dhA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dhB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dhC.memcheck());
+
+        // Zeros keep every result finite; the values do not affect the host path
+        CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(float) * elems));
+        CHECK_HIP_ERROR(hipMemset(dB, 0, sizeof(float) * elems));
+        CHECK_HIP_ERROR(hipMemset(dC, 0, sizeof(float) * elems));
+        CHECK_HIP_ERROR(hipMemset(dhA, 0, sizeof(rocblas_half) * elems));
+        CHECK_HIP_ERROR(hipMemset(dhB, 0, sizeof(rocblas_half) * elems));
+        CHECK_HIP_ERROR(hipMemset(dhC, 0, sizeof(rocblas_half) * elems));
+        CHECK_HIP_ERROR(hipMemset(dScalars, 0, sizeof(float) * 3));
+
+        const float h_alpha = 1, h_beta = 0;
+        float       h_result;
+
+        overhead_problem host_problem{opt.size,
+                                      opt.size,
+                                      &h_alpha,
+                                      &h_beta,
+                                      dA,
+                                      dB,
+                                      dC,
+                                      dhA,
+                                      dhB,
+                                      dhC,
+                                      &h_result};
+        overhead_problem device_problem = host_problem;
+        device_problem.alpha            = dScalars;
+        device_problem.beta             = dScalars + 1;
+        device_problem.result           = dScalars + 2;
+
+        struct layer_scenario
+        {
+            const char* scenario;
+            const char* layer;
+        };
+        static const layer_scenario layers[] = {{"log_trace", "1"},
+                                                {"log_bench", "2"},
+                                                {"log_profile", "4"}};
+
+        std::vector<overhead_result> results;
+        for(auto& f : overhead_functions())
+        {
+            if(opt.filter.size() && !strstr(f.name, opt.filter.c_str()))
+                continue;
+
+            auto timed = [&](const char* scenario, rocblas_handle handle, auto&& call) {
+                results.push_back(overhead_time(f.name, scenario, handle, opt, call));
+                const auto& r = results.back();
+                rocblas_cout << f.name << "," << r.scenario << "," << r.ns_per_call << ","
+                             << r.min_ns_per_call << std::endl;
+            };
+
+            auto call_with = [&](rocblas_handle handle, overhead_problem p) {
+                return [&f, handle, p](rocblas_int) { f.call(handle, p); };
+            };
+
+            overhead_set_layer(nullptr);
+            {
+                rocblas_local_handle handle;
+
+                overhead_problem p = host_problem;
+                p.m = p.n = -1;
+                timed("invalid_size", handle, call_with(handle, p));
+
+                p.m = p.n = 0;
+                timed("quick_return", handle, call_with(handle, p));
+
+                timed("size_query", handle, [&](rocblas_int) {
+                    size_t size;
+                    rocblas_start_device_memory_size_query(handle);
+                    f.call(handle, host_problem);
+                    rocblas_stop_device_memory_size_query(handle, &size);
+                });
+
+                timed("call", handle, call_with(handle, host_problem));
+
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                timed("device_scalars", handle, call_with(handle, device_problem));
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+                // The shapes continue across repeats, so that none is seen twice
+                rocblas_int shape = 0;
+                if(f.tensile)
+                    timed("new_shapes", handle, [&](rocblas_int) {
+                        overhead_problem p = host_problem;
+                        p.m += shape++ % overhead_shapes;
+                        f.call(handle, p);
+                    });
+            }
+
+            for(auto& l : layers)
+            {
+                overhead_set_layer(l.layer);
+                rocblas_local_handle handle;
+                timed(l.scenario, handle, call_with(handle, host_problem));
+            }
+            overhead_set_layer(nullptr);
+        }
+        return results;
+    }
+
+    // Counters of the null device library, when rocblas-overhead runs under it
+    std::string overhead_null_device_json()
+    {
+        using get_stats_t = void (*)(size_t*, size_t*, size_t*);
+        auto get_stats    = (get_stats_t)dlsym(RTLD_DEFAULT, "rocblas_null_device_get_stats");
+        if(!get_stats)
+            return "null";
+
+        size_t launches, copies, copy_bytes;
+        get_stats(&launches, &copies, &copy_bytes);
+        return "{\"kernel_launches\": " + std::to_string(launches) + ", \"copies\": "
+               + std::to_string(copies) + ", \"copy_bytes\": " + std::to_string(copy_bytes)
+               + "}";
+    }
+
+    void overhead_write_json(std::ostream&                       os,
+                             const overhead_options&             opt,
+                             const std::vector<overhead_result>& results)
+    {
+        char version[100];
+        CHECK_ROCBLAS_ERROR(rocblas_get_version_string(version, sizeof(version)));
+
+        int             device;
+        hipDeviceProp_t props;
+        CHECK_HIP_ERROR(hipGetDevice(&device));
+        CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device));
+
+        os << "{\n";
+        os << "  \"rocblas_version\": \"" << version << "\",\n";
+        os << "  \"device\": \"" << props.name << "\",\n";
+        os << "  \"gcn_arch\": \"" << props.gcnArchName << "\",\n";
+        os << "  \"size\": " << opt.size << ",\n";
+        os << "  \"iterations\": " << opt.iterations << ",\n";
+        os << "  \"repeats\": " << opt.repeats << ",\n";
+        os << "  \"null_device\": " << overhead_null_device_json() << ",\n";
+        os << "  \"results\": [";
+        const char* delim = "\n";
+        for(auto& r : results)
+        {
+            os << delim << "    {\"function\": \"" << r.function << "\", \"scenario\": \""
+               << r.scenario << "\", \"calls\": " << r.calls
+               << ", \"ns_per_call\": " << r.ns_per_call
+               << ", \"min_ns_per_call\": " << r.min_ns_per_call << "}";
+            delim = ",\n";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+} // namespace
+
+int main(int argc, char* argv[])
+try
+{
+    overhead_options opt;
+    rocblas_int      device_id;
+
+    options_description desc("rocblas-overhead command line options");
+
+    // clang-format off
+    desc.add_options()
+        ("size,n",
+         value<rocblas_int>(&opt.size)->default_value(32),
+         "Size of the problems. Small sizes are launch-bound.")
+
+        ("iterations,i",
+         value<rocblas_int>(&opt.iterations)->default_value(256),
+         "Calls timed together in each repeat")
+
+        ("repeats,r",
+         value<rocblas_int>(&opt.repeats)->default_value(5),
+         "Timed repeats of each scenario; the median and the minimum are reported")
+
+        ("json,o",
+         value<std::string>(&opt.json),
+         "File to which the results are written as JSON")
+
+        ("function_filter",
+         value<std::string>(&opt.filter),
+         "Simple strstr filter on function name only without wildcards")
+
+        ("device",
+         value<rocblas_int>(&device_id)->default_value(0),
+         "Device to be used")
+
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        rocblas_cout << desc << std::endl;
+        return 0;
+    }
+
+    if(opt.size <= 0 || opt.iterations <= 0 || opt.repeats <= 0)
+        throw std::invalid_argument("--size, --iterations and --repeats must be positive");
+
+    if(query_device_property() <= device_id)
+        throw std::invalid_argument("Invalid Device ID");
+    set_device(device_id);
+
+    rocblas_cout << "function,scenario,ns_per_call,min_ns_per_call" << std::endl;
+    auto results = overhead_run(opt);
+
+    if(opt.json.size())
+    {
+        std::ofstream os(opt.json);
+        if(!os)
+            throw std::invalid_argument("Cannot open " + opt.json);
+        overhead_write_json(os, opt, results);
+    }
+    return 0;
+}
+catch(const std::invalid_argument& exp)
+{
+    rocblas_cerr << exp.what() << std::endl;
+    return -1;
+}
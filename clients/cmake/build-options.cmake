@@ -27,3 +27,7 @@ endif( )
 if( NOT BUILD_CLIENTS_BENCHMARKS )
   option( BUILD_CLIENTS_BENCHMARKS "Build rocBLAS benchmarks" OFF )
 endif( )
+
+if( NOT BUILD_CLIENTS_NULL_DEVICE )
+  option( BUILD_CLIENTS_NULL_DEVICE "Build stub HIP runtime to run rocBLAS clients without a GPU" OFF )
+endif( )
@@ -17,3 +17,34 @@ bool ArgumentModel_get_log_function_name()
 {
     return log_function_name;
 }
+
+static bool        log_repeated_header = true;
+static std::string last_header;
+
+void ArgumentModel_set_log_repeated_header(bool f)
+{
+    log_repeated_header = f;
+    last_header.clear();
+}
+
+bool ArgumentModel_log_header(const std::string& header)
+{
+    if(log_repeated_header)
+        return true;
+    if(header == last_header)
+        return false;
+    last_header = header;
+    return true;
+}
+
+static double last_gpu_us = ArgumentLogging::NA_value;
+
+void ArgumentModel_set_last_gpu_us(double gpu_us)
+{
+    last_gpu_us = gpu_us;
+}
+
+double ArgumentModel_get_last_gpu_us()
+{
+    return last_gpu_us;
+}
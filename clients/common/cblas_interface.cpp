@@ -4,7 +4,9 @@
 #include "cblas_interface.hpp"
 #include "rocblas_vector.hpp"
 #include "utility.hpp"
+#include <algorithm>
 #include <omp.h>
+#include <vector>
 
 /*
  * ===========================================================================
@@ -439,6 +441,100 @@ void cblas_geam(rocblas_operation       transa,
 }
 
 // gemm
+namespace
+{
+    // Blocked, multi-threaded reference gemm for the precisions which cblas does not support.
+    // Tiles of op(A) and op(B) are converted to the compute type Tc as they are packed into
+    // per-thread buffers, instead of converting whole matrices up front, and the tiles of C
+    // are computed in parallel. Like cblas, C is not read when beta == 0.
+    template <typename Ti, typename To, typename Tc>
+    void ref_gemm(rocblas_operation transA,
+                  rocblas_operation transB,
+                  rocblas_int       m,
+                  rocblas_int       n,
+                  rocblas_int       k,
+                  Tc                alpha,
+                  const Ti*         A,
+                  rocblas_int       lda,
+                  const Ti*         B,
+                  rocblas_int       ldb,
+                  Tc                beta,
+                  To*               C,
+                  rocblas_int       ldc)
+    {
+        constexpr rocblas_int MC = 64, NC = 64, KC = 256;
+
+        if(m <= 0 || n <= 0)
+            return;
+
+        rocblas_int m_tiles = (m - 1) / MC + 1;
+        rocblas_int n_tiles = (n - 1) / NC + 1;
+        bool        use_AB  = k > 0 && alpha != 0;
+
+#pragma omp parallel
+        {
+            std::vector<Tc> Ap(size_t(MC) * KC), Bp(size_t(KC) * NC), Cp(size_t(MC) * NC);
+
+#pragma omp for collapse(2) schedule(dynamic)
+            for(rocblas_int jt = 0; jt < n_tiles; jt++)
+            {
+                for(rocblas_int it = 0; it < m_tiles; it++)
+                {
+                    rocblas_int i0 = it * MC, mb = std::min(MC, m - i0);
+                    rocblas_int j0 = jt * NC, nb = std::min(NC, n - j0);
+
+                    std::fill(Cp.begin(), Cp.end(), Tc(0));
+
+                    for(rocblas_int p0 = 0; use_AB && p0 < k; p0 += KC)
+                    {
+                        rocblas_int kb = std::min(KC, k - p0);
+
+                        // Pack op(A)[i0:i0+mb, p0:p0+kb] and op(B)[p0:p0+kb, j0:j0+nb]
+                        for(rocblas_int p = 0; p < kb; p++)
+                            for(rocblas_int i = 0; i < mb; i++)
+                                Ap[i + p * size_t(MC)] = static_cast<Tc>(
+                                    transA == rocblas_operation_none
+                                        ? A[(i0 + i) + (p0 + p) * size_t(lda)]
+                                        : A[(p0 + p) + (i0 + i) * size_t(lda)]);
+
+                        for(rocblas_int j = 0; j < nb; j++)
+                            for(rocblas_int p = 0; p < kb; p++)
+                                Bp[p + j * size_t(KC)] = static_cast<Tc>(
+                                    transB == rocblas_operation_none
+                                        ? B[(p0 + p) + (j0 + j) * size_t(ldb)]
+                                        : B[(j0 + j) + (p0 + p) * size_t(ldb)]);
+
+                        for(rocblas_int j = 0; j < nb; j++)
+                        {
+                            Tc* c = &Cp[j * size_t(MC)];
+                            for(rocblas_int p = 0; p < kb; p++)
+                            {
+                                Tc        b = Bp[p + j * size_t(KC)];
+                                const Tc* a = &Ap[p * size_t(MC)];
+#pragma omp simd
+                                for(rocblas_int i = 0; i < mb; i++)
+                                    c[i] += a[i] * b;
+                            }
+                        }
+                    }
+
+                    for(rocblas_int j = 0; j < nb; j++)
+                    {
+                        for(rocblas_int i = 0; i < mb; i++)
+                        {
+                            To& c  = C[(i0 + i) + (j0 + j) * size_t(ldc)];
+                            Tc  ab = alpha * Cp[i + j * size_t(MC)];
+                            if(beta != 0)
+                                ab += beta * static_cast<Tc>(c);
+                            c = static_cast<To>(ab);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 template <>
 void cblas_gemm<rocblas_bfloat16, float, float>(rocblas_operation transA,
                                                 rocblas_operation transB,
@@ -454,35 +550,9 @@ void cblas_gemm<rocblas_bfloat16, float, float>(rocblas_operation transA,
                                                 float*            C,
                                                 rocblas_int       ldc)
 {
-    // cblas does not support rocblas_bfloat16, so convert to higher precision float
+    // cblas does not support rocblas_bfloat16, so compute in higher precision float
     // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C,
-                ldc);
+    ref_gemm(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -500,41 +570,9 @@ void cblas_gemm<rocblas_bfloat16, rocblas_bfloat16, float>(rocblas_operation tra
                                                            rocblas_bfloat16* C,
                                                            rocblas_int       ldc)
 {
-    // cblas does not support rocblas_bfloat16, so convert to higher precision float
+    // cblas does not support rocblas_bfloat16, so compute in higher precision float
     // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = static_cast<float>(C[i]);
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C_float,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = static_cast<rocblas_bfloat16>(C_float[i]);
+    ref_gemm(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -552,36 +590,9 @@ void cblas_gemm<rocblas_half, float, float>(rocblas_operation transA,
                                             float*            C,
                                             rocblas_int       ldc)
 {
-    // cblas does not support rocblas_half, so convert to higher precision float
+    // cblas does not support rocblas_half, so compute in higher precision float
     // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C,
-                ldc);
+    ref_gemm(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -599,41 +610,9 @@ void cblas_gemm<rocblas_half, rocblas_half, float>(rocblas_operation transA,
                                                    rocblas_half*     C,
                                                    rocblas_int       ldc)
 {
-    // cblas does not support rocblas_half, so convert to higher precision float
+    // cblas does not support rocblas_half, so compute in higher precision float
     // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = C[i];
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C_float,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = rocblas_half(C_float[i]);
+    ref_gemm(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -651,43 +630,10 @@ void cblas_gemm<rocblas_half, rocblas_half, rocblas_half>(rocblas_operation tran
                                                           rocblas_half*     C,
                                                           rocblas_int       ldc)
 {
-    // cblas does not support rocblas_half, so convert to higher precision float
+    // cblas does not support rocblas_half, so compute in higher precision float
     // This will give more precise result which is acceptable for testing
-    float alpha_float = alpha;
-    float beta_float  = beta;
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = C[i];
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha_float,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta_float,
-                C_float,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = rocblas_half(C_float[i]);
+    ref_gemm<rocblas_half, rocblas_half, float>(
+        transA, transB, m, n, k, float(alpha), A, lda, B, ldb, float(beta), C, ldc);
 }
 
 template <>
@@ -705,45 +651,12 @@ void cblas_gemm<int8_t, int32_t, int32_t>(rocblas_operation transA,
                                           int32_t*          C,
                                           rocblas_int       ldc)
 {
-    // cblas does not support int8_t input / int32_t output, however non-overflowing
-    // 32-bit integer operations can be represented accurately with double-precision
-    // floats, so convert to doubles and downcast result down to int32_t.
+    // cblas does not support int8_t input / int32_t output, so accumulate exactly in
+    // 64-bit integers and downcast the result to int32_t.
     // NOTE: This will not properly account for 32-bit integer overflow, however
     //       the result should be acceptable for testing.
-
-    size_t const sizeA = ((transA == rocblas_operation_none) ? k : m) * size_t(lda);
-    size_t const sizeB = ((transB == rocblas_operation_none) ? n : k) * size_t(ldb);
-    size_t const sizeC = n * size_t(ldc);
-
-    host_vector<double> A_double(sizeA);
-    host_vector<double> B_double(sizeB);
-    host_vector<double> C_double(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_double[i] = static_cast<double>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_double[i] = static_cast<double>(B[i]);
-    for(size_t i = 0; i < sizeC; i++)
-        C_double[i] = static_cast<double>(C[i]);
-
-    // just directly cast, since transA, transB are integers in the enum
-    cblas_dgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_double,
-                lda,
-                B_double,
-                ldb,
-                beta,
-                C_double,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = static_cast<int32_t>(C_double[i]);
+    ref_gemm<int8_t, int32_t, int64_t>(
+        transA, transB, m, n, k, int64_t(alpha), A, lda, B, ldb, int64_t(beta), C, ldc);
 }
 
 template <typename T, typename U>
@@ -264,6 +264,11 @@ rocblas_local_handle::rocblas_local_handle(const Arguments& arg)
     // Set the atomics mode
     auto status = rocblas_set_atomics_mode(m_handle, arg.atomics_mode);
 
+    // Gemm tests with rocblas_gemm_algo_solution_index use that Tensile solution for all calls
+    if(status == rocblas_status_success && arg.algo == rocblas_gemm_algo_solution_index
+       && strstr(arg.function, "gemm"))
+        status = rocblas_set_solution_index(m_handle, arg.solution_index);
+
     if(status == rocblas_status_success)
     {
         // If the test specifies user allocated workspace, allocate and use it
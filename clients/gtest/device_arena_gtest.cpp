@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "testing_device_arena.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    template <typename...>
+    struct device_arena_testing : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "device_arena"))
+                testing_device_arena(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct device_arena : RocBLAS_Test<device_arena, device_arena_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "device_arena");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<device_arena>(arg.name);
+        }
+    };
+
+    TEST_P(device_arena, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<device_arena_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(device_arena);
+
+} // namespace
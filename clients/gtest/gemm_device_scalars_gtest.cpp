@@ -0,0 +1,80 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_device_scalars.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // In the general case of <Ti, To, Tc>, these tests do not apply, and if this
+    // functor is called, an internal error message is generated. When converted
+    // to bool, this functor returns false.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct gemm_device_scalars_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the input and output types are the same floating point type, this test
+    // applies, with a compute type of the same type, or of float for half precision
+    // accumulation (HPA). When converted to bool, this functor returns true.
+    template <typename Ti, typename To, typename Tc>
+    struct gemm_device_scalars_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<std::is_same<Ti, To>{}
+                         && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                             || (std::is_same<Ti, rocblas_half>{}
+                                 && (std::is_same<Tc, Ti>{} || std::is_same<Tc, float>{}))
+                             || (std::is_same<Ti, rocblas_bfloat16>{}
+                                 && std::is_same<Tc, float>{}))>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_device_scalars"))
+                testing_gemm_device_scalars<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct gemm_device_scalars : RocBLAS_Test<gemm_device_scalars, gemm_device_scalars_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_device_scalars");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_device_scalars> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type) << rocblas_datatype2string(arg.b_type)
+                 << rocblas_datatype2string(arg.c_type) << rocblas_datatype2string(arg.d_type)
+                 << rocblas_datatype2string(arg.compute_type);
+            return std::move(name);
+        }
+    };
+
+    TEST_P(gemm_device_scalars, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_gemm_dispatch<gemm_device_scalars_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_device_scalars);
+
+} // namespace
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <string>
+
+namespace
+{
+    template <typename...>
+    struct testing_gemm_epilogue : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const rocblas_operation transA = rocblas_operation_none;
+            const rocblas_operation transB = rocblas_operation_transpose;
+
+            rocblas_int M = arg.M, N = arg.N, K = arg.K;
+            rocblas_int lda = M, ldb = N, ldc = M, ldo = M + 1;
+            float       alpha = 1.0f, beta = 0.5f;
+
+            const rocblas_datatype  f32  = rocblas_datatype_f32_r;
+            const rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
+
+            rocblas_local_handle handle;
+
+            host_vector<float> hA(size_t(lda) * K), hB(size_t(ldb) * K), hC(size_t(ldc) * N);
+            host_vector<float> hScale(N), hBias(M), hO(size_t(ldo) * N);
+            rocblas_seedrand();
+            rocblas_init<float>(hA, M, K, lda);
+            rocblas_init<float>(hB, N, K, ldb);
+            rocblas_init<float>(hC, M, N, ldc);
+
+            // Scales of both signs, and zero, make values where GELU is not linear
+            for(rocblas_int j = 0; j < N; j++)
+                hScale[j] = (j % 3 - 1) * 0.25f;
+            for(rocblas_int i = 0; i < M; i++)
+                hBias[i] = (i % 9 - 4) * 0.5f;
+
+            device_vector<float> dA(hA.size()), dB(hB.size()), dC(hC.size()), dO(hO.size());
+            device_vector<float> dScale(N), dBias(M);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_DEVICE_ALLOCATION(dO.memcheck());
+            CHECK_DEVICE_ALLOCATION(dScale.memcheck());
+            CHECK_DEVICE_ALLOCATION(dBias.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_HIP_ERROR(dScale.transfer_from(hScale));
+            CHECK_HIP_ERROR(dBias.transfer_from(hBias));
+
+            // Per-column scale, per-row bias and GELU, written to a separate output
+            rocblas_gemm_epilogue epilogue{dScale,
+                                           rocblas_epilogue_vector_column,
+                                           dBias,
+                                           rocblas_epilogue_vector_row,
+                                           rocblas_activation_gelu,
+                                           dO,
+                                           f32,
+                                           ldo};
+
+            auto gemm = [&](const rocblas_gemm_epilogue* epilogue) {
+                return rocblas_gemm_epilogue_ex(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                dA,
+                                                f32,
+                                                lda,
+                                                dB,
+                                                f32,
+                                                ldb,
+                                                &beta,
+                                                dC,
+                                                f32,
+                                                ldc,
+                                                dC,
+                                                f32,
+                                                ldc,
+                                                f32,
+                                                epilogue,
+                                                algo,
+                                                0,
+                                                0);
+            };
+
+            // Invalid epilogues are rejected before the gemm
+            rocblas_gemm_epilogue bad = epilogue;
+            EXPECT_ROCBLAS_STATUS(gemm(nullptr), rocblas_status_invalid_pointer);
+            bad.activation = rocblas_activation(3);
+            EXPECT_ROCBLAS_STATUS(gemm(&bad), rocblas_status_invalid_value);
+            bad     = epilogue;
+            bad.ldo = M - 1;
+            EXPECT_ROCBLAS_STATUS(gemm(&bad), rocblas_status_invalid_size);
+            bad             = epilogue;
+            bad.output_type = rocblas_datatype_i32_r;
+            EXPECT_ROCBLAS_STATUS(gemm(&bad), rocblas_status_not_implemented);
+
+            CHECK_ROCBLAS_ERROR(gemm(&epilogue));
+            CHECK_HIP_ERROR(hO.transfer_from(dO));
+
+            cblas_gemm<float>(transA, transB, M, N, K, alpha, hA, lda, hB, ldb, beta, hC, ldc);
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    double x    = double(hC[i + size_t(ldc) * j]) * hScale[j] + hBias[i];
+                    double t    = std::tanh(0.7978845608028654 * (x + 0.044715 * x * x * x));
+                    double gelu = 0.5 * x * (1 + t);
+                    EXPECT_NEAR(hO[i + size_t(ldo) * j], gelu, std::abs(gelu) * 1e-5 + 1e-5);
+                }
+
+            // ReLU in place of D
+            epilogue.output     = nullptr;
+            epilogue.activation = rocblas_activation_relu;
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            alpha = 0.0f;
+            beta  = 1.0f;
+            CHECK_ROCBLAS_ERROR(gemm(&epilogue));
+            CHECK_HIP_ERROR(hO.transfer_from(dC));
+
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    float x = hC[i + size_t(ldc) * j] * hScale[j] + hBias[i];
+                    EXPECT_NEAR(hO[i + size_t(ldc) * j], x > 0 ? x : 0, std::abs(x) * 1e-5 + 1e-5);
+                }
+        }
+    };
+
+    struct gemm_epilogue : RocBLAS_Test<gemm_epilogue, testing_gemm_epilogue>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_epilogue_ex");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_epilogue> name(arg.name);
+            name << '_' << arg.M << '_' << arg.N << '_' << arg.K;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(gemm_epilogue, blas_ex)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemm_epilogue<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_epilogue)
+
+} // namespace
@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_grouped_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // In the general case of <Ti, To, Tc>, these tests do not apply, and if this
+    // functor is called, an internal error message is generated. When converted
+    // to bool, this functor returns false.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct gemm_grouped_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The types of rocblas_gemm_ex apply to every group
+    template <typename Ti, typename To, typename Tc>
+    struct gemm_grouped_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<!std::is_same<Ti, void>{}
+                         && !(std::is_same<Ti, Tc>{} && std::is_same<Ti, rocblas_bfloat16>{})>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_grouped_ex"))
+                testing_gemm_grouped_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_ex_bad_arg"))
+                testing_gemm_grouped_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct gemm_grouped_ex : RocBLAS_Test<gemm_grouped_ex, gemm_grouped_ex_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_grouped_ex")
+                   || !strcmp(arg.function, "gemm_grouped_ex_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_grouped_ex> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type) << rocblas_datatype2string(arg.b_type)
+                 << rocblas_datatype2string(arg.c_type) << rocblas_datatype2string(arg.d_type)
+                 << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+                return std::move(name);
+
+            name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                 << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                 << arg.lda << '_' << arg.ldb << '_' << arg.beta << '_' << arg.ldc << '_'
+                 << arg.ldd << '_' << arg.batch_count;
+
+            return std::move(name);
+        }
+    };
+
+    TEST_P(gemm_grouped_ex, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_gemm_dispatch<gemm_grouped_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped_ex);
+
+} // namespace
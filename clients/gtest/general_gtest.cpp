@@ -6,6 +6,7 @@
 
 #include "../../library/src/include/check_numerics_matrix.hpp"
 #include "../../library/src/include/check_numerics_vector.hpp"
+#include "rocblas.hpp"
 #include "rocblas_data.hpp"
 #include "rocblas_vector.hpp"
 #include "type_dispatch.hpp"
@@ -406,6 +407,30 @@ namespace
 
         EXPECT_EQ(status, rocblas_status_check_numerics_fail);
 
+        //==============================================================================================
+        // Testing deferred reporting of the NaN in batched vectors
+        //==============================================================================================
+        EXPECT_ROCBLAS_STATUS(rocblas_synchronize_check_numerics(nullptr),
+                              rocblas_status_invalid_handle);
+
+        status = rocblas_internal_check_numerics_vector_template(
+            function_name,
+            handle,
+            N,
+            d_x_batch.const_batch_ptr(),
+            offset_x,
+            inc_x,
+            stride_x,
+            batch_count,
+            check_numerics | rocblas_check_numerics_mode_deferred,
+            is_input);
+
+        // The NaN is reported when the check is synchronized, and only once
+        EXPECT_EQ(status, rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(rocblas_synchronize_check_numerics(handle),
+                              rocblas_status_check_numerics_fail);
+        EXPECT_ROCBLAS_STATUS(rocblas_synchronize_check_numerics(handle), rocblas_status_success);
+
         CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
     };
 
@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "testing_ostream_async.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    template <typename...>
+    struct ostream_async_testing : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "ostream_async"))
+                testing_ostream_async(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct ostream_async : RocBLAS_Test<ostream_async, ostream_async_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "ostream_async");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<ostream_async>(arg.name);
+        }
+    };
+
+    TEST_P(ostream_async, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<ostream_async_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ostream_async);
+
+} // namespace
@@ -6,6 +6,7 @@
 #include "rocblas_datatype2string.hpp"
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_async_panels.hpp"
 #include "type_dispatch.hpp"
 #include <cstring>
 #include <type_traits>
@@ -16,6 +17,7 @@ namespace
     {
         SET_GET_MATRIX_SYNC,
         SET_GET_MATRIX_ASYNC,
+        SET_GET_MATRIX_ASYNC_PANELS,
     };
 
     template <template <typename...> class FILTER, sync_type TRANSFER_TYPE>
@@ -38,6 +40,8 @@ namespace
                 return !strcmp(arg.function, "set_get_matrix_sync");
             case SET_GET_MATRIX_ASYNC:
                 return !strcmp(arg.function, "set_get_matrix_async");
+            case SET_GET_MATRIX_ASYNC_PANELS:
+                return !strcmp(arg.function, "set_get_matrix_async_panels");
             }
             return false;
         }
@@ -82,6 +86,8 @@ namespace
                 testing_set_get_matrix<T>(arg);
             else if(!strcmp(arg.function, "set_get_matrix_async"))
                 testing_set_get_matrix_async<T>(arg);
+            else if(!strcmp(arg.function, "set_get_matrix_async_panels"))
+                testing_set_get_matrix_async_panels<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -105,4 +111,13 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(set_get_matrix_async);
 
+    using set_get_matrix_async_panels
+        = matrix_set_get_template<set_get_matrix_testing, SET_GET_MATRIX_ASYNC_PANELS>;
+    TEST_P(set_get_matrix_async_panels, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<set_get_matrix_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_matrix_async_panels);
+
 } // namespace
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <string>
+
+namespace
+{
+    template <typename...>
+    struct testing_solution_cache : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_int M = arg.M, N = arg.N, K = arg.K;
+            float       alpha = 1.0f, beta = 0.5f;
+
+            rocblas_local_handle handle;
+            size_t               hits, misses;
+
+            EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_stats(nullptr, &hits, &misses),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_stats(handle, nullptr, &misses),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_stats(handle, &hits, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            device_vector<float> dA(size_t(M) * K), dB(size_t(K) * N), dC(size_t(M) * N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+            auto gemm = [&] {
+                CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  dA,
+                                                  M,
+                                                  dB,
+                                                  K,
+                                                  &beta,
+                                                  dC,
+                                                  M));
+            };
+
+            // Prime the cache with the problem shape
+            gemm();
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits, &misses));
+
+            // Repeating the same problem shape must be served from the cache
+            // (The cache is per-device, so other threads may add to the counts)
+            size_t hits2, misses2;
+            for(int i = 0; i < 10; ++i)
+                gemm();
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits2, &misses2));
+            EXPECT_GE(hits2 - hits, 10u);
+
+            // For HPA half, alpha is converted to half before Tensile restricts solutions by
+            // it, so a float alpha which rounds to 1 selects a solution restricted to alpha == 1,
+            // which must not be reused for another alpha of the same shape. A and B hold small
+            // integers, so that the results are exact.
+            host_vector<rocblas_half> hA(size_t(M) * K), hB(size_t(K) * N), hD(size_t(M) * N);
+            for(size_t i = 0; i < hA.size(); ++i)
+                hA[i] = rocblas_half(float(rocblas_int(i % 3) - 1));
+            for(size_t i = 0; i < hB.size(); ++i)
+                hB[i] = rocblas_half(float(rocblas_int(i % 5) - 2));
+
+            device_vector<rocblas_half> dhA(hA.size()), dhB(hB.size()), dhD(hD.size());
+            CHECK_DEVICE_ALLOCATION(dhA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dhB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dhD.memcheck());
+            CHECK_HIP_ERROR(dhA.transfer_from(hA));
+            CHECK_HIP_ERROR(dhB.transfer_from(hB));
+
+            for(float alpha_hpa : {1.0002f, 2.5f, 1.0002f})
+            {
+                SCOPED_TRACE(testing::Message() << "alpha=" << alpha_hpa);
+                float beta_hpa = 0;
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                                    rocblas_operation_none,
+                                                    rocblas_operation_none,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &alpha_hpa,
+                                                    dhA,
+                                                    rocblas_datatype_f16_r,
+                                                    M,
+                                                    dhB,
+                                                    rocblas_datatype_f16_r,
+                                                    K,
+                                                    &beta_hpa,
+                                                    dhD,
+                                                    rocblas_datatype_f16_r,
+                                                    M,
+                                                    dhD,
+                                                    rocblas_datatype_f16_r,
+                                                    M,
+                                                    rocblas_datatype_f32_r,
+                                                    rocblas_gemm_algo_standard,
+                                                    0,
+                                                    rocblas_gemm_flags_none));
+                CHECK_HIP_ERROR(hD.transfer_from(dhD));
+
+                float  alpha_half = float(rocblas_half(alpha_hpa));
+                size_t errors     = 0;
+                for(rocblas_int j = 0; j < N; ++j)
+                    for(rocblas_int i = 0; i < M; ++i)
+                    {
+                        float sum = 0;
+                        for(rocblas_int l = 0; l < K; ++l)
+                            sum += float(hA[i + l * size_t(M)]) * float(hB[l + j * size_t(K)]);
+                        errors += float(hD[i + j * size_t(M)]) != alpha_half * sum;
+                    }
+                EXPECT_EQ(errors, 0u);
+            }
+
+            // Code objects are loaded as their kernels are first launched
+            double startup_ms;
+            size_t loaded, total;
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_tensile_load_stats(nullptr, &startup_ms, &loaded, &total),
+                rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_tensile_load_stats(handle, nullptr, &loaded, &total),
+                rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_tensile_load_stats(handle, &startup_ms, nullptr, &total),
+                rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_tensile_load_stats(handle, &startup_ms, &loaded, nullptr),
+                rocblas_status_invalid_pointer);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_get_tensile_load_stats(handle, &startup_ms, &loaded, &total));
+            EXPECT_GE(startup_ms, 0.0);
+            EXPECT_LE(loaded, total);
+        }
+    };
+
+    struct solution_cache : RocBLAS_Test<solution_cache, testing_solution_cache>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "solution_cache");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<solution_cache>(arg.name);
+        }
+    };
+
+    TEST_P(solution_cache, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_solution_cache<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(solution_cache)
+
+} // namespace
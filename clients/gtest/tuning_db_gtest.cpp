@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "testing_tuning_db.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    template <typename...>
+    struct tuning_db_testing : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "tuning_db"))
+                testing_tuning_db(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct tuning_db : RocBLAS_Test<tuning_db, tuning_db_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "tuning_db");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<tuning_db>(arg.name);
+        }
+    };
+
+    TEST_P(tuning_db, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<tuning_db_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(tuning_db);
+
+} // namespace
@@ -14,6 +14,14 @@ namespace ArgumentLogging
 void ArgumentModel_set_log_function_name(bool f);
 bool ArgumentModel_get_log_function_name();
 
+// When repeated headers are not logged, a header is only logged if it differs from the last one
+void ArgumentModel_set_log_repeated_header(bool f);
+bool ArgumentModel_log_header(const std::string& header);
+
+// The GPU time per call of the last logged performance result, used by rocblas-bench --tune
+void   ArgumentModel_set_last_gpu_us(double gpu_us);
+double ArgumentModel_get_last_gpu_us();
+
 // ArgumentModel template has a variadic list of argument enums
 template <rocblas_argument... Args>
 class ArgumentModel
@@ -49,6 +57,8 @@ public:
         if(hot_calls > 1)
             gpu_us /= hot_calls;
 
+        ArgumentModel_set_last_gpu_us(gpu_us);
+
         // per/us to per/sec *10^6
         double rocblas_gflops = gflops * batch_count / gpu_us * 1e6;
         double rocblas_GBps   = gbytes * batch_count / gpu_us * 1e6;
@@ -185,6 +195,8 @@ public:
                      norm3,
                      norm4);
 
-        str << name_list << "\n" << value_list << std::endl;
+        if(ArgumentModel_log_header(name_list.str()))
+            str << name_list << "\n";
+        str << value_list << std::endl;
     }
 };
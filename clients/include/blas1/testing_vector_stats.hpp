@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+
+// Each statistic of vector_stats is the result of its own routine with the same arguments
+template <typename T>
+void testing_vector_stats(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    auto rocblas_vector_stats_fn
+        = arg.fortran ? rocblas_vector_stats<T, true> : rocblas_vector_stats<T, false>;
+    auto rocblas_dotc_fn = is_complex<T> ? rocblas_dotc<T> : rocblas_dot<T>;
+
+    // One length is reduced by a single block, and the other by two kernels
+    const rocblas_int n_small = 500, n_large = 100000;
+
+    rocblas_local_handle handle{arg};
+
+    host_vector<T> hx(n_large), hy(n_large);
+    for(rocblas_int i = 0; i < n_large; ++i)
+    {
+        hx[i] = T(rocblas_int(i % 5) - 2);
+        hy[i] = T(rocblas_int(i % 7) - 3);
+    }
+    hx[n_small / 2] = hx[n_large / 3] = T(-9);
+
+    device_vector<T> dx(n_large), dy(n_large);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    struct results_t
+    {
+        Tr          nrm2, asum;
+        rocblas_int amax;
+        T           dot;
+    };
+
+    // The values are small integers, so the sums are exact, while nrm2 takes a square root
+    auto check = [](const results_t& r, const results_t& gold) {
+        EXPECT_NEAR(r.nrm2, gold.nrm2, gold.nrm2 * 4 * std::numeric_limits<Tr>::epsilon());
+        EXPECT_EQ(r.asum, gold.asum);
+        EXPECT_EQ(r.amax, gold.amax);
+        EXPECT_EQ(r.dot, gold.dot);
+    };
+
+    results_t r;
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_vector_stats_fn(nullptr, n_small, dx, 1, dy, 1, &r.nrm2, &r.asum, &r.amax, &r.dot),
+        rocblas_status_invalid_handle);
+
+    // At least one statistic is requested, and y is needed for dot
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_vector_stats_fn(handle, 1, dx, 1, dy, 1, nullptr, nullptr, nullptr, nullptr),
+        rocblas_status_invalid_pointer);
+    for(rocblas_int incx : {1, 0})
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_vector_stats_fn(
+                handle, n_small, dx, incx, nullptr, 1, &r.nrm2, nullptr, nullptr, &r.dot),
+            rocblas_status_invalid_pointer);
+
+    // Lengths of zero give zeros
+    memset(&r, 0xff, sizeof(r));
+    CHECK_ROCBLAS_ERROR(rocblas_vector_stats_fn(
+        handle, 0, nullptr, 1, nullptr, 1, &r.nrm2, &r.asum, &r.amax, &r.dot));
+    check(r, results_t{0, 0, 0, T(0)});
+
+    // The statistics of each length and increment, from their own routines
+    auto gold_stats = [&](rocblas_int n, rocblas_int incx, rocblas_int incy) {
+        results_t gold;
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, n, dx, incx, &gold.nrm2));
+        CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, n, dx, incx, &gold.asum));
+        CHECK_ROCBLAS_ERROR(rocblas_iamax<T>(handle, n, dx, incx, &gold.amax));
+        CHECK_ROCBLAS_ERROR(rocblas_dotc_fn(handle, n, dx, incx, dy, incy, &gold.dot));
+        return gold;
+    };
+
+    device_vector<Tr>          d_reals(2);
+    device_vector<rocblas_int> d_amax(1);
+    device_vector<T>           d_dot(1);
+    CHECK_DEVICE_ALLOCATION(d_reals.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_amax.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot.memcheck());
+
+    // nrm2, asum and amax are 0 for incx <= 0, but dot is computed with incx, as in dotc
+    for(rocblas_int n : {n_small, n_large})
+        for(rocblas_int incx : {1, -1, 0})
+            for(rocblas_int incy : {1, -1})
+            {
+                SCOPED_TRACE(testing::Message()
+                             << "n=" << n << " incx=" << incx << " incy=" << incy);
+                results_t gold = gold_stats(n, incx, incy);
+
+                memset(&r, 0xff, sizeof(r));
+                CHECK_ROCBLAS_ERROR(rocblas_vector_stats_fn(
+                    handle, n, dx, incx, dy, incy, &r.nrm2, &r.asum, &r.amax, &r.dot));
+                check(r, gold);
+
+                // Statistics which are not requested are not written, and y is not needed
+                results_t some;
+                memset(&some, 0xff, sizeof(some));
+                auto unset = some;
+                CHECK_ROCBLAS_ERROR(rocblas_vector_stats_fn(
+                    handle, n, dx, incx, nullptr, incy, nullptr, &some.asum, &some.amax, nullptr));
+                EXPECT_EQ(some.asum, gold.asum);
+                EXPECT_EQ(some.amax, gold.amax);
+                EXPECT_EQ(memcmp(&some.nrm2, &unset.nrm2, sizeof(Tr)), 0);
+                EXPECT_EQ(memcmp(&some.dot, &unset.dot, sizeof(T)), 0);
+
+                // Results on the device
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                CHECK_ROCBLAS_ERROR(rocblas_vector_stats_fn(
+                    handle, n, dx, incx, dy, incy, d_reals + 0, d_reals + 1, d_amax, d_dot));
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+                host_vector<Tr>          h_reals(2);
+                host_vector<rocblas_int> h_amax(1);
+                host_vector<T>           h_dot(1);
+                CHECK_HIP_ERROR(h_reals.transfer_from(d_reals));
+                CHECK_HIP_ERROR(h_amax.transfer_from(d_amax));
+                CHECK_HIP_ERROR(h_dot.transfer_from(d_dot));
+                check(results_t{h_reals[0], h_reals[1], h_amax[0], h_dot[0]}, gold);
+            }
+
+    // The statistics of the deferred results are computed before results are deferred
+    const rocblas_int deferred_incx[] = {1, -1, 0};
+    results_t         deferred_gold[3];
+    for(int i = 0; i < 3; ++i)
+        deferred_gold[i] = gold_stats(n_large, deferred_incx[i], 1);
+
+    // Deferred results are held in device memory, which the size query includes
+    size_t size_blocking, size_deferred;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(rocblas_vector_stats_fn(
+        handle, n_large, dx, 1, dy, 1, &r.nrm2, &r.asum, &r.amax, &r.dot));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size_blocking));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_host_result_mode(handle, rocblas_host_result_deferred));
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(rocblas_vector_stats_fn(
+        handle, n_large, dx, 1, dy, 1, &r.nrm2, &r.asum, &r.amax, &r.dot));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size_deferred));
+    EXPECT_GT(size_deferred, size_blocking);
+
+    // Deferred results, including only dot for incx <= 0, are written once synchronized
+    for(int i = 0; i < 3; ++i)
+    {
+        rocblas_int      incx = deferred_incx[i];
+        const results_t& gold = deferred_gold[i];
+        SCOPED_TRACE(testing::Message() << "deferred incx=" << incx);
+
+        results_t some;
+        memset(&r, 0xff, sizeof(r));
+        memset(&some, 0xff, sizeof(some));
+        auto unset = some;
+        CHECK_ROCBLAS_ERROR(rocblas_vector_stats_fn(
+            handle, n_large, dx, incx, dy, 1, &r.nrm2, &r.asum, &r.amax, &r.dot));
+        CHECK_ROCBLAS_ERROR(rocblas_vector_stats_fn(
+            handle, n_large, dx, incx, dy, 1, &some.nrm2, nullptr, nullptr, &some.dot));
+        CHECK_ROCBLAS_ERROR(rocblas_synchronize_host_results(handle));
+        check(r, gold);
+        EXPECT_NEAR(some.nrm2, gold.nrm2, gold.nrm2 * 4 * std::numeric_limits<Tr>::epsilon());
+        EXPECT_EQ(some.dot, gold.dot);
+        EXPECT_EQ(memcmp(&some.asum, &unset.asum, sizeof(Tr)), 0);
+        EXPECT_EQ(memcmp(&some.amax, &unset.amax, sizeof(rocblas_int)), 0);
+    }
+    CHECK_ROCBLAS_ERROR(rocblas_set_host_result_mode(handle, rocblas_host_result_blocking));
+}
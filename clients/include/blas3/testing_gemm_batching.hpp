@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemm_batching(const Arguments& arg)
+{
+    const rocblas_operation N = rocblas_operation_none, Tr = rocblas_operation_transpose;
+    const rocblas_int       n = 8, count = 6;
+    const size_t            size = size_t(n) * n;
+    const T                 one = 1, zero = 0, two = 2;
+
+    rocblas_local_handle       handle{arg};
+    rocblas_gemm_batching_mode mode = rocblas_gemm_batching_mode(-1);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_flush_gemm_batches(nullptr), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_batching_mode(handle, rocblas_gemm_batching_mode(2)),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_batching_mode(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // The default mode launches each gemm when it is called
+    CHECK_ROCBLAS_ERROR(rocblas_get_gemm_batching_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_gemm_batching_none);
+
+    host_vector<T> hA(size * count), hB(size * count), hC(size * count), hC_gold(size * count);
+    for(size_t i = 0; i < size * count; ++i)
+    {
+        hA[i] = T(rocblas_int(i % 5) - 2);
+        hB[i] = T(rocblas_int(i % 7) - 3);
+    }
+
+    device_vector<T> dA(size * count), dB(size * count), dC(size * count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    // Gemms 0-3 share their arguments, gemm 4 differs in its transpose, and gemm 5
+    // reads the C of gemm 0 and writes the C of gemm 1, so it follows them
+    auto run = [&](host_vector<T>& result) {
+        CHECK_HIP_ERROR(hipMemset(dC, 0, size * count * sizeof(T)));
+        for(rocblas_int i = 0; i < 5; ++i)
+            CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(handle,
+                                                i == 4 ? Tr : N,
+                                                N,
+                                                n,
+                                                n,
+                                                n,
+                                                &one,
+                                                dA + i * size,
+                                                n,
+                                                dB + i * size,
+                                                n,
+                                                &zero,
+                                                dC + i * size,
+                                                n));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(
+            handle, N, N, n, n, n, &two, dC + 0, n, dB, n, &one, dC + size, n));
+        CHECK_ROCBLAS_ERROR(rocblas_flush_gemm_batches(handle));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        CHECK_HIP_ERROR(result.transfer_from(dC));
+    };
+
+    run(hC_gold);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemm_batching_mode(handle, rocblas_gemm_batching_deferred));
+    CHECK_ROCBLAS_ERROR(rocblas_get_gemm_batching_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_gemm_batching_deferred);
+
+    run(hC);
+
+    // The values are small integers, so the results are exact
+    for(size_t i = 0; i < size * count; ++i)
+        EXPECT_EQ(hC[i], hC_gold[i]);
+
+    // Gemms queued when the mode is reset are launched
+    CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(handle, N, N, n, n, n, &one, dA, n, dB, n, &zero, dC, n));
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemm_batching_mode(handle, rocblas_gemm_batching_none));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    for(size_t i = 0; i < size; ++i)
+        EXPECT_EQ(hC[i], hC_gold[i]);
+}
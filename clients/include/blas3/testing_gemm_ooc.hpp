@@ -0,0 +1,209 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "host_pinned_vector.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemm_ooc_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_ooc_fn = arg.fortran ? rocblas_gemm_ooc<T, true> : rocblas_gemm_ooc<T, false>;
+
+    const rocblas_int       M = 100, N = 100, K = 100;
+    const rocblas_int       lda = 100, ldb = 100, ldc = 100;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+    const T                 alpha(1), beta(1);
+
+    rocblas_local_handle handle{arg};
+
+    // The matrices are on the host
+    host_vector<T> hA(size_t(lda) * K), hB(size_t(ldb) * N), hC(size_t(ldc) * N);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_ooc_fn(
+            handle, transA, transB, M, N, K, &alpha, nullptr, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_ooc_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, nullptr, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_ooc_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_ooc_fn(
+            handle, transA, transB, M, N, K, nullptr, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_ooc_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, nullptr, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_ooc_fn(
+            nullptr, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_ooc_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, M - 1, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_size);
+
+    // If M==0, then all pointers can be nullptr without issue.
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ooc_fn(handle,
+                                              transA,
+                                              transB,
+                                              0,
+                                              N,
+                                              K,
+                                              nullptr,
+                                              nullptr,
+                                              lda,
+                                              nullptr,
+                                              ldb,
+                                              nullptr,
+                                              nullptr,
+                                              ldc),
+                          rocblas_status_success);
+
+    // An empty C needs no workspace
+    size_t size;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_ooc_fn(
+            handle, transA, transB, 0, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_size_unchanged);
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_EQ(size, 0);
+}
+
+template <typename T>
+void testing_gemm_ooc(const Arguments& arg)
+{
+    auto rocblas_gemm_ooc_fn = arg.fortran ? rocblas_gemm_ooc<T, true> : rocblas_gemm_ooc<T, false>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ooc_fn(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  nullptr,
+                                                  nullptr,
+                                                  lda,
+                                                  nullptr,
+                                                  ldb,
+                                                  nullptr,
+                                                  nullptr,
+                                                  ldc),
+                              rocblas_status_invalid_size);
+
+        return;
+    }
+
+    const size_t size_A = size_t(lda) * A_col;
+    const size_t size_B = size_t(ldb) * B_col;
+    const size_t size_C = size_t(ldc) * N;
+
+    // The matrices are pinned, so that copies overlap the multiplications
+    host_pinned_vector<T> hA(size_A, 1);
+    host_pinned_vector<T> hB(size_B, 1);
+    host_pinned_vector<T> hC_1(size_C, 1);
+    host_pinned_vector<T> hC_2(size_C, 1);
+    host_vector<T>        hC_gold(size_C);
+
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_seedrand();
+    rocblas_init<T>(hA, A_row, A_col, lda);
+    rocblas_init_alternating_sign<T>(hB, B_row, B_col, ldb);
+
+    // With beta == 0, C must not be read, so NaN in C must not propagate
+    if(h_beta == T(0))
+        rocblas_init_nan<T>(hC_gold, M, N, ldc);
+    else
+        rocblas_init<T>(hC_gold, M, N, ldc);
+    std::copy(hC_gold.begin(), hC_gold.end(), hC_1.begin());
+    std::copy(hC_gold.begin(), hC_gold.end(), hC_2.begin());
+
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // The workspace is the size returned by the query, which holds tiles of at most 64 x 64 x 64,
+    // so that larger problems use several tiles and both slots of each buffer
+    size_t size;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(rocblas_gemm_ooc_fn(
+        handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC_1, ldc));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    if(M && N)
+        EXPECT_GT(size, 0);
+    CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+
+    // ROCBLAS rocblas_pointer_mode_host
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_ooc_fn(
+        handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC_1, ldc));
+
+    // ROCBLAS rocblas_pointer_mode_device
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_ooc_fn(
+        handle, transA, transB, M, N, K, d_alpha, hA, lda, hB, ldb, d_beta, hC_2, ldc));
+
+    // CPU BLAS
+    cblas_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+    if(arg.unit_check)
+    {
+        unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+        unit_check_general<T>(M, N, ldc, hC_gold, hC_2);
+    }
+}
@@ -198,6 +198,25 @@ void testing_syr2k(const Arguments& arg)
     CHECK_HIP_ERROR(dB.transfer_from(hB));
     CHECK_HIP_ERROR(dC.transfer_from(hC_1));
 
+    // syrkx queries the device memory of its arrays of pointers to the blocks of C, which are
+    // used once C has at least two diagonal blocks of 16 or 32 rows, depending on the precision.
+    // With a tiny user-managed memory, syrkx falls back to a loop of gemm calls instead.
+    if(!TWOK && !arg.user_allocated_workspace)
+    {
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocblas_syrXX_fn(
+            handle, uplo, transA, N, K, &h_alpha[0], dA, lda, dB, ldb, &h_beta[0], dC, ldc));
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(N >= 64)
+            EXPECT_GT(size, 0);
+        else if(N < 32)
+            EXPECT_EQ(size, 0);
+
+        if(!ROCBLAS_REALLOC_ON_DEMAND)
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
     if(arg.unit_check || arg.norm_check)
     {
         // host alpha/beta
@@ -234,6 +234,37 @@ void testing_syr2k_batched(const Arguments& arg)
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dB.transfer_from(hB));
 
+    // syrkx queries the device memory of its arrays of pointers to the blocks of C, which are
+    // used once C has at least two diagonal blocks of 16 or 32 rows, depending on the precision.
+    // With a tiny user-managed memory, syrkx falls back to a loop of gemm calls instead.
+    if(!TWOK && !arg.user_allocated_workspace)
+    {
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocblas_syrk_batched_fn(handle,
+                                                  uplo,
+                                                  transA,
+                                                  N,
+                                                  K,
+                                                  &h_alpha[0],
+                                                  dA.ptr_on_device(),
+                                                  lda,
+                                                  dB.ptr_on_device(),
+                                                  ldb,
+                                                  &h_beta[0],
+                                                  dC.ptr_on_device(),
+                                                  ldc,
+                                                  batch_count));
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(N >= 64)
+            EXPECT_GT(size, 0);
+        else if(N < 32)
+            EXPECT_EQ(size, 0);
+
+        if(!ROCBLAS_REALLOC_ON_DEMAND)
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
     if(arg.unit_check || arg.norm_check)
     {
         // host alpha/beta
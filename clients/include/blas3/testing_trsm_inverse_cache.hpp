@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+
+// Cached inverses of the diagonal blocks of A give the results of trsm which computes them
+template <typename T>
+void testing_trsm_inverse_cache(const Arguments& arg)
+{
+    // The order of A is not a multiple of the block size of the inverses
+    const rocblas_int       m = 300, n = 40, lda = m, ldb = m;
+    const T                 alpha = T(2);
+    const rocblas_side      L     = rocblas_side_left;
+    const rocblas_fill      LO    = rocblas_fill_lower;
+    const rocblas_operation N     = rocblas_operation_none;
+    const rocblas_diagonal  NU    = rocblas_diagonal_non_unit;
+
+    rocblas_local_handle            handle{arg};
+    rocblas_trsm_inverse_cache_mode mode = rocblas_trsm_inverse_cache_mode(-1);
+    rocblas_trsm_operator           op;
+    size_t                          hits, misses;
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_trsm_inverse_cache_mode(handle, rocblas_trsm_inverse_cache_mode(2)),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_trsm_inverse_cache_mode(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_trsm_inverse_cache_stats(handle, &hits, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // By default, each call computes the inverses
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_inverse_cache_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_trsm_inverse_cache_none);
+
+    // A is well conditioned, and its upper part is not referenced
+    host_vector<T> hA(size_t(lda) * m), hB(size_t(ldb) * n), h_gold(hB.size()),
+        h_result(hB.size());
+    for(rocblas_int j = 0; j < m; ++j)
+        for(rocblas_int i = 0; i < m; ++i)
+            hA[i + j * size_t(lda)]
+                = i == j ? T(4) : i > j ? T(rocblas_int((i + j) % 5) - 2) / T(m) : T(7);
+    for(size_t i = 0; i < hB.size(); ++i)
+        hB[i] = T(rocblas_int(i % 7) - 3);
+
+    device_vector<T> dA(hA.size()), dB(hB.size());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    // Solves for B with rocblas_Xtrsm, returning X in h_out
+    auto solve = [&](host_vector<T>& h_out) {
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_trsm<T>(handle, L, LO, N, NU, m, n, &alpha, dA, lda, dB, ldb));
+        CHECK_HIP_ERROR(h_out.transfer_from(dB));
+    };
+
+    // Cached inverses are computed by the same kernels, so the results are identical
+    auto check = [&] {
+        for(size_t i = 0; i < h_gold.size(); ++i)
+            ASSERT_EQ(h_result[i], h_gold[i]);
+    };
+
+    solve(h_gold);
+
+    // The inverses are computed by the first call, and reused by the others
+    CHECK_ROCBLAS_ERROR(
+        rocblas_set_trsm_inverse_cache_mode(handle, rocblas_trsm_inverse_cache_enabled));
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_inverse_cache_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_trsm_inverse_cache_enabled);
+    for(int i = 0; i < 3; ++i)
+    {
+        solve(h_result);
+        check();
+    }
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_inverse_cache_stats(handle, &hits, &misses));
+    EXPECT_EQ(hits, size_t(2));
+    EXPECT_EQ(misses, size_t(1));
+
+    // A which changes in a new generation is not solved with the inverses of the old A
+    hA[0] = T(8);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocblas_set_trsm_inverse_generation(handle, 1));
+    solve(h_result);
+    CHECK_ROCBLAS_ERROR(
+        rocblas_set_trsm_inverse_cache_mode(handle, rocblas_trsm_inverse_cache_none));
+    solve(h_gold);
+    check();
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_inverse_cache_stats(handle, &hits, &misses));
+    EXPECT_EQ(hits, size_t(2));
+    EXPECT_EQ(misses, size_t(2));
+
+    // Copies of A at different addresses are cached separately, and when more of them are
+    // solved than are kept, the memory of the least recently used is reused for the others
+    const rocblas_int copies = 18;
+    device_vector<T>  dA_copies(hA.size() * copies);
+    CHECK_DEVICE_ALLOCATION(dA_copies.memcheck());
+    for(rocblas_int c = 0; c < copies; ++c)
+        CHECK_HIP_ERROR(hipMemcpy(dA_copies + c * hA.size(),
+                                  dA,
+                                  sizeof(T) * hA.size(),
+                                  hipMemcpyDeviceToDevice));
+
+    auto solve_copy = [&](rocblas_int c) {
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(rocblas_trsm<T>(
+            handle, L, LO, N, NU, m, n, &alpha, dA_copies + c * hA.size(), lda, dB, ldb));
+        CHECK_HIP_ERROR(h_result.transfer_from(dB));
+        check();
+    };
+
+    CHECK_ROCBLAS_ERROR(
+        rocblas_set_trsm_inverse_cache_mode(handle, rocblas_trsm_inverse_cache_enabled));
+    for(rocblas_int c = 0; c < copies; ++c)
+        solve_copy(c);
+
+    // The first copies were evicted, while the last ones are still kept
+    solve_copy(0);
+    solve_copy(copies - 1);
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_inverse_cache_stats(handle, &hits, &misses));
+    EXPECT_EQ(hits, size_t(3));
+    EXPECT_EQ(misses, size_t(2 + copies + 1));
+
+    // After the stream changes, the evicted buffers are reused on the new stream
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+    solve_copy(1);
+    solve_copy(2);
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_set_trsm_inverse_cache_mode(handle, rocblas_trsm_inverse_cache_none));
+
+    // A prepared operator gives the results of trsm
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_operator_create(
+                              handle, L, LO, N, NU, m, dA, m - 1, arg.a_type, &op),
+                          rocblas_status_invalid_size);
+    CHECK_ROCBLAS_ERROR(rocblas_trsm_operator_create(
+        handle, L, LO, N, NU, m, dA, lda, arg.a_type, &op));
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_operator_apply(handle, op, m + 1, n, &alpha, dB, ldb),
+                          rocblas_status_invalid_size);
+    for(int i = 0; i < 2; ++i)
+    {
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_operator_apply(handle, op, m, n, &alpha, dB, ldb));
+        CHECK_HIP_ERROR(h_result.transfer_from(dB));
+        check();
+    }
+    CHECK_ROCBLAS_ERROR(rocblas_trsm_operator_destroy(op));
+}
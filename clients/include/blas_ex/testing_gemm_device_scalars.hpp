@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// Gemm with alpha and beta on the device gives the same results as with alpha and beta on the
+// host, including the special cases of alpha == 0, where A*B is not used, and beta == 0, where C
+// is not used. The values are small integers, so that the results are exact in every precision.
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_device_scalars(const Arguments& arg)
+{
+    const rocblas_operation N = rocblas_operation_none, TR = rocblas_operation_transpose;
+    const rocblas_int       m = 64, n = 40, k = 32, batch_count = 2;
+    const rocblas_stride    stride_a = rocblas_stride(m) * k, stride_b = rocblas_stride(k) * n,
+                         stride_c = rocblas_stride(m) * n;
+
+    rocblas_local_handle handle{arg};
+
+    host_vector<Ti> hA(stride_a * batch_count), hB(stride_b * batch_count);
+    host_vector<To> hC(stride_c * batch_count), h_gold(stride_c * batch_count),
+        h_result(stride_c * batch_count);
+
+    // Fills A, B and C with small integers, or with a single value for A and B
+    auto init = [&](float a_value, float b_value) {
+        for(size_t i = 0; i < hA.size(); ++i)
+            hA[i] = Ti(a_value ? a_value : float(rocblas_int(i % 5) - 2));
+        for(size_t i = 0; i < hB.size(); ++i)
+            hB[i] = Ti(b_value ? b_value : float(rocblas_int(i % 3) - 1));
+        for(size_t i = 0; i < hC.size(); ++i)
+            hC[i] = To(float(rocblas_int(i % 7) - 3));
+    };
+
+    device_vector<Ti>       dA(hA.size()), dB(hB.size());
+    device_vector<To>       dC(hC.size());
+    device_vector<Tc>       d_scalars(2);
+    device_batch_vector<Ti> dA_batch(stride_a, 1, batch_count), dB_batch(stride_b, 1, batch_count);
+    device_batch_vector<To> dC_batch(stride_c, 1, batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scalars.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_batch.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_batch.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_batch.memcheck());
+
+    // Runs gemm with alpha and beta in the given pointer mode, returning D in h_out
+    auto run = [&](rocblas_pointer_mode mode,
+                   rocblas_operation    trans_b,
+                   rocblas_int          kk,
+                   Tc                   alpha,
+                   Tc                   beta,
+                   bool                 batched,
+                   host_vector<To>&     h_out) {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, mode));
+        host_vector<Tc> h_scalars(2);
+        h_scalars[0] = alpha;
+        h_scalars[1] = beta;
+        CHECK_HIP_ERROR(d_scalars.transfer_from(h_scalars));
+        const Tc*   p_alpha = mode == rocblas_pointer_mode_host ? &alpha : d_scalars + 0;
+        const Tc*   p_beta  = mode == rocblas_pointer_mode_host ? &beta : d_scalars + 1;
+        rocblas_int ldb     = trans_b == N ? k : n;
+
+        if(batched)
+        {
+            for(rocblas_int b = 0; b < batch_count; ++b)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dA_batch[b], hA + b * stride_a, stride_a * sizeof(Ti), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dB_batch[b], hB + b * stride_b, stride_b * sizeof(Ti), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dC_batch[b], hC + b * stride_c, stride_c * sizeof(To), hipMemcpyHostToDevice));
+            }
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_batched_ex(handle,
+                                                        N,
+                                                        trans_b,
+                                                        m,
+                                                        n,
+                                                        kk,
+                                                        p_alpha,
+                                                        dA_batch.ptr_on_device(),
+                                                        arg.a_type,
+                                                        m,
+                                                        dB_batch.ptr_on_device(),
+                                                        arg.b_type,
+                                                        ldb,
+                                                        p_beta,
+                                                        dC_batch.ptr_on_device(),
+                                                        arg.c_type,
+                                                        m,
+                                                        dC_batch.ptr_on_device(),
+                                                        arg.d_type,
+                                                        m,
+                                                        batch_count,
+                                                        arg.compute_type,
+                                                        rocblas_gemm_algo_standard,
+                                                        0,
+                                                        rocblas_gemm_flags_none));
+            for(rocblas_int b = 0; b < batch_count; ++b)
+                CHECK_HIP_ERROR(hipMemcpy(h_out + b * stride_c,
+                                          dC_batch[b],
+                                          stride_c * sizeof(To),
+                                          hipMemcpyDeviceToHost));
+        }
+        else
+        {
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex(handle,
+                                                                N,
+                                                                trans_b,
+                                                                m,
+                                                                n,
+                                                                kk,
+                                                                p_alpha,
+                                                                dA,
+                                                                arg.a_type,
+                                                                m,
+                                                                stride_a,
+                                                                dB,
+                                                                arg.b_type,
+                                                                ldb,
+                                                                stride_b,
+                                                                p_beta,
+                                                                dC,
+                                                                arg.c_type,
+                                                                m,
+                                                                stride_c,
+                                                                dC,
+                                                                arg.d_type,
+                                                                m,
+                                                                stride_c,
+                                                                batch_count,
+                                                                arg.compute_type,
+                                                                rocblas_gemm_algo_standard,
+                                                                0,
+                                                                rocblas_gemm_flags_none));
+            CHECK_HIP_ERROR(h_out.transfer_from(dC));
+        }
+    };
+
+    struct
+    {
+        float alpha, beta;
+        bool  nan_a, nan_c;
+    } cases[] = {{2, 3, false, false},
+                 {0, 1, true, false},
+                 {0, 0, true, true},
+                 {1, 0, false, true},
+                 {-1, 1, false, false}};
+
+    auto check = [&](size_t limit) {
+        init(0, 0);
+        for(auto c : cases)
+            for(bool batched : {false, true})
+                for(auto trans_b : {N, TR})
+                    for(rocblas_int kk : {k, 0})
+                    {
+                        SCOPED_TRACE(testing::Message()
+                                     << "alpha=" << c.alpha << " beta=" << c.beta
+                                     << " batched=" << batched << " k=" << kk
+                                     << " memory=" << limit);
+                        hA[0] = c.nan_a ? Ti(rocblas_nan_rng()) : Ti(-2.0f);
+                        hC[0] = c.nan_c ? To(rocblas_nan_rng()) : To(-3.0f);
+                        run(rocblas_pointer_mode_host,
+                            trans_b,
+                            kk,
+                            Tc(c.alpha),
+                            Tc(c.beta),
+                            batched,
+                            h_gold);
+                        run(rocblas_pointer_mode_device,
+                            trans_b,
+                            kk,
+                            Tc(c.alpha),
+                            Tc(c.beta),
+                            batched,
+                            h_result);
+                        unit_check_general<To>(m, n, m, stride_c, h_gold, h_result, batch_count);
+                    }
+
+        // When the compute type is wider than the output type, A*B may be out of the range of
+        // the output type, as long as alpha*A*B is not. With 64 in every element of A and B,
+        // A*B is 131072, which is larger than the largest half, but alpha*A*B is 32768.
+        if(!std::is_same<Tc, To>{})
+        {
+            init(64, 64);
+            host_vector<To> h_expected(h_gold.size());
+            for(auto& d : h_expected)
+                d = To(32768.0f);
+            for(bool batched : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "batched=" << batched << " memory=" << limit);
+                run(rocblas_pointer_mode_host, N, k, Tc(0.25f), Tc(0), batched, h_gold);
+                run(rocblas_pointer_mode_device, N, k, Tc(0.25f), Tc(0), batched, h_result);
+                unit_check_general<To>(m, n, m, stride_c, h_expected, h_gold, batch_count);
+                unit_check_general<To>(m, n, m, stride_c, h_expected, h_result, batch_count);
+            }
+        }
+    };
+    check(0);
+
+    // Size queries in device pointer mode include the product A*B of all of the batch, which
+    // then fits in the queried size of device memory
+    size_t size;
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(rocblas_gemm_strided_batched_ex(handle,
+                                                      N,
+                                                      N,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      d_scalars + 0,
+                                                      dA,
+                                                      arg.a_type,
+                                                      m,
+                                                      stride_a,
+                                                      dB,
+                                                      arg.b_type,
+                                                      k,
+                                                      stride_b,
+                                                      d_scalars + 1,
+                                                      dC,
+                                                      arg.c_type,
+                                                      m,
+                                                      stride_c,
+                                                      dC,
+                                                      arg.d_type,
+                                                      m,
+                                                      stride_c,
+                                                      batch_count,
+                                                      arg.compute_type,
+                                                      rocblas_gemm_algo_standard,
+                                                      0,
+                                                      rocblas_gemm_flags_none));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    EXPECT_GE(size, size_t(stride_c) * batch_count * sizeof(Tc));
+    CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    check(size);
+
+    // With too little device memory for the product, alpha and beta are copied to the host
+    size_t limit = 4096;
+    CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, limit));
+    check(limit);
+}
@@ -0,0 +1,257 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_grouped_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_operation trans = rocblas_operation_none;
+    const rocblas_int       size = 16, group_size = 1;
+    const Tc                alpha = 1, beta = 0;
+
+    rocblas_local_handle handle{arg};
+
+    device_batch_vector<Ti> dA(size * size, 1, group_size);
+    device_batch_vector<Ti> dB(size * size, 1, group_size);
+    device_batch_vector<To> dC(size * size, 1, group_size);
+    device_batch_vector<To> dD(size * size, 1, group_size);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    auto gemm_grouped = [&](rocblas_handle           handle,
+                            rocblas_int              group_count,
+                            const rocblas_operation* trans_a,
+                            const rocblas_int*       dims,
+                            const Tc*                alpha,
+                            const rocblas_int*       group_sizes) {
+        return rocblas_gemm_grouped_ex(handle,
+                                       group_count,
+                                       trans_a,
+                                       &trans,
+                                       dims,
+                                       dims,
+                                       dims,
+                                       alpha,
+                                       dA.ptr_on_device(),
+                                       arg.a_type,
+                                       dims,
+                                       dB.ptr_on_device(),
+                                       arg.b_type,
+                                       dims,
+                                       &beta,
+                                       dC.ptr_on_device(),
+                                       arg.c_type,
+                                       dims,
+                                       dD.ptr_on_device(),
+                                       arg.d_type,
+                                       dims,
+                                       group_sizes,
+                                       arg.compute_type,
+                                       rocblas_gemm_algo_standard,
+                                       0,
+                                       rocblas_gemm_flags_none);
+    };
+
+    EXPECT_ROCBLAS_STATUS(gemm_grouped(nullptr, 1, &trans, &size, &alpha, &group_size),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(gemm_grouped(handle, -1, &trans, &size, &alpha, &group_size),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(gemm_grouped(handle, 1, nullptr, &size, &alpha, &group_size),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(gemm_grouped(handle, 1, &trans, nullptr, &alpha, &group_size),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(gemm_grouped(handle, 1, &trans, &size, nullptr, &group_size),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(gemm_grouped(handle, 1, &trans, &size, &alpha, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // No groups is a quick return, which does not read the arrays
+    CHECK_ROCBLAS_ERROR(gemm_grouped(handle, 0, nullptr, nullptr, nullptr, nullptr));
+}
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_grouped_ex(const Arguments& arg)
+{
+    rocblas_gemm_algo algo = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index(arg.solution_index);
+    uint32_t          flags(arg.flags);
+
+    rocblas_local_handle handle{arg};
+    auto                 transA      = char2rocblas_operation(arg.transA);
+    auto                 transB      = char2rocblas_operation(arg.transB);
+    auto                 M           = arg.M, N = arg.N, K = arg.K;
+    auto                 batch_count = arg.batch_count;
+
+    auto otherA
+        = transA == rocblas_operation_none ? rocblas_operation_transpose : rocblas_operation_none;
+
+    // Groups 0, 2 and 5 have the same arguments, and are computed by one launch over problems
+    // which are not contiguous. Group 1 differs in the transpose of A, group 3 in alpha unless
+    // alpha is 0, and group 4 in its sizes.
+    const rocblas_int group_count  = 6;
+    rocblas_operation trans_a[]    = {transA, otherA, transA, transA, transA, transA};
+    rocblas_operation trans_b[]    = {transB, transB, transB, transB, transB, transB};
+    rocblas_int       m[]          = {M, M, M, M, M + 3, M};
+    rocblas_int       n[]          = {N, N, N, N, N + 1, N};
+    rocblas_int       k[]          = {K, K, K, K, K + 5, K};
+    rocblas_int       group_size[] = {batch_count, 2, batch_count, 1, 2, 1};
+    rocblas_int       lda[group_count], ldb[group_count], ldc[group_count], ldd[group_count];
+
+    // Row and column counts of A and B in each group
+    rocblas_int A_row[group_count], A_col[group_count], B_row[group_count], B_col[group_count];
+
+    host_vector<Tc> h_alpha(group_count), h_beta(group_count);
+    for(rocblas_int g = 0; g < group_count; ++g)
+    {
+        A_row[g]   = trans_a[g] == rocblas_operation_none ? m[g] : k[g];
+        A_col[g]   = trans_a[g] == rocblas_operation_none ? k[g] : m[g];
+        B_row[g]   = trans_b[g] == rocblas_operation_none ? k[g] : n[g];
+        B_col[g]   = trans_b[g] == rocblas_operation_none ? n[g] : k[g];
+        lda[g]     = std::max(arg.lda, A_row[g]);
+        ldb[g]     = std::max(arg.ldb, B_row[g]);
+        ldc[g]     = std::max(arg.ldc, m[g]);
+        ldd[g]     = std::max(arg.ldd, m[g]);
+        h_alpha[g] = arg.get_alpha<Tc>();
+        h_beta[g]  = arg.get_beta<Tc>();
+    }
+    h_alpha[3] = Tc(0);
+
+    // The problems of each group follow those of the previous group in the arrays of pointers
+    std::vector<rocblas_int> group_of;
+    size_t                   size_a = 0, size_b = 0, size_c = 0, size_d = 0;
+    for(rocblas_int g = 0; g < group_count; ++g)
+    {
+        group_of.insert(group_of.end(), group_size[g], g);
+        size_a = std::max(size_a, size_t(lda[g]) * A_col[g]);
+        size_b = std::max(size_b, size_t(ldb[g]) * B_col[g]);
+        size_c = std::max(size_c, size_t(ldc[g]) * n[g]);
+        size_d = std::max(size_d, size_t(ldd[g]) * n[g]);
+    }
+    rocblas_int problems = rocblas_int(group_of.size());
+
+    device_batch_vector<Ti> dA(size_a, 1, problems);
+    device_batch_vector<Ti> dB(size_b, 1, problems);
+    device_batch_vector<To> dC(size_c, 1, problems);
+    device_batch_vector<To> dD(size_d, 1, problems);
+    device_vector<Tc>       d_alpha(group_count);
+    device_vector<Tc>       d_beta(group_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    using To_hpa = std::conditional_t<std::is_same<To, rocblas_bfloat16>{}, float, To>;
+    host_batch_vector<Ti>     hA(size_a, 1, problems);
+    host_batch_vector<Ti>     hB(size_b, 1, problems);
+    host_batch_vector<To>     hC(size_c, 1, problems);
+    host_batch_vector<To>     hD_1(size_d, 1, problems);
+    host_batch_vector<To>     hD_2(size_d, 1, problems);
+    host_batch_vector<To_hpa> hD_gold(size_d, 1, problems);
+
+    rocblas_seedrand();
+    for(rocblas_int p = 0; p < problems; ++p)
+    {
+        rocblas_int g = group_of[p];
+        rocblas_init<Ti>(hA[p], A_row[g], A_col[g], lda[g]);
+        rocblas_init_alternating_sign<Ti>(hB[p], B_row[g], B_col[g], ldb[g]);
+        rocblas_init<To>(hC[p], m[g], n[g], ldc[g]);
+        rocblas_init_nan<To>(hD_1[p], m[g], n[g], ldd[g]);
+    }
+    hD_2.copy_from(hD_1);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+
+    auto gemm_grouped = [&](const Tc* alpha, const Tc* beta) {
+        return rocblas_gemm_grouped_ex(handle,
+                                       group_count,
+                                       trans_a,
+                                       trans_b,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       dA.ptr_on_device(),
+                                       arg.a_type,
+                                       lda,
+                                       dB.ptr_on_device(),
+                                       arg.b_type,
+                                       ldb,
+                                       beta,
+                                       dC.ptr_on_device(),
+                                       arg.c_type,
+                                       ldc,
+                                       dD.ptr_on_device(),
+                                       arg.d_type,
+                                       ldd,
+                                       group_size,
+                                       arg.compute_type,
+                                       algo,
+                                       solution_index,
+                                       flags);
+    };
+
+    // ROCBLAS rocblas_pointer_mode_host
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_HIP_ERROR(dD.transfer_from(hD_1));
+    CHECK_ROCBLAS_ERROR(gemm_grouped(h_alpha, h_beta));
+    CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+
+    // ROCBLAS rocblas_pointer_mode_device
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_HIP_ERROR(dD.transfer_from(hD_2));
+    CHECK_ROCBLAS_ERROR(gemm_grouped(d_alpha, d_beta));
+    CHECK_HIP_ERROR(hD_2.transfer_from(dD));
+
+    // CPU BLAS, computing each problem with the arguments of its group
+    for(rocblas_int p = 0; p < problems; ++p)
+    {
+        rocblas_int g = group_of[p];
+        for(rocblas_int j = 0; j < n[g]; ++j)
+            for(rocblas_int i = 0; i < m[g]; ++i)
+                hD_gold[p][i + j * size_t(ldd[g])] = hC[p][i + j * size_t(ldc[g])];
+
+        cblas_gemm<Ti, To_hpa>(trans_a[g],
+                               trans_b[g],
+                               m[g],
+                               n[g],
+                               k[g],
+                               h_alpha[g],
+                               hA[p],
+                               lda[g],
+                               hB[p],
+                               ldb[g],
+                               h_beta[g],
+                               hD_gold[p],
+                               ldd[g]);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<To, To_hpa>(m[g], n[g], ldd[g], hD_gold[p], hD_1[p]);
+            unit_check_general<To, To_hpa>(m[g], n[g], ldd[g], hD_gold[p], hD_2[p]);
+        }
+    }
+}
@@ -8,6 +8,85 @@
 #include "rocblas_init.hpp"
 #include "rocblas_test.hpp"
 #include <cinttypes>
+#include <map>
+
+/* ============================================================================================ */
+/*! \brief  Cache of device allocations. When enabled, freed device vectors are kept and reused
+ *          by later device vectors of the same or smaller size, so that rocblas-bench can run many
+ *          problems without allocating and freeing device memory for each one. */
+class d_vector_cache
+{
+    bool                         enabled = false;
+    std::multimap<size_t, void*> free_blocks; // Blocks which are not in use, by size
+    std::map<void*, size_t>      used_blocks; // Blocks which are in use, with their size
+
+    static d_vector_cache& get()
+    {
+        static d_vector_cache cache;
+        return cache;
+    }
+
+public:
+    static void enable(bool enabled)
+    {
+        get().enabled = enabled;
+        if(!enabled)
+            clear();
+    }
+
+    // Free the cached blocks which are not in use
+    static void clear()
+    {
+        auto& cache = get();
+        for(auto& block : cache.free_blocks)
+            (hipFree)(block.second);
+        cache.free_blocks.clear();
+    }
+
+    // Allocate from the smallest cached block which is large enough, or else from HIP
+    static hipError_t allocate(void** ptr, size_t bytes)
+    {
+        auto& cache = get();
+        if(!cache.enabled)
+            return (hipMalloc)(ptr, bytes);
+
+        auto block = cache.free_blocks.lower_bound(bytes);
+        if(block != cache.free_blocks.end())
+        {
+            *ptr = block->second;
+            cache.used_blocks.emplace(block->second, block->first);
+            cache.free_blocks.erase(block);
+            return hipSuccess;
+        }
+
+        // If HIP runs out of memory, release the cached blocks and try again
+        hipError_t status = (hipMalloc)(ptr, bytes);
+        if(status != hipSuccess && !cache.free_blocks.empty())
+        {
+            clear();
+            status = (hipMalloc)(ptr, bytes);
+        }
+        if(status == hipSuccess)
+            cache.used_blocks.emplace(*ptr, bytes);
+        return status;
+    }
+
+    // Return a block to the cache, or free it if it was not allocated from the cache
+    static hipError_t deallocate(void* ptr)
+    {
+        auto& cache = get();
+        auto  block = cache.used_blocks.find(ptr);
+        if(block == cache.used_blocks.end())
+            return (hipFree)(ptr);
+
+        if(cache.enabled)
+            cache.free_blocks.emplace(block->second, ptr);
+        else
+            (hipFree)(ptr);
+        cache.used_blocks.erase(block);
+        return hipSuccess;
+    }
+};
 
 /* ============================================================================================ */
 /*! \brief  base-class to allocate/deallocate device memory */
@@ -51,7 +130,8 @@ protected:
     T* device_vector_setup()
     {
         T* d;
-        if(use_HMM ? hipMallocManaged(&d, bytes) : (hipMalloc)(&d, bytes) != hipSuccess)
+        if((use_HMM ? hipMallocManaged(&d, bytes) : d_vector_cache::allocate((void**)&d, bytes))
+           != hipSuccess)
         {
             rocblas_cerr << "Error allocating " << bytes << " bytes (" << (bytes >> 30) << " GB)"
                          << std::endl;
@@ -128,7 +208,7 @@ protected:
             }
 #endif
             // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            CHECK_HIP_ERROR(use_HMM ? (hipFree)(d) : d_vector_cache::deallocate(d));
         }
     }
 };
@@ -10,9 +10,12 @@
 #include "rocblas.h"
 #include "rocblas_vector.hpp"
 #include "utility.hpp"
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <limits>
 #include <memory>
+#include <vector>
 
 /* =====================================================================
         Norm check: norm(A-B)/norm(A), evaluate relative error
@@ -141,39 +144,124 @@ void m_axpy(size_t* N, T* alpha, T* x, int* incx, T* y, int* incy)
 /* ============== Norm Check for General Matrix ============= */
 /*! \brief compare the norm error of two matrices hCPU & hGPU */
 
-// Real
-template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
-double norm_check_general(
-    char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, T* hCPU, T* hGPU)
+// Single-pass norm(hGPU - hCPU) / norm(hCPU) for real matrices. Elements are converted to
+// double as they are read, instead of copying both matrices, and columns are processed in parallel.
+template <typename TC, typename TG>
+double norm_check_general_real(
+    char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, const TC& hCPU, const TG& hGPU)
 {
-    // norm type can be 'O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
+    // norm type can be 'O', 'I', 'F', 'M' (and lowercase) for one, infinity, Frobenius or max norm
     // one norm is max column sum
     // infinity norm is max row sum
     // Frobenius is l2 norm of matrix entries
-    size_t size = N * (size_t)lda;
+    // max norm is the largest absolute value
 
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
+    // Like LAPACK, a NaN is propagated through the maximum
+    auto larger = [](double a, double b) { return a < b || b != b ? b : a; };
 
-    for(rocblas_int i = 0; i < N; i++)
+    double cpu_norm = 0, err_norm = 0;
+    if(M <= 0 || N <= 0)
+        return 0;
+
+    switch(norm_type)
     {
-        for(rocblas_int j = 0; j < M; j++)
+    case 'O':
+    case 'o':
+    case '1':
+    case 'M':
+    case 'm':
+    {
+        bool                max_norm = norm_type == 'M' || norm_type == 'm';
+        std::vector<double> cpu_col(N), err_col(N);
+
+#pragma omp parallel for
+        for(rocblas_int j = 0; j < N; j++)
         {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(hCPU[idx]);
-            hGPU_double[idx] = double(hGPU[idx]);
+            double cpu = 0, err = 0;
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                size_t idx = i + j * size_t(lda);
+                double c   = double(hCPU[idx]);
+                double d   = std::abs(double(hGPU[idx]) - c);
+                c          = std::abs(c);
+                cpu        = max_norm ? larger(cpu, c) : cpu + c;
+                err        = max_norm ? larger(err, d) : err + d;
+            }
+            cpu_col[j] = cpu;
+            err_col[j] = err;
+        }
+
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            cpu_norm = larger(cpu_norm, cpu_col[j]);
+            err_norm = larger(err_norm, err_col[j]);
         }
+        break;
     }
 
-    double      work[1];
-    rocblas_int incx  = 1;
-    double      alpha = -1.0;
+    case 'I':
+    case 'i':
+    {
+        // Rows are split into blocks, so that each block is read column by column
+        constexpr rocblas_int ROW_BLOCK = 256;
+        std::vector<double>   cpu_row(M), err_row(M);
 
-    double cpu_norm = xlange(&norm_type, &M, &N, hCPU_double.data(), &lda, work);
-    m_axpy(&size, &alpha, hCPU_double.data(), &incx, hGPU_double.data(), &incx);
-    double error = xlange(&norm_type, &M, &N, hGPU_double.data(), &lda, work) / cpu_norm;
+#pragma omp parallel for
+        for(rocblas_int i0 = 0; i0 < M; i0 += ROW_BLOCK)
+        {
+            rocblas_int i1 = std::min(M, i0 + ROW_BLOCK);
+            for(rocblas_int j = 0; j < N; j++)
+            {
+                for(rocblas_int i = i0; i < i1; i++)
+                {
+                    size_t idx = i + j * size_t(lda);
+                    double c   = double(hCPU[idx]);
+                    cpu_row[i] += std::abs(c);
+                    err_row[i] += std::abs(double(hGPU[idx]) - c);
+                }
+            }
+        }
 
-    return error;
+        for(rocblas_int i = 0; i < M; i++)
+        {
+            cpu_norm = larger(cpu_norm, cpu_row[i]);
+            err_norm = larger(err_norm, err_row[i]);
+        }
+        break;
+    }
+
+    default: // 'F', 'f', 'E', 'e'
+    {
+        double cpu_ss = 0, err_ss = 0;
+
+#pragma omp parallel for reduction(+ : cpu_ss, err_ss)
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                size_t idx = i + j * size_t(lda);
+                double c   = double(hCPU[idx]);
+                double d   = double(hGPU[idx]) - c;
+                cpu_ss += c * c;
+                err_ss += d * d;
+            }
+        }
+
+        cpu_norm = std::sqrt(cpu_ss);
+        err_norm = std::sqrt(err_ss);
+        break;
+    }
+    }
+
+    return err_norm / cpu_norm;
+}
+
+// Real
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+double norm_check_general(
+    char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, T* hCPU, T* hGPU)
+{
+    return norm_check_general_real(norm_type, M, N, lda, hCPU, hGPU);
 }
 
 // Complex
@@ -198,7 +286,7 @@ double norm_check_general(
     return error;
 }
 
-// For BF16 and half, we convert the results to double first
+// For BF16 and half, the results are converted to double as they are read
 template <typename T,
           typename VEC,
           std::enable_if_t<std::is_same<T, rocblas_half>{} || std::is_same<T, rocblas_bfloat16>{},
@@ -206,21 +294,7 @@ template <typename T,
 double norm_check_general(
     char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, VEC&& hCPU, T* hGPU)
 {
-    size_t              size = N * (size_t)lda;
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
-
-    for(rocblas_int i = 0; i < N; i++)
-    {
-        for(rocblas_int j = 0; j < M; j++)
-        {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = hCPU[idx];
-            hGPU_double[idx] = hGPU[idx];
-        }
-    }
-
-    return norm_check_general<double>(norm_type, M, N, lda, hCPU_double, hGPU_double);
+    return norm_check_general_real(norm_type, M, N, lda, hCPU, hGPU);
 }
 
 /* ============== Norm Check for strided_batched case ============= */
@@ -492,6 +492,24 @@ MAP2CF(rocblas_iamin_strided_batched, double, rocblas_idamin_strided_batched);
 MAP2CF(rocblas_iamin_strided_batched, rocblas_float_complex, rocblas_icamin_strided_batched);
 MAP2CF(rocblas_iamin_strided_batched, rocblas_double_complex, rocblas_izamin_strided_batched);
 
+// vector_stats
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_vector_stats)(rocblas_handle handle,
+                                              rocblas_int    n,
+                                              const T*       x,
+                                              rocblas_int    incx,
+                                              const T*       y,
+                                              rocblas_int    incy,
+                                              real_t<T>*     nrm2,
+                                              real_t<T>*     asum,
+                                              rocblas_int*   amax,
+                                              T*             dot);
+
+MAP2CF(rocblas_vector_stats, float, rocblas_svector_stats);
+MAP2CF(rocblas_vector_stats, double, rocblas_dvector_stats);
+MAP2CF(rocblas_vector_stats, rocblas_float_complex, rocblas_cvector_stats);
+MAP2CF(rocblas_vector_stats, rocblas_double_complex, rocblas_zvector_stats);
+
 // axpy
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_axpy)(rocblas_handle handle,
@@ -2179,6 +2197,28 @@ MAP2CF(rocblas_gemm, rocblas_half, rocblas_hgemm);
 MAP2CF(rocblas_gemm, rocblas_float_complex, rocblas_cgemm);
 MAP2CF(rocblas_gemm, rocblas_double_complex, rocblas_zgemm);
 
+// gemm_ooc
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_gemm_ooc)(rocblas_handle    handle,
+                                          rocblas_operation transA,
+                                          rocblas_operation transB,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const T*          B,
+                                          rocblas_int       ldb,
+                                          const T*          beta,
+                                          T*                C,
+                                          rocblas_int       ldc);
+
+MAP2CF(rocblas_gemm_ooc, float, rocblas_sgemm_ooc);
+MAP2CF(rocblas_gemm_ooc, double, rocblas_dgemm_ooc);
+MAP2CF(rocblas_gemm_ooc, rocblas_float_complex, rocblas_cgemm_ooc);
+MAP2CF(rocblas_gemm_ooc, rocblas_double_complex, rocblas_zgemm_ooc);
+
 // gemm_batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_gemm_batched)(rocblas_handle    handle,
@@ -2248,6 +2248,87 @@ module rocblas_interface
         return
     end function rocblas_izamin_strided_batched_fortran
 
+    ! vector_stats
+    function rocblas_svector_stats_fortran(handle, n, x, incx, y, incy, nrm2, asum, amax, dot) &
+            result(res) &
+            bind(c, name = 'rocblas_svector_stats_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: nrm2
+        type(c_ptr), value :: asum
+        type(c_ptr), value :: amax
+        type(c_ptr), value :: dot
+        integer(c_int) :: res
+        res = rocblas_svector_stats(handle, n, x, incx, y, incy, nrm2, asum, amax, dot)
+        return
+    end function rocblas_svector_stats_fortran
+
+    function rocblas_dvector_stats_fortran(handle, n, x, incx, y, incy, nrm2, asum, amax, dot) &
+            result(res) &
+            bind(c, name = 'rocblas_dvector_stats_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: nrm2
+        type(c_ptr), value :: asum
+        type(c_ptr), value :: amax
+        type(c_ptr), value :: dot
+        integer(c_int) :: res
+        res = rocblas_dvector_stats(handle, n, x, incx, y, incy, nrm2, asum, amax, dot)
+        return
+    end function rocblas_dvector_stats_fortran
+
+    function rocblas_cvector_stats_fortran(handle, n, x, incx, y, incy, nrm2, asum, amax, dot) &
+            result(res) &
+            bind(c, name = 'rocblas_cvector_stats_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: nrm2
+        type(c_ptr), value :: asum
+        type(c_ptr), value :: amax
+        type(c_ptr), value :: dot
+        integer(c_int) :: res
+        res = rocblas_cvector_stats(handle, n, x, incx, y, incy, nrm2, asum, amax, dot)
+        return
+    end function rocblas_cvector_stats_fortran
+
+    function rocblas_zvector_stats_fortran(handle, n, x, incx, y, incy, nrm2, asum, amax, dot) &
+            result(res) &
+            bind(c, name = 'rocblas_zvector_stats_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: nrm2
+        type(c_ptr), value :: asum
+        type(c_ptr), value :: amax
+        type(c_ptr), value :: dot
+        integer(c_int) :: res
+        res = rocblas_zvector_stats(handle, n, x, incx, y, incy, nrm2, asum, amax, dot)
+        return
+    end function rocblas_zvector_stats_fortran
+
     ! rot
     function rocblas_srot_fortran(handle, n, x, incx, y, incy, c, s) &
             result(res) &
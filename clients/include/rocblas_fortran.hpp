@@ -1030,6 +1030,51 @@ rocblas_status rocblas_izamin_strided_batched_fortran(rocblas_handle
                                                       rocblas_int                   batch_count,
                                                       rocblas_int*                  result);
 
+// vector_stats
+rocblas_status rocblas_svector_stats_fortran(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const float*   x,
+                                             rocblas_int    incx,
+                                             const float*   y,
+                                             rocblas_int    incy,
+                                             float*         nrm2,
+                                             float*         asum,
+                                             rocblas_int*   amax,
+                                             float*         dot);
+
+rocblas_status rocblas_dvector_stats_fortran(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const double*  x,
+                                             rocblas_int    incx,
+                                             const double*  y,
+                                             rocblas_int    incy,
+                                             double*        nrm2,
+                                             double*        asum,
+                                             rocblas_int*   amax,
+                                             double*        dot);
+
+rocblas_status rocblas_cvector_stats_fortran(rocblas_handle               handle,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             const rocblas_float_complex* y,
+                                             rocblas_int                  incy,
+                                             float*                       nrm2,
+                                             float*                       asum,
+                                             rocblas_int*                 amax,
+                                             rocblas_float_complex*       dot);
+
+rocblas_status rocblas_zvector_stats_fortran(rocblas_handle                handle,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             const rocblas_double_complex* y,
+                                             rocblas_int                   incy,
+                                             double*                       nrm2,
+                                             double*                       asum,
+                                             rocblas_int*                  amax,
+                                             rocblas_double_complex*       dot);
+
 // rot
 rocblas_status rocblas_srot_fortran(rocblas_handle handle,
                                     rocblas_int    n,
@@ -5879,6 +5924,67 @@ rocblas_status rocblas_zgemm_fortran(rocblas_handle                handle,
                                      rocblas_double_complex*       C,
                                      rocblas_int                   ldc);
 
+// gemm_ooc
+rocblas_status rocblas_sgemm_ooc_fortran(rocblas_handle    handle,
+                                         rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const float*      alpha,
+                                         const float*      A,
+                                         rocblas_int       lda,
+                                         const float*      B,
+                                         rocblas_int       ldb,
+                                         const float*      beta,
+                                         float*            C,
+                                         rocblas_int       ldc);
+
+rocblas_status rocblas_dgemm_ooc_fortran(rocblas_handle    handle,
+                                         rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const double*     alpha,
+                                         const double*     A,
+                                         rocblas_int       lda,
+                                         const double*     B,
+                                         rocblas_int       ldb,
+                                         const double*     beta,
+                                         double*           C,
+                                         rocblas_int       ldc);
+
+rocblas_status rocblas_cgemm_ooc_fortran(rocblas_handle               handle,
+                                         rocblas_operation            transA,
+                                         rocblas_operation            transB,
+                                         rocblas_int                  m,
+                                         rocblas_int                  n,
+                                         rocblas_int                  k,
+                                         const rocblas_float_complex* alpha,
+                                         const rocblas_float_complex* A,
+                                         rocblas_int                  lda,
+                                         const rocblas_float_complex* B,
+                                         rocblas_int                  ldb,
+                                         const rocblas_float_complex* beta,
+                                         rocblas_float_complex*       C,
+                                         rocblas_int                  ldc);
+
+rocblas_status rocblas_zgemm_ooc_fortran(rocblas_handle                handle,
+                                         rocblas_operation             transA,
+                                         rocblas_operation             transB,
+                                         rocblas_int                   m,
+                                         rocblas_int                   n,
+                                         rocblas_int                   k,
+                                         const rocblas_double_complex* alpha,
+                                         const rocblas_double_complex* A,
+                                         rocblas_int                   lda,
+                                         const rocblas_double_complex* B,
+                                         rocblas_int                   ldb,
+                                         const rocblas_double_complex* beta,
+                                         rocblas_double_complex*       C,
+                                         rocblas_int                   ldc);
+
 // gemm_batched
 rocblas_status rocblas_sgemm_batched_fortran(rocblas_handle     handle,
                                              rocblas_operation  transA,
@@ -169,6 +169,111 @@ module rocblas_interface_tensile
             A, lda, B, ldb, beta, C, ldc)
     end function rocblas_zgemm_fortran
 
+    ! gemm_ooc
+    function rocblas_sgemm_ooc_fortran(handle, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc) &
+            result(res) &
+            bind(c, name = 'rocblas_sgemm_ooc_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int) :: res
+        res = rocblas_sgemm_ooc(handle, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc)
+    end function rocblas_sgemm_ooc_fortran
+
+    function rocblas_dgemm_ooc_fortran(handle, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc) &
+            result(res) &
+            bind(c, name = 'rocblas_dgemm_ooc_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int) :: res
+        res = rocblas_dgemm_ooc(handle, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc)
+    end function rocblas_dgemm_ooc_fortran
+
+    function rocblas_cgemm_ooc_fortran(handle, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc) &
+            result(res) &
+            bind(c, name = 'rocblas_cgemm_ooc_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int) :: res
+        res = rocblas_cgemm_ooc(handle, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc)
+    end function rocblas_cgemm_ooc_fortran
+
+    function rocblas_zgemm_ooc_fortran(handle, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc) &
+            result(res) &
+            bind(c, name = 'rocblas_zgemm_ooc_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int) :: res
+        res = rocblas_zgemm_ooc(handle, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc)
+    end function rocblas_zgemm_ooc_fortran
+
     ! gemm_batched
     function rocblas_hgemm_batched_fortran(handle, transA, transB, m, n, k, alpha, &
             A, lda, B, ldb, beta, C, ldc, batch_count) &
@@ -16,36 +16,44 @@
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX, lda=incx);
 // for complex number, the real/imag part would be initialized with the same value
+//
+// Random values come from rocblas_philox_rng, so each element is a function of only the key and
+// its (batch, i, j) position. Matrices are then filled column by column, and large ones in
+// parallel, with the same results for any number of threads.
+
+// Minimum number of elements for which matrices are initialized in parallel
+constexpr size_t rocblas_init_parallel_min = 1 << 16;
 
 // Initialize vector with random values
 template <typename T>
-void rocblas_init(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+inline void
+    rocblas_init(T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    rocblas_philox_rng rng;
+
+#pragma omp parallel for collapse(2) if(M * N * batch_count >= rocblas_init_parallel_min)
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_generator<T>();
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i < M; ++i)
+                A[i + j * lda + i_batch * stride] = random_generator<T>(rng, i_batch, i, j);
 }
 
 // Initialize vector with random values
 template <typename T>
-inline void
-    rocblas_init(T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+void rocblas_init(
+    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_generator<T>();
+    rocblas_init(A.data(), M, N, lda, stride, batch_count);
 }
 
 template <typename T>
 void rocblas_init_sin(
     std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+#pragma omp parallel for collapse(2) if(M * N * batch_count >= rocblas_init_parallel_min)
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i < M; ++i)
                 A[i + j * lda + i_batch * stride] = sin(i + j * lda + i_batch * stride);
 }
 
@@ -58,72 +66,66 @@ void rocblas_init_sin(
 // mantissa 10 bits.
 template <typename T>
 void rocblas_init_alternating_sign(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+    T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    rocblas_philox_rng rng;
+
+#pragma omp parallel for collapse(2) if(M * N * batch_count >= rocblas_init_parallel_min)
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i < M; ++i)
             {
-                auto value                        = random_generator<T>();
+                auto value                        = random_generator<T>(rng, i_batch, i, j);
                 A[i + j * lda + i_batch * stride] = (i ^ j) & 1 ? value : negate(value);
             }
 }
 
 template <typename T>
 void rocblas_init_alternating_sign(
-    T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-            {
-                auto value                        = random_generator<T>();
-                A[i + j * lda + i_batch * stride] = (i ^ j) & 1 ? value : negate(value);
-            }
+    rocblas_init_alternating_sign(A.data(), M, N, lda, stride, batch_count);
 }
 
 template <typename T>
 void rocblas_init_cos(
     std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+#pragma omp parallel for collapse(2) if(M * N * batch_count >= rocblas_init_parallel_min)
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i < M; ++i)
                 A[i + j * lda + i_batch * stride] = cos(i + j * lda + i_batch * stride);
 }
 
 /*! \brief  symmetric matrix initialization: */
 // for real matrix only
 template <typename T>
-void rocblas_init_symmetric(std::vector<T>& A, size_t N, size_t lda)
-{
-    for(size_t i = 0; i < N; ++i)
-        for(size_t j = 0; j <= i; ++j)
-        {
-            auto value = random_generator<T>();
-            // Warning: It's undefined behavior to assign to the
-            // same array element twice in same sequence point (i==j)
-            A[j + i * lda] = value;
-            A[i + j * lda] = value;
-        }
-}
-
-/*! \brief  symmetric matrix initialization: */
-template <typename T>
 void rocblas_init_symmetric(T* A, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    rocblas_philox_rng rng;
+
+    // Columns have different lengths, so they are scheduled dynamically
+#pragma omp parallel for collapse(2) schedule(dynamic, 64) \
+    if(N * N * batch_count >= 2 * rocblas_init_parallel_min)
     for(size_t b = 0; b < batch_count; ++b)
-    {
         for(size_t i = 0; i < N; ++i)
             for(size_t j = 0; j <= i; ++j)
             {
-                auto value = random_generator<T>();
+                auto value = random_generator<T>(rng, b, j, i);
                 // Warning: It's undefined behavior to assign to the
                 // same array element twice in same sequence point (i==j)
                 A[b * stride + j + i * lda] = value;
                 A[b * stride + i + j * lda] = value;
             }
-    }
+}
+
+/*! \brief  symmetric matrix initialization: */
+// for real matrix only
+template <typename T>
+void rocblas_init_symmetric(std::vector<T>& A, size_t N, size_t lda)
+{
+    rocblas_init_symmetric(A.data(), N, lda);
 }
 
 /*! \brief  symmetric matrix clear: */
@@ -150,10 +152,13 @@ void rocblas_clear_symmetric(
 template <typename T>
 void rocblas_init_hermitian(std::vector<T>& A, size_t N, size_t lda)
 {
+    rocblas_philox_rng rng;
+
+#pragma omp parallel for schedule(dynamic, 64) if(N * N >= 2 * rocblas_init_parallel_min)
     for(size_t i = 0; i < N; ++i)
         for(size_t j = 0; j <= i; ++j)
         {
-            auto value     = random_generator<T>();
+            auto value     = random_generator<T>(rng, 0, j, i);
             A[j + i * lda] = value;
             value.y        = (i == j) ? 0 : negate(value.y);
             A[i + j * lda] = value;
@@ -165,10 +170,13 @@ template <typename T>
 void rocblas_init_hpl(
     std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    rocblas_philox_rng rng;
+
+#pragma omp parallel for collapse(2) if(M * N * batch_count >= rocblas_init_parallel_min)
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_hpl_generator<T>();
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i < M; ++i)
+                A[i + j * lda + i_batch * stride] = random_hpl_generator<T>(rng, i_batch, i, j);
 }
 
 /* ============================================================================================ */
@@ -6,7 +6,9 @@
 
 #include "rocblas.h"
 #include "rocblas_math.hpp"
+#include <array>
 #include <cinttypes>
+#include <cmath>
 #include <random>
 #include <type_traits>
 
@@ -31,6 +33,73 @@ inline void rocblas_seedrand()
     t_rocblas_rng = get_seed();
 }
 
+/* ============================================================================================ */
+/*! \brief  Counter-based random number generator (Philox4x32-10)
+ *
+ *  Each result is a pure function of the key and of a (batch, i, j) counter, so that matrices
+ *  can be initialized in any order and by any number of threads with the same results.
+ *  The default key is drawn from t_rocblas_rng, so that successive initializations differ,
+ *  and are repeatable after rocblas_seedrand().
+ */
+class rocblas_philox_rng
+{
+    uint32_t key0, key1;
+
+    static void round(std::array<uint32_t, 4>& ctr, uint32_t k0, uint32_t k1)
+    {
+        uint64_t p0 = uint64_t(0xD2511F53) * ctr[0];
+        uint64_t p1 = uint64_t(0xCD9E8D57) * ctr[2];
+        uint32_t c1 = ctr[1], c3 = ctr[3];
+        ctr[0]      = uint32_t(p1 >> 32) ^ c1 ^ k0;
+        ctr[1]      = uint32_t(p1);
+        ctr[2]      = uint32_t(p0 >> 32) ^ c3 ^ k1;
+        ctr[3]      = uint32_t(p0);
+    }
+
+public:
+    using result_type = std::array<uint32_t, 4>;
+
+    explicit rocblas_philox_rng(uint64_t seed)
+        : key0(uint32_t(seed))
+        , key1(uint32_t(seed >> 32))
+    {
+    }
+
+    rocblas_philox_rng()
+        : rocblas_philox_rng(std::uniform_int_distribution<uint64_t>{}(t_rocblas_rng))
+    {
+    }
+
+    // Four random 32-bit words for element (i, j) of matrix batch. The low words of i, j and
+    // batch fill three words of the counter, and their high words share the fourth, so every
+    // element has its own counter while i and j are below 2^43 and batch is below 2^42.
+    result_type operator()(size_t batch, size_t i, size_t j) const
+    {
+        uint64_t    hi  = uint64_t(i) >> 32 | uint64_t(j) >> 32 << 11 | uint64_t(batch) >> 32 << 22;
+        result_type ctr = {uint32_t(i), uint32_t(j), uint32_t(batch), uint32_t(hi)};
+        uint32_t    k0 = key0, k1 = key1;
+        for(int r = 0; r < 10; ++r)
+        {
+            round(ctr, k0, k1);
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        return ctr;
+    }
+
+    // Map a random 32-bit word to an integer in [lo, hi]
+    static int uniform_int(uint32_t u, int lo, int hi)
+    {
+        return lo + int((uint64_t(u) * uint32_t(hi - lo + 1)) >> 32);
+    }
+
+    // Map two random 32-bit words to a double in [0, 1)
+    static double uniform_real(uint32_t u0, uint32_t u1)
+    {
+        return std::ldexp(double((uint64_t(u0) << 21) ^ (u1 >> 11)), -53);
+    }
+};
+
 /* ============================================================================================ */
 /*! \brief  Random number generator which generates NaN values */
 class rocblas_nan_rng
@@ -229,6 +298,72 @@ inline T random_hpl_generator()
     return std::uniform_real_distribution<double>(-0.5, 0.5)(t_rocblas_rng);
 }
 
+/* ============================================================================================ */
+/* generate the random number for element (i, j) of matrix batch, with the same ranges as above: */
+
+/*! \brief  generate a random number in range [1,2,3,4,5,6,7,8,9,10] */
+template <typename T>
+inline T random_generator(const rocblas_philox_rng& rng, size_t batch, size_t i, size_t j)
+{
+    return rocblas_philox_rng::uniform_int(rng(batch, i, j)[0], 1, 10);
+}
+
+template <>
+inline rocblas_float_complex random_generator<rocblas_float_complex>(
+    const rocblas_philox_rng& rng, size_t batch, size_t i, size_t j)
+{
+    auto r = rng(batch, i, j);
+    return {float(rocblas_philox_rng::uniform_int(r[0], 1, 10)),
+            float(rocblas_philox_rng::uniform_int(r[1], 1, 10))};
+}
+
+template <>
+inline rocblas_double_complex random_generator<rocblas_double_complex>(
+    const rocblas_philox_rng& rng, size_t batch, size_t i, size_t j)
+{
+    auto r = rng(batch, i, j);
+    return {double(rocblas_philox_rng::uniform_int(r[0], 1, 10)),
+            double(rocblas_philox_rng::uniform_int(r[1], 1, 10))};
+}
+
+/*! \brief  generate a random number in range [-2,-1,0,1,2] */
+template <>
+inline rocblas_half random_generator<rocblas_half>(const rocblas_philox_rng& rng,
+                                                   size_t                    batch,
+                                                   size_t                    i,
+                                                   size_t                    j)
+{
+    return rocblas_half(rocblas_philox_rng::uniform_int(rng(batch, i, j)[0], -2, 2));
+}
+
+/*! \brief  generate a random number in range [-2,-1,0,1,2] */
+template <>
+inline rocblas_bfloat16 random_generator<rocblas_bfloat16>(const rocblas_philox_rng& rng,
+                                                           size_t                    batch,
+                                                           size_t                    i,
+                                                           size_t                    j)
+{
+    return rocblas_bfloat16(rocblas_philox_rng::uniform_int(rng(batch, i, j)[0], -2, 2));
+}
+
+/*! \brief  generate a random number in range [1,2,3] */
+template <>
+inline int8_t random_generator<int8_t>(const rocblas_philox_rng& rng,
+                                       size_t                    batch,
+                                       size_t                    i,
+                                       size_t                    j)
+{
+    return static_cast<int8_t>(rocblas_philox_rng::uniform_int(rng(batch, i, j)[0], 1, 3));
+}
+
+/*! \brief  generate a random number in HPL-like [-0.5,0.5] doubles  */
+template <typename T>
+inline T random_hpl_generator(const rocblas_philox_rng& rng, size_t batch, size_t i, size_t j)
+{
+    auto r = rng(batch, i, j);
+    return rocblas_philox_rng::uniform_real(r[0], r[1]) - 0.5;
+}
+
 /*! \brief  generate a random ASCII string of up to length n */
 inline std::string random_string(size_t n)
 {
@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../../library/src/include/device_arena.hpp"
+#include "rocblas_test.hpp"
+#include <cstdlib>
+
+// Device memory arenas are tested on the host with a mock backend, which counts its allocations
+struct mock_arena_backend
+{
+    size_t* live; // Number of live allocations
+    bool*   fail; // Whether allocations fail
+
+    bool allocate(void** ptr, size_t size)
+    {
+        if(*fail || !(*ptr = malloc(size)))
+            return false;
+        ++*live;
+        return true;
+    }
+
+    bool deallocate(void* ptr)
+    {
+        free(ptr);
+        --*live;
+        return true;
+    }
+};
+
+inline void testing_device_arena(const Arguments& arg)
+{
+    size_t live = 0;
+    bool   fail = false;
+
+    using stack_t = rocblas_device_arena_stack<mock_arena_backend>;
+    stack_t         arenas(mock_arena_backend{&live, &fail});
+    stack_t::mark_t mark_a, mark_b, mark_c;
+    void*           a;
+    void*           b;
+    void*           c;
+
+    // Without arenas, allocation fails unless growth is allowed
+    EXPECT_FALSE(arenas.allocate(64, false, &a, &mark_a));
+    EXPECT_TRUE(arenas.allocate(64, true, &a, &mark_a));
+    EXPECT_EQ(arenas.num_arenas(), size_t(1));
+    EXPECT_EQ(live, size_t(1));
+
+    // Growth adds an arena at least as large as the existing ones
+    // and leaves existing allocations in place
+    EXPECT_TRUE(arenas.allocate(128, true, &b, &mark_b));
+    EXPECT_EQ(arenas.num_arenas(), size_t(2));
+    EXPECT_EQ(arenas.capacity(), size_t(64 + 128));
+    EXPECT_EQ(arenas.in_use(), size_t(64 + 128));
+    EXPECT_NE(a, b);
+
+    // Allocations must be freed in LIFO order
+    EXPECT_FALSE(arenas.deallocate(64, mark_a));
+    EXPECT_TRUE(arenas.deallocate(128, mark_b));
+
+    // Freed space is reused without growth
+    EXPECT_TRUE(arenas.allocate(128, false, &c, &mark_c));
+    EXPECT_EQ(c, b);
+    EXPECT_TRUE(arenas.deallocate(128, mark_c));
+
+    // Trimming keeps arenas in use, and releases the others
+    EXPECT_TRUE(arenas.trim());
+    EXPECT_EQ(arenas.num_arenas(), size_t(1));
+    EXPECT_EQ(live, size_t(1));
+    EXPECT_TRUE(arenas.deallocate(64, mark_a));
+    EXPECT_EQ(arenas.high_water(), size_t(64 + 128));
+    EXPECT_TRUE(arenas.trim());
+    EXPECT_EQ(arenas.num_arenas(), size_t(0));
+    EXPECT_EQ(live, size_t(0));
+
+    // Failed backend allocations are reported
+    fail = true;
+    EXPECT_FALSE(arenas.allocate(64, true, &a, &mark_a));
+    EXPECT_EQ(a, nullptr);
+
+    // Memory which is not owned is never freed
+    char buffer[256];
+    arenas.add_arena(buffer, sizeof(buffer), false);
+    EXPECT_EQ(arenas.available(), sizeof(buffer));
+    EXPECT_TRUE(arenas.allocate(256, false, &a, &mark_a));
+    EXPECT_EQ(a, buffer);
+    EXPECT_TRUE(arenas.deallocate(256, mark_a));
+    EXPECT_TRUE(arenas.release());
+    EXPECT_EQ(live, size_t(0));
+}
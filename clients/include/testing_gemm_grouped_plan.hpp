@@ -0,0 +1,63 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../../library/src/blas_ex/rocblas_gemm_grouped_ex.hpp"
+#include "rocblas_test.hpp"
+#include <utility>
+
+// Groups of gemms with the same arguments share a launch, whose segments are the problems of
+// those groups
+inline void testing_gemm_grouped_plan(const Arguments& arg)
+{
+    const rocblas_operation N = rocblas_operation_none, Tr = rocblas_operation_transpose;
+
+    // Groups 0, 2 and 4 have the same arguments; group 3 differs only in alpha,
+    // group 1 in its transpose, and group 5 has no work
+    rocblas_operation trans_a[] = {N, Tr, N, N, N, N};
+    rocblas_operation trans_b[] = {N, N, N, N, N, N};
+    rocblas_int       m[]       = {16, 16, 16, 16, 16, 0};
+    rocblas_int       n[]       = {8, 8, 8, 8, 8, 8};
+    rocblas_int       k[]       = {4, 4, 4, 4, 4, 4};
+    rocblas_int       lda[]     = {16, 16, 16, 16, 16, 16};
+    rocblas_int       ldb[]     = {4, 4, 4, 4, 4, 4};
+    rocblas_int       ldc[]     = {16, 16, 16, 16, 16, 16};
+    float             alpha[]   = {1, 1, 1, 2, 1, 1};
+    float             beta[]    = {0, 0, 0, 0, 0, 0};
+    rocblas_int       size[]    = {3, 2, 5, 1, 4, 7};
+
+    auto launches = rocblas_plan_gemm_grouped(
+        6, trans_a, trans_b, m, n, k, alpha, lda, ldb, beta, ldc, ldc, size, sizeof(float));
+
+    ASSERT_EQ(launches.size(), size_t(3));
+
+    // Problems 0-2, 5-9 and 11-14 share one launch, as three segments
+    EXPECT_EQ(launches[0].group, 0);
+    EXPECT_EQ(launches[0].batch_count, 12);
+    ASSERT_EQ(launches[0].segments.size(), size_t(3));
+    EXPECT_EQ(launches[0].segments[0], std::make_pair(0, 3));
+    EXPECT_EQ(launches[0].segments[1], std::make_pair(5, 5));
+    EXPECT_EQ(launches[0].segments[2], std::make_pair(11, 4));
+
+    EXPECT_EQ(launches[1].group, 1);
+    EXPECT_EQ(launches[1].batch_count, 2);
+    ASSERT_EQ(launches[1].segments.size(), size_t(1));
+    EXPECT_EQ(launches[1].segments[0], std::make_pair(3, 2));
+
+    EXPECT_EQ(launches[2].group, 3);
+    EXPECT_EQ(launches[2].batch_count, 1);
+    ASSERT_EQ(launches[2].segments.size(), size_t(1));
+    EXPECT_EQ(launches[2].segments[0], std::make_pair(10, 1));
+
+    // Adjacent groups with the same arguments become one segment
+    trans_a[1] = N;
+    alpha[3]   = 1;
+    launches   = rocblas_plan_gemm_grouped(
+        6, trans_a, trans_b, m, n, k, alpha, lda, ldb, beta, ldc, ldc, size, sizeof(float));
+    ASSERT_EQ(launches.size(), size_t(1));
+    EXPECT_EQ(launches[0].batch_count, 15);
+    ASSERT_EQ(launches[0].segments.size(), size_t(1));
+    EXPECT_EQ(launches[0].segments[0], std::make_pair(0, 15));
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../../library/src/blas3/Tensile/gemm_ooc.hpp"
+#include "rocblas_test.hpp"
+#include <algorithm>
+#include <map>
+#include <vector>
+
+// The tiling depends on the element size, and the schedule and its timing on the tiling
+template <typename T>
+void testing_gemm_ooc_plan(const Arguments& arg)
+{
+    using kind = rocblas_gemm_ooc_op_kind;
+
+    // Plans fit their budget and tiles are no larger than the matrices
+    for(rocblas_int m : {1, 100, 1000, 5000})
+        for(rocblas_int k : {0, 7, 3000})
+            for(size_t budget : {size_t(384), size_t(1) << 20, size_t(1) << 30})
+            {
+                auto plan = rocblas_plan_gemm_ooc(m, 700, k, sizeof(T), budget);
+                ASSERT_GT(plan.tile_m, 0);
+                EXPECT_LE(plan.workspace_size, budget);
+                EXPECT_EQ(plan.workspace_size,
+                          rocblas_gemm_ooc_workspace_size(
+                              plan.tile_m, plan.tile_n, plan.tile_k, sizeof(T)));
+                EXPECT_LE(plan.tile_m, m);
+                EXPECT_LE(plan.tile_n, 700);
+                EXPECT_EQ(plan.tile_k > 0, k > 0);
+                EXPECT_LE(plan.tile_k, k);
+            }
+
+    // Everything fits in one tile, or nothing fits at all
+    auto plan = rocblas_plan_gemm_ooc(300, 200, 100, sizeof(T), size_t(1) << 30);
+    EXPECT_EQ(plan.tile_m, 300);
+    EXPECT_EQ(plan.tile_n, 200);
+    EXPECT_EQ(plan.tile_k, 100);
+    EXPECT_EQ(rocblas_plan_gemm_ooc(300, 200, 100, sizeof(T), 383).tile_m, 0);
+
+    // Large tile edges are multiples of 64, and the tiles are deepened
+    plan = rocblas_plan_gemm_ooc(10000, 10000, 10000, sizeof(T), size_t(64) << 20);
+    EXPECT_EQ(plan.tile_m % 64, 0);
+    EXPECT_EQ(plan.tile_m, plan.tile_n);
+    EXPECT_GT(plan.tile_k, plan.tile_m);
+
+    for(rocblas_int k : {0, 1000})
+        for(bool beta_zero : {false, true})
+        {
+            rocblas_int m = 1000, n = 900;
+            plan          = rocblas_plan_gemm_ooc(m, n, k, sizeof(T), size_t(4) << 20);
+            auto ops      = rocblas_schedule_gemm_ooc(plan, m, n, k, beta_zero);
+
+            // Every element of C is stored once, after its tile is multiplied along all of k
+            std::vector<int>                                           stored(size_t(m) * n);
+            std::map<std::pair<rocblas_int, rocblas_int>, rocblas_int> depth_of_tile;
+            for(auto& op : ops)
+            {
+                auto tile = std::make_pair(op.i, op.j);
+                if(op.kind == kind::load_c)
+                    EXPECT_FALSE(beta_zero);
+                if(op.kind == kind::compute)
+                {
+                    EXPECT_EQ(op.first, !depth_of_tile.count(tile));
+                    depth_of_tile[tile] += op.depth;
+                }
+                if(op.kind == kind::store_c)
+                {
+                    EXPECT_EQ(depth_of_tile[tile], k);
+                    for(rocblas_int j = op.j; j < op.j + op.cols; ++j)
+                        for(rocblas_int i = op.i; i < op.i + op.rows; ++i)
+                            stored[i + j * size_t(m)]++;
+                }
+            }
+            EXPECT_EQ(std::count(stored.begin(), stored.end(), 1), ptrdiff_t(stored.size()));
+
+            if(!k)
+                continue;
+
+            // Overlapping loads, multiplies and stores is faster than running them in
+            // turn, but not faster than the busiest stream
+            double h2d = 12e9, d2h = 12e9, flops = 1e12;
+
+            double stream_busy[rocblas_gemm_ooc_n_streams] = {};
+            for(auto& op : ops)
+                stream_busy[op.stream()]
+                    += rocblas_simulate_gemm_ooc({op}, sizeof(T), h2d, d2h, flops);
+
+            double serial   = stream_busy[0] + stream_busy[1] + stream_busy[2];
+            double busiest  = std::max({stream_busy[0], stream_busy[1], stream_busy[2]});
+            double makespan = rocblas_simulate_gemm_ooc(ops, sizeof(T), h2d, d2h, flops);
+            EXPECT_LT(makespan, 0.9 * serial);
+            EXPECT_GE(makespan, busiest * (1 - 1e-12));
+        }
+}
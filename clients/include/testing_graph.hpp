@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_graph(const Arguments& arg)
+{
+    const rocblas_operation N = rocblas_operation_none;
+    const rocblas_int       n = 16;
+    const size_t            size = size_t(n) * n, len = 3 * size + 2 * n;
+    const T                 one = 1, zero = 0;
+
+    rocblas_local_handle handle{arg};
+    rocblas_graph        graph = nullptr;
+    rocblas_int          count = -1;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_begin_capture(nullptr), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_end_capture(handle, &graph), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_graph_launch(handle, nullptr, nullptr, 0),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_graph_get_node_count(nullptr, &count),
+                          rocblas_status_invalid_pointer);
+
+    // Each buffer holds A, B and C, which are n x n, followed by the vectors x and y
+    host_vector<T> h_init(len), h_gold(len), h_result(len);
+    for(size_t i = 0; i < len; ++i)
+        h_init[i] = T(rocblas_int(i % 5) - 2);
+
+    device_vector<T> d_buf0(len), d_buf1(len);
+    CHECK_DEVICE_ALLOCATION(d_buf0.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_buf1.memcheck());
+
+    auto step = [&](T* d, const T* alpha, real_t<T>* result) {
+        CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(
+            handle, N, N, n, n, n, &one, d, n, d + size, n, &zero, d + 2 * size, n));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_axpy<T>(handle, n, alpha, d + 2 * size, 1, d + 3 * size, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_scal<T>(handle, n, alpha, d + 3 * size, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, n, d + 3 * size, 1, result));
+    };
+
+    // The calls run while they are captured
+    T         alpha   = 2;
+    real_t<T> result0 = 0, result1 = 0;
+    CHECK_HIP_ERROR(d_buf0.transfer_from(h_init));
+    CHECK_ROCBLAS_ERROR(rocblas_begin_capture(handle));
+    EXPECT_ROCBLAS_STATUS(rocblas_begin_capture(handle), rocblas_status_invalid_value);
+    step(d_buf0, &alpha, &result0);
+    CHECK_ROCBLAS_ERROR(rocblas_end_capture(handle, &graph));
+    CHECK_ROCBLAS_ERROR(rocblas_graph_get_node_count(graph, &count));
+    EXPECT_EQ(count, 4);
+    CHECK_HIP_ERROR(h_gold.transfer_from(d_buf0));
+
+    // Host scalars keep their captured values unless they are remapped
+    alpha = 5;
+    rocblas_graph_remap remaps[]
+        = {{d_buf0, d_buf1, len * sizeof(T)}, {&result0, &result1, sizeof(result0)}};
+    CHECK_HIP_ERROR(d_buf1.transfer_from(h_init));
+    CHECK_ROCBLAS_ERROR(rocblas_graph_launch(handle, graph, remaps, 2));
+    CHECK_HIP_ERROR(h_result.transfer_from(d_buf1));
+
+    // The values are small integers, so the results are exact
+    for(size_t i = 0; i < len; ++i)
+        EXPECT_EQ(h_result[i], h_gold[i]);
+    EXPECT_EQ(result1, result0);
+
+    // A remapped scalar is read when the graph is launched
+    T new_alpha = 3;
+    CHECK_HIP_ERROR(d_buf1.transfer_from(h_init));
+    step(d_buf1, &new_alpha, &result0);
+    CHECK_HIP_ERROR(h_gold.transfer_from(d_buf1));
+
+    rocblas_graph_remap new_remaps[] = {{d_buf0, d_buf1, len * sizeof(T)},
+                                        {&result0, &result1, sizeof(result0)},
+                                        {&alpha, &new_alpha, sizeof(T)}};
+    CHECK_HIP_ERROR(d_buf1.transfer_from(h_init));
+    CHECK_ROCBLAS_ERROR(rocblas_graph_launch(handle, graph, new_remaps, 3));
+    CHECK_HIP_ERROR(h_result.transfer_from(d_buf1));
+    for(size_t i = 0; i < len; ++i)
+        EXPECT_EQ(h_result[i], h_gold[i]);
+    EXPECT_EQ(result1, result0);
+
+    // Remapped buffers must not overlap, and graphs cannot be launched while capturing
+    rocblas_graph_remap overlapping[] = {{d_buf0, d_buf1, len * sizeof(T)},
+                                         {d_buf0 + len - 1, d_buf1, sizeof(T)}};
+    EXPECT_ROCBLAS_STATUS(rocblas_graph_launch(handle, graph, overlapping, 2),
+                          rocblas_status_invalid_value);
+    CHECK_ROCBLAS_ERROR(rocblas_begin_capture(handle));
+    EXPECT_ROCBLAS_STATUS(rocblas_graph_launch(handle, graph, nullptr, 0),
+                          rocblas_status_invalid_value);
+
+    rocblas_graph empty = nullptr;
+    CHECK_ROCBLAS_ERROR(rocblas_end_capture(handle, &empty));
+    CHECK_ROCBLAS_ERROR(rocblas_graph_get_node_count(empty, &count));
+    EXPECT_EQ(count, 0);
+    CHECK_ROCBLAS_ERROR(rocblas_graph_destroy(empty));
+    CHECK_ROCBLAS_ERROR(rocblas_graph_destroy(graph));
+}
@@ -0,0 +1,161 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_host_result(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    // One length is reduced by a single block, and the other by two kernels
+    const rocblas_int n_small = 500, n_large = 100000, batch_count = 3;
+    const size_t      size = size_t(n_large) * batch_count;
+
+    rocblas_local_handle     handle{arg};
+    rocblas_host_result_mode mode = rocblas_host_result_mode(-1);
+    hipEvent_t               event;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_synchronize_host_results(nullptr),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_host_result_mode(handle, rocblas_host_result_mode(2)),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_host_result_mode(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_host_results_event(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // The default mode writes results before returning
+    CHECK_ROCBLAS_ERROR(rocblas_get_host_result_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_host_result_blocking);
+
+    host_vector<T> hx(size), hy(size);
+    for(size_t i = 0; i < size; ++i)
+    {
+        hx[i] = T(rocblas_int(i % 5) - 2);
+        hy[i] = T(rocblas_int(i % 7) - 3);
+    }
+    hx[n_small / 2] = hx[n_large / 3] = T(9);
+
+    device_vector<T> dx(size), dy(size);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    // Results of the reductions of each length, which are all queued before any is read
+    struct results_t
+    {
+        Tr          nrm2[2], asum[2], nrm2_batched[2][batch_count];
+        T           dot[2], dot_ex[2], dot_batched[2][batch_count];
+        rocblas_int iamax[2];
+    };
+
+    auto dot_ex = [&](rocblas_int n, T* result) {
+        return rocblas_dot_ex(handle,
+                              n,
+                              dx,
+                              arg.a_type,
+                              1,
+                              dy,
+                              arg.b_type,
+                              1,
+                              result,
+                              arg.c_type,
+                              arg.compute_type);
+    };
+
+    auto run = [&](results_t& r) {
+        for(int i = 0; i < 2; ++i)
+        {
+            rocblas_int n = i ? n_large : n_small;
+            CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, n, dx, 1, &r.nrm2[i]));
+            CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, n, dx, 1, &r.asum[i]));
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, n, dx, 1, dy, 1, &r.dot[i]));
+            CHECK_ROCBLAS_ERROR(dot_ex(n, &r.dot_ex[i]));
+            CHECK_ROCBLAS_ERROR(rocblas_iamax<T>(handle, n, dx, 1, &r.iamax[i]));
+            CHECK_ROCBLAS_ERROR(rocblas_nrm2_strided_batched<T>(
+                handle, n, dx, 1, n_large, batch_count, r.nrm2_batched[i]));
+            CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched<T>(
+                handle, n, dx, 1, n_large, dy, 1, n_large, batch_count, r.dot_batched[i]));
+        }
+    };
+
+    // Deferred results are finalized on the device instead of the host
+    auto expect_near = [](Tr result, Tr gold) {
+        EXPECT_NEAR(result, gold, gold * 4 * std::numeric_limits<Tr>::epsilon());
+    };
+
+    auto check = [&](const results_t& r, const results_t& gold) {
+        for(int i = 0; i < 2; ++i)
+        {
+            expect_near(r.nrm2[i], gold.nrm2[i]);
+            for(int b = 0; b < batch_count; ++b)
+                expect_near(r.nrm2_batched[i][b], gold.nrm2_batched[i][b]);
+
+            // The values are small integers, so the sums are exact
+            EXPECT_EQ(r.asum[i], gold.asum[i]);
+            EXPECT_EQ(r.dot[i], gold.dot[i]);
+            EXPECT_EQ(r.dot_ex[i], gold.dot[i]);
+            for(int b = 0; b < batch_count; ++b)
+                EXPECT_EQ(r.dot_batched[i][b], gold.dot_batched[i][b]);
+            EXPECT_EQ(r.iamax[i], gold.iamax[i]);
+        }
+    };
+
+    results_t gold, deferred;
+    run(gold);
+
+    // The sizes of the device memory of a dot product, with and without deferred results
+    size_t size_blocking, size_deferred;
+    T      dot;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(rocblas_dot<T>(handle, n_large, dx, 1, dy, 1, &dot));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size_blocking));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_host_result_mode(handle, rocblas_host_result_deferred));
+    CHECK_ROCBLAS_ERROR(rocblas_get_host_result_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_host_result_deferred);
+
+    // Results are written once the handle's event completes
+    memset(&deferred, 0xff, sizeof(deferred));
+    run(deferred);
+    CHECK_ROCBLAS_ERROR(rocblas_get_host_results_event(handle, &event));
+    CHECK_ROCBLAS_ERROR(rocblas_synchronize_host_results(handle));
+    CHECK_HIP_ERROR(hipEventSynchronize(event));
+    check(deferred, gold);
+
+    // Results in device pointer mode are not deferred
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    device_vector<T> d_dot(1);
+    CHECK_DEVICE_ALLOCATION(d_dot.memcheck());
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, n_large, dx, 1, dy, 1, d_dot));
+    CHECK_HIP_ERROR(hipMemcpy(&dot, d_dot, sizeof(T), hipMemcpyDeviceToHost));
+    EXPECT_EQ(dot, gold.dot[1]);
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // Deferred results are held in device memory, which the size query includes
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(rocblas_dot<T>(handle, n_large, dx, 1, dy, 1, &dot));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size_deferred));
+    EXPECT_GT(size_deferred, size_blocking);
+
+    // Results in flight are written when the mode is reset
+    memset(&deferred, 0xff, sizeof(deferred));
+    run(deferred);
+    CHECK_ROCBLAS_ERROR(rocblas_set_host_result_mode(handle, rocblas_host_result_blocking));
+    check(deferred, gold);
+
+    // A deferred result fits in the device memory given by the size query
+    CHECK_ROCBLAS_ERROR(rocblas_set_host_result_mode(handle, rocblas_host_result_deferred));
+    CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size_deferred));
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, n_large, dx, 1, dy, 1, &dot));
+    CHECK_ROCBLAS_ERROR(rocblas_synchronize_host_results(handle));
+    EXPECT_EQ(dot, gold.dot[1]);
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../../library/src/include/matrix_copy.hpp"
+#include "rocblas_test.hpp"
+
+// Matrix copies are planned as one memcpy, one 2D memcpy or the copy kernel, which uses the
+// widest loads that the alignment of the matrices allows
+template <typename T>
+void testing_matrix_copy_plan(const Arguments& arg)
+{
+    using plan_t = rocblas_matrix_copy_plan;
+    alignas(16) T buf[2]{};
+    const T*      src = buf;
+    const T*      dst = buf + 1;
+
+    // Empty and in-place copies do nothing
+    EXPECT_EQ(rocblas_plan_matrix_copy(sizeof(T), src, 8, 64, dst, 8, 64, 0, 8, 4).method,
+              plan_t::none);
+    EXPECT_EQ(rocblas_plan_matrix_copy(sizeof(T), src, 8, 64, src, 8, 64, 8, 8, 4).method,
+              plan_t::none);
+
+    // Contiguous matrices are copied with one memcpy
+    auto plan = rocblas_plan_matrix_copy(sizeof(T), src, 8, 64, dst, 8, 64, 8, 8, 4);
+    EXPECT_EQ(plan.method, plan_t::memcpy_1d);
+    EXPECT_EQ(plan.width, sizeof(T) * 8 * 8 * 4);
+
+    // Padded leading dimensions with tightly packed batches are one 2D memcpy
+    // over the columns of all of the matrices
+    plan = rocblas_plan_matrix_copy(sizeof(T), src, 10, 80, dst, 12, 96, 8, 8, 4);
+    EXPECT_EQ(plan.method, plan_t::memcpy_2d);
+    EXPECT_EQ(plan.width, sizeof(T) * 8);
+    EXPECT_EQ(plan.height, size_t(8 * 4));
+    EXPECT_EQ(plan.src_pitch, sizeof(T) * 10);
+    EXPECT_EQ(plan.dst_pitch, sizeof(T) * 12);
+
+    // The strides of a single matrix are ignored
+    plan = rocblas_plan_matrix_copy(sizeof(T), src, 10, 0, dst, 12, 0, 8, 8, 1);
+    EXPECT_EQ(plan.method, plan_t::memcpy_2d);
+    EXPECT_EQ(plan.height, size_t(8));
+
+    // Contiguous matrices with padded batch strides are one 2D memcpy over the matrices
+    plan = rocblas_plan_matrix_copy(sizeof(T), src, 8, 100, dst, 8, 70, 8, 8, 4);
+    EXPECT_EQ(plan.method, plan_t::memcpy_2d);
+    EXPECT_EQ(plan.width, sizeof(T) * 64);
+    EXPECT_EQ(plan.height, size_t(4));
+    EXPECT_EQ(plan.src_pitch, sizeof(T) * 100);
+    EXPECT_EQ(plan.dst_pitch, sizeof(T) * 70);
+
+    // Padded leading dimensions and batch strides need the kernel, which loads
+    // 16-byte vectors when everything is aligned to them
+    size_t v = 16 / sizeof(T);
+    plan     = rocblas_plan_matrix_copy(
+        sizeof(T), src, 8 * v, 80 * v, buf, 12 * v, 100 * v, 4 * v, 8, 4);
+    EXPECT_EQ(plan.method, plan_t::kernel);
+    EXPECT_EQ(plan.vector, v);
+
+    // Misaligned addresses or sizes use narrower loads
+    plan = rocblas_plan_matrix_copy(
+        sizeof(T), dst, 8 * v, 80 * v, buf, 12 * v, 100 * v, 4 * v, 8, 4);
+    EXPECT_EQ(plan.method, plan_t::kernel);
+    EXPECT_EQ(plan.vector, size_t(1));
+    plan = rocblas_plan_matrix_copy(
+        sizeof(T), src, 8 * v, 80 * v, buf, 12 * v, 100 * v, 4 * v + 1, 8, 4);
+    EXPECT_EQ(plan.vector, size_t(1));
+
+    // Arrays of pointers are copied by the kernel one element at a time
+    plan = rocblas_plan_matrix_copy(sizeof(T), nullptr, 8, 0, nullptr, 8, 0, 8, 8, 4);
+    EXPECT_EQ(plan.method, plan_t::kernel);
+    EXPECT_EQ(plan.vector, size_t(1));
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#define OPEN(A) _open(A, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_APPEND, _S_IREAD | _S_IWRITE);
+#define CLOSE(A) _close(A)
+#define READ(A, B, C) _read(A, B, unsigned(C))
+#define PIPE(A) _pipe(A, 1 << 16, _O_BINARY)
+#define setenv(A, B, C) _putenv_s(A, B)
+#define unsetenv(A) _putenv_s(A, "")
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define OPEN(A) open(A, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+#define CLOSE(A) close(A)
+#define READ(A, B, C) read(A, B, C)
+#define PIPE(A) pipe(A)
+#endif
+
+// The asynchronous log writer (ROCBLAS_LOG_ASYNC) keeps the order of each thread's messages,
+// writes every pending message when the workers are cleared, and counts the messages which it
+// drops when its queue is full, warning about them when the file is closed.
+inline void testing_ostream_async(const Arguments& arg)
+{
+    constexpr size_t NTHREAD = 4; // Number of threads writing to one file
+    constexpr size_t NLINES  = 5000; // Number of lines each thread writes
+    constexpr size_t NDROP   = 1000; // Number of lines written to a full queue
+    constexpr size_t LINELEN = 1000; // Length of the lines written to a full queue
+
+    // The mode is read when the worker of a file is created, and is restored afterwards
+    auto set_async = [](const char* mode, const char* queue_size) {
+        setenv("ROCBLAS_LOG_ASYNC", mode, true);
+        setenv("ROCBLAS_LOG_ASYNC_QUEUE_SIZE", queue_size, true);
+    };
+    auto unset_async = [] {
+        unsetenv("ROCBLAS_LOG_ASYNC");
+        unsetenv("ROCBLAS_LOG_ASYNC_QUEUE_SIZE");
+    };
+
+    // Parses "<thread> <line>" from a line
+    auto parse = [](const std::string& line, size_t& t, size_t& i) {
+        std::istringstream is(line);
+        return bool(is >> t >> i);
+    };
+
+    //
+    // Ordering, and draining by clear_workers
+    //
+    {
+        std::string path = rocblas_tempname();
+        int         fd   = OPEN(path.c_str());
+        ASSERT_NE(fd, -1) << "Cannot open temporary file " << path;
+
+        // A small queue makes the threads wait for the worker, which is the block policy
+        set_async("block", "8");
+        std::vector<rocblas_internal_ostream> streams;
+        streams.reserve(NTHREAD);
+        for(size_t t = 0; t < NTHREAD; ++t)
+            streams.emplace_back(fd);
+        unset_async();
+        CLOSE(fd);
+
+        std::thread threads[NTHREAD];
+        for(size_t t = 0; t < NTHREAD; ++t)
+            threads[t] = std::thread([&, t] {
+                for(size_t i = 0; i < NLINES; ++i)
+                    streams[t] << t << " " << i << std::endl;
+            });
+        for(auto& thread : threads)
+            thread.join();
+
+        // The file is complete once the workers are cleared, while the streams still exist
+        rocblas_internal_ostream::clear_workers();
+
+        std::ifstream is(path);
+        ASSERT_TRUE(is.is_open()) << "Could not open " << path;
+        size_t next[NTHREAD] = {};
+        size_t lines         = 0;
+        for(std::string line; std::getline(is, line); ++lines)
+        {
+            size_t t, i;
+            ASSERT_TRUE(parse(line, t, i) && t < NTHREAD) << "Garbled line: " << line;
+            ASSERT_EQ(i, next[t]) << "Line out of order for thread " << t;
+            ++next[t];
+        }
+        EXPECT_EQ(lines, NTHREAD * NLINES);
+        is.close();
+
+        streams.clear();
+        remove(path.c_str());
+    }
+
+    //
+    // Dropped messages, and the warning about them
+    //
+    {
+        // Until the pipe is read, the worker is blocked writing, and its queue fills
+        int fds[2];
+        ASSERT_EQ(PIPE(fds), 0) << "Cannot create a pipe";
+
+        set_async("drop", "2");
+        auto os = std::make_unique<rocblas_internal_ostream>(fds[1]);
+        unset_async();
+        CLOSE(fds[1]);
+
+        std::string padding(LINELEN, 'x');
+        for(size_t i = 0; i < NDROP; ++i)
+            *os << 0 << " " << i << " " << padding << std::endl;
+
+        // The pipe reaches its end when the worker closes it
+        std::string output;
+        std::thread reader([&] {
+            char buffer[4096];
+            for(ptrdiff_t n; (n = READ(fds[0], buffer, sizeof(buffer))) > 0;)
+                output.append(buffer, n);
+        });
+
+        testing::internal::CaptureStderr();
+        os.reset();
+        rocblas_internal_ostream::clear_workers();
+        std::string warning = testing::internal::GetCapturedStderr();
+        reader.join();
+        CLOSE(fds[0]);
+
+        // The lines which were written are in order, and the others are counted as dropped
+        std::istringstream is(output);
+        size_t             written = 0, last = 0;
+        for(std::string line; std::getline(is, line); ++written)
+        {
+            size_t t, i;
+            ASSERT_TRUE(parse(line, t, i)) << "Garbled line: " << line.substr(0, 32);
+            if(written)
+                ASSERT_GT(i, last);
+            last = i;
+        }
+        EXPECT_LT(written, NDROP);
+
+        size_t dropped = 0;
+        auto   pos     = warning.find("rocBLAS warning: ");
+        ASSERT_NE(pos, std::string::npos) << "No warning about dropped messages";
+        EXPECT_EQ(sscanf(warning.c_str() + pos, "rocBLAS warning: %zu", &dropped), 1);
+        EXPECT_NE(warning.find("ROCBLAS_LOG_ASYNC queue was full"), std::string::npos);
+        EXPECT_EQ(written + dropped, NDROP);
+    }
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+
+// Matrices are initialized by a counter-based generator, so each element depends only on the
+// seed and its position
+template <typename T>
+void testing_random_init(const Arguments& arg)
+{
+    // Known answer for Philox4x32-10 with a zero key and counter
+    auto r = rocblas_philox_rng(0)(0, 0, 0);
+    EXPECT_EQ(r[0], 0x6627e8d5u);
+    EXPECT_EQ(r[1], 0xe169c58du);
+    EXPECT_EQ(r[2], 0xbc57ac4cu);
+    EXPECT_EQ(r[3], 0x9b00dbd8u);
+
+    // The high words of the indices are part of the counter
+    const size_t high    = size_t(1) << 32;
+    auto         r_i     = rocblas_philox_rng(0)(0, high, 0);
+    auto         r_j     = rocblas_philox_rng(0)(0, 0, high);
+    auto         r_batch = rocblas_philox_rng(0)(high, 0, 0);
+    EXPECT_NE(r_i, r);
+    EXPECT_NE(r_j, r);
+    EXPECT_NE(r_batch, r);
+    EXPECT_NE(r_i, r_j);
+    EXPECT_NE(r_i, r_batch);
+    EXPECT_NE(r_j, r_batch);
+
+    // Large enough to be initialized in parallel
+    size_t M = 300, N = 200, lda = 301, batch_count = 2, stride = lda * N;
+
+    host_vector<T> hA(stride * batch_count);
+    rocblas_seedrand();
+    rocblas_init(hA, M, N, lda, stride, batch_count);
+
+    // The initialization is repeatable regardless of the order of elements or the number of
+    // threads
+    rocblas_seedrand();
+    rocblas_philox_rng rng;
+    size_t             mismatches = 0;
+    for(size_t b = 0; b < batch_count; b++)
+        for(size_t j = 0; j < N; j++)
+            for(size_t i = 0; i < M; i++)
+                mismatches += hA[i + j * lda + b * stride] != random_generator<T>(rng, b, i, j);
+    EXPECT_EQ(mismatches, size_t(0));
+
+    // Successive initializations use different keys
+    host_vector<T> hB(stride * batch_count);
+    rocblas_init(hB, M, N, lda, stride, batch_count);
+    EXPECT_NE(hA, hB);
+}
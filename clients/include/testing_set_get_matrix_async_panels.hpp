@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_set_get_matrix_async_panels(const Arguments& arg)
+{
+    rocblas_int          rows = arg.M;
+    rocblas_int          cols = arg.N;
+    rocblas_int          lda  = arg.lda;
+    rocblas_int          ldb  = arg.ldb;
+    rocblas_int          ldc  = arg.ldc;
+    rocblas_local_handle handle{arg};
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // Three panels, so that they use different internal streams
+    rocblas_int panel_cols = std::max((cols + 2) / 3, 1);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalidGPUMatrix = rows < 0 || cols < 0 || ldc <= 0 || ldc < rows;
+    bool invalidSet       = invalidGPUMatrix || lda <= 0 || lda < rows;
+    bool invalidGet       = invalidGPUMatrix || ldb <= 0 || ldb < rows;
+
+    if(invalidSet || invalidGet)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_set_matrix_async_panels(
+                rows, cols, sizeof(T), nullptr, lda, nullptr, ldc, 1, nullptr, stream),
+            invalidSet ? rocblas_status_invalid_size : rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_get_matrix_async_panels(
+                rows, cols, sizeof(T), nullptr, ldc, nullptr, ldb, 1, nullptr, stream),
+            invalidGet ? rocblas_status_invalid_size : rocblas_status_invalid_pointer);
+
+        return;
+    }
+
+    if(rows && cols)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_set_matrix_async_panels(
+                rows, cols, sizeof(T), nullptr, lda, nullptr, ldc, 0, nullptr, stream),
+            rocblas_status_invalid_size);
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory,
+    host_pinned_vector<T> ha(cols * size_t(lda));
+    host_pinned_vector<T> hb(cols * size_t(ldb));
+    host_vector<T>        ha_pageable(cols * size_t(lda));
+    host_vector<T>        hb_pageable(cols * size_t(ldb));
+    host_vector<T>        hb_gold(cols * size_t(ldb));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error = 0.0;
+
+    // allocate memory on device
+    device_vector<T> dc(cols * size_t(ldc));
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+
+    size_t                  n_panels = rows && cols ? (cols - 1) / panel_cols + 1 : 0;
+    std::vector<hipEvent_t> events(n_panels);
+    for(auto& event : events)
+        CHECK_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<T>(ha, rows, cols, lda);
+    rocblas_init<T>(hb, rows, cols, ldb);
+    for(size_t i = 0; i < ha.size(); i++)
+        ha_pageable[i] = ha[i];
+    for(size_t i = 0; i < hb.size(); i++)
+        hb_gold[i] = hb_pageable[i] = hb[i];
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // reference calculation
+        cpu_time_used = get_time_us_no_sync();
+        for(int i1 = 0; i1 < rows; i1++)
+            for(int i2 = 0; i2 < cols; i2++)
+                hb_gold[i1 + i2 * size_t(ldb)] = ha[i1 + i2 * size_t(lda)];
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // ROCBLAS pinned host memory
+        CHECK_ROCBLAS_ERROR(rocblas_set_matrix_async_panels(
+            rows, cols, sizeof(T), ha, lda, dc, ldc, panel_cols, events.data(), stream));
+        CHECK_ROCBLAS_ERROR(rocblas_get_matrix_async_panels(
+            rows, cols, sizeof(T), dc, ldc, hb, ldb, panel_cols, events.data(), stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        for(auto& event : events)
+            EXPECT_EQ(hipEventQuery(event), hipSuccess);
+
+        // ROCBLAS pageable host memory, through staging buffers
+        CHECK_HIP_ERROR(hipMemset(dc, 0, sizeof(T) * ldc * size_t(cols)));
+        CHECK_ROCBLAS_ERROR(rocblas_set_matrix_async_panels(
+            rows, cols, sizeof(T), ha_pageable, lda, dc, ldc, panel_cols, nullptr, stream));
+        CHECK_ROCBLAS_ERROR(rocblas_get_matrix_async_panels(
+            rows, cols, sizeof(T), dc, ldc, hb_pageable, ldb, panel_cols, events.data(), stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(rows, cols, ldb, hb, hb_gold);
+            unit_check_general<T>(rows, cols, ldb, hb_pageable, hb_gold);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<T>('F', rows, cols, ldb, hb, hb_gold);
+            rocblas_error += norm_check_general<T>('F', rows, cols, ldb, hb_pageable, hb_gold);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_set_matrix_async_panels(
+                rows, cols, sizeof(T), ha, lda, dc, ldc, panel_cols, events.data(), stream);
+            rocblas_get_matrix_async_panels(
+                rows, cols, sizeof(T), dc, ldc, hb, ldb, panel_cols, events.data(), stream);
+        }
+
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_set_matrix_async_panels(
+                rows, cols, sizeof(T), ha, lda, dc, ldc, panel_cols, events.data(), stream);
+            rocblas_get_matrix_async_panels(
+                rows, cols, sizeof(T), dc, ldc, hb, ldb, panel_cols, events.data(), stream);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(rows, cols),
+            cpu_time_used,
+            rocblas_error);
+    }
+
+    for(auto& event : events)
+        CHECK_HIP_ERROR(hipEventDestroy(event));
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../../library/src/include/tuning_db.hpp"
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <sstream>
+#include <vector>
+
+// Tuning database entries are read per architecture, and select the solution of the problem
+// which they match exactly
+inline void testing_tuning_db(const Arguments& arg)
+{
+    rocblas_tuning_db_key key{
+        "f16_r", "f16_r", "f32_r", 'N', 'T', 1024, 512, 64, 1, 1024, 512, 1024, 1024};
+
+    // Entries of other architectures are ignored, malformed lines are reported,
+    // and later entries replace earlier ones
+    std::istringstream is("# arch a c compute transA transB m n k batch lda ldb ldc ldd index\n"
+                          "\n"
+                          "gfx908 f16_r f16_r f32_r N T 1024 512 64 1 1024 512 1024 1024 7\n"
+                          "gfx900 f16_r f16_r f32_r N T 1024 512 64 1 1024 512 1024 1024 3\n"
+                          "gfx908 f16_r f16_r f32_r N T 1024 512 64 1 1024 512 1024\n"
+                          "gfx908 f16_r f16_r f32_r N T 1024 512 64 1 1024 512 1024 1024 9 1\n"
+                          "gfx908 f32_r f32_r f32_r N N 16 16 16 1 16 16 16 16 5 # small\n"
+                          "gfx908 f16_r f16_r f32_r N T 1024 512 64 1 1024 512 1024 1024 8\n");
+
+    rocblas_tuning_db db;
+    auto              bad_lines = db.read(is, "gfx908");
+    EXPECT_EQ(bad_lines, (std::vector<size_t>{5, 6}));
+    EXPECT_EQ(db.size(), size_t(2));
+    EXPECT_EQ(db.find(key), 8);
+
+    // Any difference in the problem misses
+    auto other = key;
+    other.ldd  = 2048;
+    EXPECT_EQ(db.find(other), -1);
+    other         = key;
+    other.trans_b = 'N';
+    EXPECT_EQ(db.find(other), -1);
+
+    // Written entries are read back
+    std::stringstream ss;
+    rocblas_tuning_db::write(ss, "gfx90a", other, 42);
+    rocblas_tuning_db written;
+    EXPECT_TRUE(written.read(ss, "gfx90a").empty());
+    EXPECT_EQ(written.size(), size_t(1));
+    EXPECT_EQ(written.find(other), 42);
+    EXPECT_EQ(written.find(key), -1);
+
+    // Forcing a solution on a handle
+    rocblas_local_handle handle;
+    int32_t              index = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_index(handle, &index));
+    EXPECT_EQ(index, -1);
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_index(handle, 42));
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_index(handle, &index));
+    EXPECT_EQ(index, 42);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_solution_index(handle, -2), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_solution_index(nullptr, 0),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_solution_index(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    rocblas_int count = -1;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_solution_candidates_query(handle, nullptr, 4, &count),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_solution_candidates_query(handle, nullptr, -1, &count),
+                          rocblas_status_invalid_size);
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_candidates_query(handle, nullptr, 0, &count));
+    EXPECT_EQ(count, 0);
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_candidates_query(handle, nullptr, 0, nullptr));
+}
@@ -0,0 +1,730 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*******************************************************************************
+ * rocBLAS null device
+ *
+ * A stub of the parts of the HIP runtime used by rocBLAS and its clients, which
+ * is loaded ahead of the HIP runtime with LD_PRELOAD:
+ *
+ *   LD_PRELOAD=librocblas-null-device.so ./rocblas-bench -f gemm -i 1000
+ *
+ * Device memory is zero-initialized host memory, copies and memsets are done on
+ * the host as they are issued, and kernel launches are only counted. All of the
+ * host work of rocBLAS -- argument checking, logging, workspace sizing, Tensile
+ * solution selection -- runs as it does with a GPU, so its cost can be measured
+ * on machines without one. The results of the computations are meaningless, but
+ * deterministic.
+ *
+ * Environment variables:
+ *
+ *   ROCBLAS_NULL_DEVICE_ARCH     architecture reported for the device, such as
+ *                                gfx906 (default gfx908), which selects the
+ *                                Tensile library
+ *   ROCBLAS_NULL_DEVICE_SUMMARY  if set, the number of launches of each kernel
+ *                                is written to stderr at exit
+ ******************************************************************************/
+
+#include <hip/hip_ext.h>
+#include <hip/hip_runtime_api.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Opaque HIP handles
+struct ihipStream_t
+{
+};
+
+struct ihipEvent_t
+{
+    std::chrono::steady_clock::time_point time;
+};
+
+struct ihipModule_t
+{
+};
+
+struct ihipModuleSymbol_t
+{
+    std::string name;
+};
+
+namespace
+{
+    constexpr size_t NULL_DEVICE_MEMORY = size_t(32) << 30;
+
+    class null_device
+    {
+        std::mutex                                   mutex;
+        std::unordered_map<void*, size_t>            allocations;
+        std::unordered_map<const void*, std::string> kernel_names;
+        std::map<std::string, size_t>                launches;
+
+    public:
+        std::atomic<size_t> kernel_launches{0};
+        std::atomic<size_t> copies{0};
+        std::atomic<size_t> copy_bytes{0};
+        std::string         arch;
+
+        null_device()
+        {
+            const char* env = getenv("ROCBLAS_NULL_DEVICE_ARCH");
+            arch            = env && *env ? env : "gfx908";
+        }
+
+        void report()
+        {
+            fprintf(stderr,
+                    "rocBLAS null device: %zu kernel launches, %zu copies of %zu bytes\n",
+                    size_t(kernel_launches),
+                    size_t(copies),
+                    size_t(copy_bytes));
+
+            // Most frequently launched kernels first
+            std::lock_guard<std::mutex>                 lock(mutex);
+            std::vector<std::pair<size_t, std::string>> sorted;
+            for(auto& launch : launches)
+                sorted.emplace_back(launch.second, launch.first);
+            std::sort(sorted.rbegin(), sorted.rend());
+            for(auto& launch : sorted)
+                fprintf(stderr, "%12zu %s\n", launch.first, launch.second.c_str());
+        }
+
+        void* allocate(size_t size)
+        {
+            // Zero-initialized, so that results do not depend on previous contents
+            void* ptr = calloc(std::max(size, size_t(1)), 1);
+            if(ptr)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                allocations.emplace(ptr, size);
+            }
+            return ptr;
+        }
+
+        bool release(void* ptr)
+        {
+            if(!ptr)
+                return true;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!allocations.erase(ptr))
+                    return false;
+            }
+            free(ptr);
+            return true;
+        }
+
+        // The allocation containing ptr, or nullptr
+        void* find(const void* ptr)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(auto& allocation : allocations)
+            {
+                auto* base = static_cast<const char*>(allocation.first);
+                if(ptr >= base && ptr < base + std::max(allocation.second, size_t(1)))
+                    return allocation.first;
+            }
+            return nullptr;
+        }
+
+        void register_kernel(const void* host_function, const char* name)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            kernel_names[host_function] = name;
+        }
+
+        // Functions live as long as the process, like their code objects usually do
+        ihipModuleSymbol_t* function(const char* name)
+        {
+            return new ihipModuleSymbol_t{name};
+        }
+
+        void launch(const void* host_function)
+        {
+            ++kernel_launches;
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = kernel_names.find(host_function);
+            ++launches[it != kernel_names.end() ? it->second : "(unregistered kernel)"];
+        }
+
+        void launch(const ihipModuleSymbol_t* function)
+        {
+            ++kernel_launches;
+            std::lock_guard<std::mutex> lock(mutex);
+            ++launches[function ? function->name : "(null function)"];
+        }
+
+        void copy(void* dst, const void* src, size_t size)
+        {
+            if(size && dst != src)
+                memmove(dst, src, size);
+            ++copies;
+            copy_bytes += size;
+        }
+    };
+
+    null_device& device()
+    {
+        // Never destroyed, since static destructors may still free device memory
+        static auto* dev = new null_device;
+        static struct reporter
+        {
+            ~reporter()
+            {
+                if(getenv("ROCBLAS_NULL_DEVICE_SUMMARY"))
+                    dev->report();
+            }
+        } report;
+        return *dev;
+    }
+
+    // Launch configuration pushed by the <<< >>> syntax, which is per-thread
+    thread_local std::vector<std::tuple<dim3, dim3, size_t, hipStream_t>> call_configurations;
+
+    thread_local hipError_t last_error = hipSuccess;
+
+    hipError_t status(hipError_t error)
+    {
+        if(error != hipSuccess)
+            last_error = error;
+        return error;
+    }
+
+    // hipDeviceProp_t::gcnArchName only exists in recent HIP versions
+    template <typename PROP>
+    auto set_arch_name(PROP& prop, const std::string& arch, int)
+        -> decltype(prop.gcnArchName, void())
+    {
+        strncpy(prop.gcnArchName, arch.c_str(), sizeof(prop.gcnArchName) - 1);
+    }
+
+    template <typename PROP>
+    void set_arch_name(PROP&, const std::string&, long)
+    {
+    }
+} // namespace
+
+/*******************************************************************************
+ * Devices
+ ******************************************************************************/
+extern "C" hipError_t hipGetDeviceCount(int* count)
+{
+    if(!count)
+        return status(hipErrorInvalidValue);
+    *count = 1;
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipGetDevice(int* deviceId)
+{
+    if(!deviceId)
+        return status(hipErrorInvalidValue);
+    *deviceId = 0;
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipSetDevice(int deviceId)
+{
+    return deviceId ? status(hipErrorInvalidDevice) : hipSuccess;
+}
+
+extern "C" hipError_t hipGetDeviceProperties(hipDeviceProp_t* prop, int deviceId)
+{
+    if(!prop)
+        return status(hipErrorInvalidValue);
+    if(deviceId)
+        return status(hipErrorInvalidDevice);
+
+    const std::string& arch = device().arch;
+
+    memset(prop, 0, sizeof(*prop));
+    strncpy(prop->name, "rocBLAS null device", sizeof(prop->name) - 1);
+    set_arch_name(*prop, arch, 0);
+    // Like an MI100, so that Tensile selects its usual solutions
+    prop->gcnArch            = atoi(arch.c_str() + strcspn(arch.c_str(), "0123456789"));
+    prop->totalGlobalMem     = NULL_DEVICE_MEMORY;
+    prop->sharedMemPerBlock  = 64 * 1024;
+    prop->regsPerBlock       = 64 * 1024;
+    prop->warpSize           = 64;
+    prop->maxThreadsPerBlock = 1024;
+    prop->clockRate          = 1502000;
+    prop->memoryClockRate    = 1200000;
+    prop->memoryBusWidth     = 4096;
+    prop->totalConstMem      = 64 * 1024;
+    prop->major              = 9;
+    prop->minor              = 0;
+    prop->l2CacheSize        = 8 * 1024 * 1024;
+
+    prop->multiProcessorCount              = 120;
+    prop->maxThreadsPerMultiProcessor      = 2560;
+    prop->maxSharedMemoryPerMultiProcessor = 64 * 1024;
+    for(int i = 0; i < 3; ++i)
+    {
+        prop->maxThreadsDim[i] = 1024;
+        prop->maxGridSize[i]   = INT32_MAX;
+    }
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipDeviceGetAttribute(int* pi, hipDeviceAttribute_t attr, int deviceId)
+{
+    if(!pi)
+        return status(hipErrorInvalidValue);
+
+    hipDeviceProp_t prop;
+    hipError_t      error = hipGetDeviceProperties(&prop, deviceId);
+    if(error != hipSuccess)
+        return error;
+
+    switch(attr)
+    {
+    case hipDeviceAttributeMaxThreadsPerBlock:
+        *pi = prop.maxThreadsPerBlock;
+        break;
+    case hipDeviceAttributeWarpSize:
+        *pi = prop.warpSize;
+        break;
+    case hipDeviceAttributeMultiprocessorCount:
+        *pi = prop.multiProcessorCount;
+        break;
+    case hipDeviceAttributeClockRate:
+        *pi = prop.clockRate;
+        break;
+    case hipDeviceAttributeComputeCapabilityMajor:
+        *pi = prop.major;
+        break;
+    case hipDeviceAttributeComputeCapabilityMinor:
+        *pi = prop.minor;
+        break;
+    default:
+        *pi = 0;
+        break;
+    }
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipDeviceSynchronize()
+{
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipMemGetInfo(size_t* free, size_t* total)
+{
+    if(free)
+        *free = NULL_DEVICE_MEMORY;
+    if(total)
+        *total = NULL_DEVICE_MEMORY;
+    return hipSuccess;
+}
+
+/*******************************************************************************
+ * Errors
+ ******************************************************************************/
+extern "C" hipError_t hipGetLastError()
+{
+    hipError_t error = last_error;
+    last_error       = hipSuccess;
+    return error;
+}
+
+extern "C" hipError_t hipPeekAtLastError()
+{
+    return last_error;
+}
+
+extern "C" const char* hipGetErrorName(hipError_t error)
+{
+    switch(error)
+    {
+    case hipSuccess:
+        return "hipSuccess";
+    case hipErrorInvalidValue:
+        return "hipErrorInvalidValue";
+    case hipErrorOutOfMemory:
+        return "hipErrorOutOfMemory";
+    case hipErrorInvalidDevice:
+        return "hipErrorInvalidDevice";
+    case hipErrorInvalidDevicePointer:
+        return "hipErrorInvalidDevicePointer";
+    default:
+        return "hipErrorUnknown";
+    }
+}
+
+extern "C" const char* hipGetErrorString(hipError_t error)
+{
+    return hipGetErrorName(error);
+}
+
+/*******************************************************************************
+ * Memory
+ ******************************************************************************/
+extern "C" hipError_t hipMalloc(void** ptr, size_t size)
+{
+    if(!ptr)
+        return status(hipErrorInvalidValue);
+    *ptr = device().allocate(size);
+    return *ptr ? hipSuccess : status(hipErrorOutOfMemory);
+}
+
+extern "C" hipError_t hipMallocManaged(void** ptr, size_t size, unsigned int flags)
+{
+    return hipMalloc(ptr, size);
+}
+
+extern "C" hipError_t hipHostMalloc(void** ptr, size_t size, unsigned int flags)
+{
+    return hipMalloc(ptr, size);
+}
+
+extern "C" hipError_t hipFree(void* ptr)
+{
+    return device().release(ptr) ? hipSuccess : status(hipErrorInvalidDevicePointer);
+}
+
+extern "C" hipError_t hipHostFree(void* ptr)
+{
+    return hipFree(ptr);
+}
+
+extern "C" hipError_t hipHostRegister(void* hostPtr, size_t sizeBytes, unsigned int flags)
+{
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipHostUnregister(void* hostPtr)
+{
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipPointerGetAttributes(hipPointerAttribute_t* attributes, const void* ptr)
+{
+    if(!attributes)
+        return status(hipErrorInvalidValue);
+
+    memset(attributes, 0, sizeof(*attributes));
+    if(!device().find(ptr))
+        return status(hipErrorInvalidValue);
+
+    attributes->memoryType    = hipMemoryTypeDevice;
+    attributes->devicePointer = const_cast<void*>(ptr);
+    attributes->hostPointer   = const_cast<void*>(ptr);
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipMemcpy(void* dst, const void* src, size_t sizeBytes, hipMemcpyKind kind)
+{
+    device().copy(dst, src, sizeBytes);
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipMemcpyAsync(
+    void* dst, const void* src, size_t sizeBytes, hipMemcpyKind kind, hipStream_t stream)
+{
+    return hipMemcpy(dst, src, sizeBytes, kind);
+}
+
+extern "C" hipError_t hipMemcpy2D(void*         dst,
+                                  size_t        dpitch,
+                                  const void*   src,
+                                  size_t        spitch,
+                                  size_t        width,
+                                  size_t        height,
+                                  hipMemcpyKind kind)
+{
+    if(width > dpitch || width > spitch)
+        return status(hipErrorInvalidValue);
+    for(size_t row = 0; row < height; ++row)
+        device().copy(static_cast<char*>(dst) + row * dpitch,
+                      static_cast<const char*>(src) + row * spitch,
+                      width);
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipMemcpy2DAsync(void*         dst,
+                                       size_t        dpitch,
+                                       const void*   src,
+                                       size_t        spitch,
+                                       size_t        width,
+                                       size_t        height,
+                                       hipMemcpyKind kind,
+                                       hipStream_t   stream)
+{
+    return hipMemcpy2D(dst, dpitch, src, spitch, width, height, kind);
+}
+
+extern "C" hipError_t hipMemset(void* dst, int value, size_t sizeBytes)
+{
+    if(sizeBytes)
+        memset(dst, value, sizeBytes);
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipMemsetAsync(void* dst, int value, size_t sizeBytes, hipStream_t stream)
+{
+    return hipMemset(dst, value, sizeBytes);
+}
+
+/*******************************************************************************
+ * Streams and events
+ *
+ * Work completes when it is issued, so streams are always idle.
+ ******************************************************************************/
+extern "C" hipError_t hipStreamCreateWithFlags(hipStream_t* stream, unsigned int flags)
+{
+    if(!stream)
+        return status(hipErrorInvalidValue);
+    *stream = new ihipStream_t;
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipStreamCreate(hipStream_t* stream)
+{
+    return hipStreamCreateWithFlags(stream, 0);
+}
+
+extern "C" hipError_t hipStreamDestroy(hipStream_t stream)
+{
+    delete stream;
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipStreamSynchronize(hipStream_t stream)
+{
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipStreamQuery(hipStream_t stream)
+{
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipStreamWaitEvent(hipStream_t stream, hipEvent_t event, unsigned int flags)
+{
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipStreamAddCallback(hipStream_t         stream,
+                                           hipStreamCallback_t callback,
+                                           void*               userData,
+                                           unsigned int        flags)
+{
+    if(!callback)
+        return status(hipErrorInvalidValue);
+    callback(stream, hipSuccess, userData);
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipEventCreateWithFlags(hipEvent_t* event, unsigned flags)
+{
+    if(!event)
+        return status(hipErrorInvalidValue);
+    *event = new ihipEvent_t{std::chrono::steady_clock::now()};
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipEventCreate(hipEvent_t* event)
+{
+    return hipEventCreateWithFlags(event, 0);
+}
+
+extern "C" hipError_t hipEventDestroy(hipEvent_t event)
+{
+    delete event;
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipEventRecord(hipEvent_t event, hipStream_t stream)
+{
+    if(!event)
+        return status(hipErrorInvalidValue);
+    event->time = std::chrono::steady_clock::now();
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipEventSynchronize(hipEvent_t event)
+{
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipEventQuery(hipEvent_t event)
+{
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipEventElapsedTime(float* ms, hipEvent_t start, hipEvent_t stop)
+{
+    if(!ms || !start || !stop)
+        return status(hipErrorInvalidValue);
+    *ms = std::chrono::duration<float, std::milli>(stop->time - start->time).count();
+    return hipSuccess;
+}
+
+/*******************************************************************************
+ * Kernels compiled into the program, launched with <<< >>> or hipLaunchKernelGGL
+ ******************************************************************************/
+extern "C" void** __hipRegisterFatBinary(const void* data)
+{
+    static void* modules = nullptr;
+    return &modules;
+}
+
+extern "C" void __hipUnregisterFatBinary(void** modules) {}
+
+extern "C" void __hipRegisterFunction(void**       modules,
+                                      const void*  hostFunction,
+                                      char*        deviceFunction,
+                                      const char*  deviceName,
+                                      unsigned int threadLimit,
+                                      void*        tid,
+                                      void*        bid,
+                                      dim3*        blockDim,
+                                      dim3*        gridDim,
+                                      int*         wSize)
+{
+    device().register_kernel(hostFunction, deviceName);
+}
+
+extern "C" void __hipRegisterVar(void** modules,
+                                 void*  var,
+                                 char*  hostVar,
+                                 char*  deviceVar,
+                                 int    ext,
+                                 size_t size,
+                                 int    constant,
+                                 int    global)
+{
+}
+
+extern "C" hipError_t
+    __hipPushCallConfiguration(dim3 gridDim, dim3 blockDim, size_t sharedMem, hipStream_t stream)
+{
+    call_configurations.emplace_back(gridDim, blockDim, sharedMem, stream);
+    return hipSuccess;
+}
+
+extern "C" hipError_t __hipPopCallConfiguration(dim3*        gridDim,
+                                                dim3*        blockDim,
+                                                size_t*      sharedMem,
+                                                hipStream_t* stream)
+{
+    if(call_configurations.empty())
+        return status(hipErrorInvalidConfiguration);
+    std::tie(*gridDim, *blockDim, *sharedMem, *stream) = call_configurations.back();
+    call_configurations.pop_back();
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipLaunchKernel(const void* function_address,
+                                      dim3        numBlocks,
+                                      dim3        dimBlocks,
+                                      void**      args,
+                                      size_t      sharedMemBytes,
+                                      hipStream_t stream)
+{
+    device().launch(function_address);
+    return hipSuccess;
+}
+
+/*******************************************************************************
+ * Code objects loaded at run time, such as the Tensile libraries
+ ******************************************************************************/
+extern "C" hipError_t hipModuleLoadData(hipModule_t* module, const void* image)
+{
+    if(!module || !image)
+        return status(hipErrorInvalidValue);
+    *module = new ihipModule_t;
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipModuleLoad(hipModule_t* module, const char* fname)
+{
+    return hipModuleLoadData(module, fname);
+}
+
+extern "C" hipError_t hipModuleUnload(hipModule_t module)
+{
+    delete module;
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipModuleGetFunction(hipFunction_t* function,
+                                           hipModule_t    module,
+                                           const char*    kname)
+{
+    if(!function || !module || !kname)
+        return status(hipErrorInvalidValue);
+    *function = device().function(kname);
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipModuleLaunchKernel(hipFunction_t f,
+                                            unsigned int  gridDimX,
+                                            unsigned int  gridDimY,
+                                            unsigned int  gridDimZ,
+                                            unsigned int  blockDimX,
+                                            unsigned int  blockDimY,
+                                            unsigned int  blockDimZ,
+                                            unsigned int  sharedMemBytes,
+                                            hipStream_t   stream,
+                                            void**        kernelParams,
+                                            void**        extra)
+{
+    device().launch(f);
+    return hipSuccess;
+}
+
+extern "C" hipError_t hipExtModuleLaunchKernel(hipFunction_t f,
+                                               uint32_t      globalWorkSizeX,
+                                               uint32_t      globalWorkSizeY,
+                                               uint32_t      globalWorkSizeZ,
+                                               uint32_t      localWorkSizeX,
+                                               uint32_t      localWorkSizeY,
+                                               uint32_t      localWorkSizeZ,
+                                               size_t        sharedMemBytes,
+                                               hipStream_t   hStream,
+                                               void**        kernelParams,
+                                               void**        extra,
+                                               hipEvent_t    startEvent,
+                                               hipEvent_t    stopEvent,
+                                               uint32_t      flags)
+{
+    if(startEvent)
+        hipEventRecord(startEvent, hStream);
+    device().launch(f);
+    if(stopEvent)
+        hipEventRecord(stopEvent, hStream);
+    return hipSuccess;
+}
+
+/*******************************************************************************
+ * Counters of the work issued to the null device, for benchmarks which are run
+ * with it. They can be found with dlsym(RTLD_DEFAULT, ...), so that benchmarks do
+ * not depend on this library.
+ ******************************************************************************/
+extern "C" void rocblas_null_device_get_stats(size_t* kernel_launches,
+                                              size_t* copies,
+                                              size_t* copy_bytes)
+{
+    if(kernel_launches)
+        *kernel_launches = device().kernel_launches;
+    if(copies)
+        *copies = device().copies;
+    if(copy_bytes)
+        *copy_bytes = device().copy_bytes;
+}
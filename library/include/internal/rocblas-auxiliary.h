@@ -51,6 +51,223 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_atomics_mode(rocblas_handle       hand
 ROCBLAS_EXPORT rocblas_status rocblas_get_atomics_mode(rocblas_handle        handle,
                                                        rocblas_atomics_mode* atomics_mode);
 
+/*! \brief set rocblas_gemm_batching_mode
+    \details
+    With rocblas_gemm_batching_deferred, rocblas_Xgemm calls on the handle whose m, n and k are
+    at most 256 are queued instead of launched. Queued calls with the same precision, transposes,
+    sizes, leading dimensions, alpha and beta are launched together as one batched gemm by
+    rocblas_flush_gemm_batches, or before any other rocBLAS work on the handle's stream,
+    including rocblas_get_stream and rocblas_set_stream. A call whose matrices overlap the C
+    matrix of a queued call launches the queue first, so the results are those of the calls in
+    order. Work on the stream outside rocBLAS, and rocblas_get_matrix, must follow a flush.
+    Setting rocblas_gemm_batching_none launches the queued calls.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    mode        [rocblas_gemm_batching_mode]
+                the gemm batching mode
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_batching_mode(rocblas_handle             handle,
+                                                             rocblas_gemm_batching_mode mode);
+
+/*! \brief get rocblas_gemm_batching_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_gemm_batching_mode(rocblas_handle              handle,
+                                                             rocblas_gemm_batching_mode* mode);
+
+/*! \brief launch the gemm calls queued by rocblas_gemm_batching_deferred
+    \details
+    Launches the queued gemm calls on the handle's stream, without synchronizing.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+
+    @return the first error of a launch of queued calls which has not already been returned
+            by a rocBLAS call.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_flush_gemm_batches(rocblas_handle handle);
+
+/*! \brief set rocblas_host_result_mode
+    \details
+    With rocblas_host_result_deferred, the results of rocblas_Xdot, rocblas_Xdotc, rocblas_Xnrm2,
+    rocblas_Xasum, rocblas_iXamax, rocblas_iXamin, their batched and strided batched variants,
+    and their _ex variants, which are returned to host pointers in rocblas_pointer_mode_host,
+    are not written before the call returns. They are copied to pinned memory in stream order,
+    and then written to the host pointers by a stream callback, so that several reductions
+    can be queued without synchronizing. The results are first written to device memory of the
+    handle, which device memory size queries include. The host pointers must stay valid, and
+    must not be read or passed to other calls, until rocblas_synchronize_host_results returns or
+    the event returned by rocblas_get_host_results_event completes. Setting
+    rocblas_host_result_blocking waits until the results in flight have been written.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    mode        [rocblas_host_result_mode]
+                the host result mode
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_host_result_mode(rocblas_handle           handle,
+                                                           rocblas_host_result_mode mode);
+
+/*! \brief get rocblas_host_result_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_host_result_mode(rocblas_handle            handle,
+                                                           rocblas_host_result_mode* mode);
+
+/*! \brief get the event marking when the deferred host results have been written
+    \details
+    The event is recorded on the handle's stream after each result of
+    rocblas_host_result_deferred, and completes once the results of the calls made before it
+    was last recorded have been written to their host pointers. The event belongs to the
+    handle, and must not be destroyed.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[out]
+    event       [hipEvent_t*]
+                the results ready event of the handle
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_host_results_event(rocblas_handle handle,
+                                                             hipEvent_t*    event);
+
+/*! \brief wait for the deferred host results
+    \details
+    Blocks until the results of rocblas_host_result_deferred which are in flight have been
+    written to their host pointers.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+
+    @return the first error of the copy of a result which has not already been returned.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_synchronize_host_results(rocblas_handle handle);
+
+/*! \brief set rocblas_trsm_inverse_cache_mode
+    \details
+    With rocblas_trsm_inverse_cache_enabled, rocblas_Xtrsm and rocblas_trsm_ex without a
+    supplied invA keep the inverses of the diagonal blocks of A which they compute with trtri,
+    in device memory owned by the handle. A later call with the same address, order, leading
+    dimension, fill, diagonal and precision of A reuses them instead of computing them again,
+    so A must not change while its inverses are cached. After changing a cached A, call
+    rocblas_set_trsm_inverse_generation with a new generation. The inverses of the 16 most
+    recently used matrices are kept, and the memory of older ones is reused for new ones
+    rather than freed, since freeing it waits for the device. Setting
+    rocblas_trsm_inverse_cache_none or a new generation frees all of it.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    mode        [rocblas_trsm_inverse_cache_mode]
+                the trsm inverse cache mode
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsm_inverse_cache_mode(
+    rocblas_handle handle, rocblas_trsm_inverse_cache_mode mode);
+
+/*! \brief get rocblas_trsm_inverse_cache_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_trsm_inverse_cache_mode(
+    rocblas_handle handle, rocblas_trsm_inverse_cache_mode* mode);
+
+/*! \brief set the generation of the matrices whose trsm inverses are cached
+    \details
+    Cached inverses are reused only by trsm calls made in the generation in which they were
+    computed. Setting a generation which differs from the current one frees the cached
+    inverses, so the contents of the matrices can change between generations. The initial
+    generation is 0.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    generation  [uint64_t]
+                the generation of the matrices of later trsm calls
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsm_inverse_generation(rocblas_handle handle,
+                                                                  uint64_t       generation);
+
+/*! \brief get the number of trsm calls which reused and which computed cached inverses
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[out]
+    hits        [size_t*]
+                number of trsm calls which reused the inverses of A
+    @param[out]
+    misses      [size_t*]
+                number of trsm calls which computed the inverses of A and cached them
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_trsm_inverse_cache_stats(rocblas_handle handle,
+                                                                   size_t*        hits,
+                                                                   size_t*        misses);
+
+/*! \brief start capturing the rocBLAS calls made on a handle
+    \details
+    Until rocblas_end_capture, the rocblas_Xgemm, rocblas_Xaxpy, rocblas_Xscal and rocblas_Xnrm2
+    calls made on the handle run as usual, and those which succeed are also recorded, resolved
+    past their logging, argument checks, workspace sizing and Tensile solution selection.
+    Scalars on the host are recorded by value. Other rocBLAS calls are not recorded.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+
+    @return rocblas_status_invalid_value if the handle is already capturing.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_begin_capture(rocblas_handle handle);
+
+/*! \brief stop capturing the rocBLAS calls made on a handle
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[out]
+    graph       [rocblas_graph*]
+                receives the graph of the captured calls, to be destroyed with
+                rocblas_graph_destroy
+
+    @return rocblas_status_invalid_value if the handle is not capturing.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_end_capture(rocblas_handle handle, rocblas_graph* graph);
+
+/*! \brief replay the calls of a graph on a handle
+    \details
+    Launches the kernels of the captured calls on the handle's stream, in order, without their
+    logging, argument checks, workspace sizing and Tensile solution selection. A pointer of a
+    captured call which lies in the captured buffer of a remap is replaced with the same offset
+    into its replacement, which gives the calls new matrices, vectors, results and scalars. A
+    scalar on the host whose address is not remapped keeps its captured value.
+    Calls go through their normal dispatch instead if the handle's device differs from that of
+    the capturing handle, if numerical checking is enabled, or if the workspace of the calls
+    cannot be allocated. A gemm whose captured Tensile solution cannot compute the replayed
+    problem goes through Tensile's solution selection.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    graph       [rocblas_graph]
+                the graph of the calls
+    @param[in]
+    remaps      [const rocblas_graph_remap*]
+                host array of remap_count remaps, whose captured buffers must not overlap
+    @param[in]
+    remap_count [rocblas_int]
+                the number of remaps
+
+    @return the status of the first call which fails, or rocblas_status_invalid_value if the
+            handle is capturing or the captured buffers overlap.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_graph_launch(rocblas_handle             handle,
+                                                   rocblas_graph              graph,
+                                                   const rocblas_graph_remap* remaps,
+                                                   rocblas_int                remap_count);
+
+/*! \brief get the number of calls captured in a graph
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_graph_get_node_count(rocblas_graph graph,
+                                                           rocblas_int*  node_count);
+
+/*! \brief destroy a graph returned by rocblas_end_capture
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_graph_destroy(rocblas_graph graph);
+
 /*! \brief query the preferable supported int8 input layout for gemm
      \details
     Indicates the supported int8 input layout for gemm according to the device.
@@ -66,6 +283,21 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_atomics_mode(rocblas_handle        han
 ROCBLAS_EXPORT rocblas_status rocblas_query_int8_layout_flag(rocblas_handle      handle,
                                                              rocblas_gemm_flags* flag);
 
+/*! \brief wait for and report deferred numerical checks
+    \details
+    With rocblas_check_numerics_mode_deferred set in ROCBLAS_CHECK_NUMERICS, numerical checks
+    are reported once their results have been copied back to the host, without synchronizing
+    the stream of each checked call. rocblas_synchronize_check_numerics waits for the pending
+    checks on the handle's stream and reports them.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+
+    @return rocblas_status_check_numerics_fail if a check in rocblas_check_numerics_mode_fail
+            found a NaN or Inf which has not already been returned by a rocBLAS call.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_synchronize_check_numerics(rocblas_handle handle);
+
 /*! \brief  Indicates whether the pointer is on the host or device.
  */
 ROCBLAS_EXPORT rocblas_pointer_mode rocblas_pointer_to_mode(void* ptr);
@@ -234,6 +466,110 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_async(rocblas_int rows,
                                                        rocblas_int ldb,
                                                        hipStream_t stream);
 
+/*! \brief asynchronously copy matrix from host to device in column panels
+     \details
+    rocblas_set_matrix_async_panels copies a matrix from host memory to device memory
+    asynchronously, in panels of panel_cols columns. The panels are transferred concurrently on
+    internal streams, after the work already queued on stream, and work queued on stream
+    afterwards waits for all panels.
+    panel_events[i] is recorded when panel i has arrived on the device, so that work on panel i can
+    wait on it with hipStreamWaitEvent while the following panels are still being transferred.
+
+    If the host memory is allocated with hipHostMalloc or registered with hipHostRegister, the call
+    returns once every panel is queued. Otherwise the panels are staged through pinned buffers, and
+    the call returns when the host matrix has been read.
+    @param[in]
+    rows        [rocblas_int]
+                number of rows in matrices
+    @param[in]
+    cols        [rocblas_int]
+                number of columns in matrices
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrix
+    @param[in]
+    a           pointer to matrix on the host
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of A
+    @param[out]
+    b           pointer to matrix on the GPU
+    @param[in]
+    ldb         [rocblas_int]
+                specifies the leading dimension of B
+    @param[in]
+    panel_cols  [rocblas_int]
+                number of columns in each panel, except the last
+    @param[in]
+    panel_events [hipEvent_t*]
+                array of (cols + panel_cols - 1) / panel_cols events created by the caller,
+                or nullptr
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_matrix_async_panels(rocblas_int rows,
+                                                              rocblas_int cols,
+                                                              rocblas_int elem_size,
+                                                              const void* a,
+                                                              rocblas_int lda,
+                                                              void*       b,
+                                                              rocblas_int ldb,
+                                                              rocblas_int panel_cols,
+                                                              hipEvent_t* panel_events,
+                                                              hipStream_t stream);
+
+/*! \brief asynchronously copy matrix from device to host in column panels
+     \details
+    rocblas_get_matrix_async_panels copies a matrix from device memory to host memory
+    asynchronously, in panels of panel_cols columns. The panels are transferred concurrently on
+    internal streams, after the work already queued on stream, and work queued on stream
+    afterwards waits for all panels.
+    panel_events[i] is recorded when panel i has been read from the device.
+
+    If the host memory is allocated with hipHostMalloc or registered with hipHostRegister, the call
+    returns once every panel is queued, and panel i is in host memory when panel_events[i] has
+    completed. Otherwise the panels are staged through pinned buffers, and the call returns when the
+    host matrix has been written.
+    @param[in]
+    rows        [rocblas_int]
+                number of rows in matrices
+    @param[in]
+    cols        [rocblas_int]
+                number of columns in matrices
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrix
+    @param[in]
+    a           pointer to matrix on the GPU
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of A
+    @param[out]
+    b           pointer to matrix on the host
+    @param[in]
+    ldb         [rocblas_int]
+                specifies the leading dimension of B
+    @param[in]
+    panel_cols  [rocblas_int]
+                number of columns in each panel, except the last
+    @param[in]
+    panel_events [hipEvent_t*]
+                array of (cols + panel_cols - 1) / panel_cols events created by the caller,
+                or nullptr
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_async_panels(rocblas_int rows,
+                                                              rocblas_int cols,
+                                                              rocblas_int elem_size,
+                                                              const void* a,
+                                                              rocblas_int lda,
+                                                              void*       b,
+                                                              rocblas_int ldb,
+                                                              rocblas_int panel_cols,
+                                                              hipEvent_t* panel_events,
+                                                              hipStream_t stream);
+
 /*******************************************************************************
  * Function to set start/stop event handlers (for internal use only)
  ******************************************************************************/
@@ -254,6 +590,47 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_start_stop_events(rocblas_handle handl
 ROCBLAS_EXPORT rocblas_status rocblas_set_solution_fitness_query(rocblas_handle handle,
                                                                  double*        fitness);
 
+/*! \brief force the Tensile solution used by gemm-like calls
+    \details
+    Gemm-like calls on the handle which are computed by Tensile use the solution with the given
+    index, instead of the solution selected by Tensile or by the tuning database. The calls
+    return rocblas_status_invalid_value if the solution does not exist or cannot compute their
+    problem. rocblas_gemm_ex and its variants with algo rocblas_gemm_algo_solution_index use
+    their solution_index argument instead.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    index       the index of the solution, or -1 to restore the default selection
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_solution_index(rocblas_handle handle, int32_t index);
+
+/*! \brief get the Tensile solution index forced by rocblas_set_solution_index
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_solution_index(rocblas_handle handle, int32_t* index);
+
+/*! \brief query the Tensile solutions which can compute gemm-like calls
+    \details
+    While a query is set, gemm-like calls on the handle which are computed by Tensile are not
+    computed. Instead, each call stores the number of solutions which can compute its problem
+    in count, and the indices of up to capacity of them, in increasing order, in indices.
+    rocblas_gemm_strided_batched_ex skips its argument checks, so its matrices may be nullptr.
+    It is used by rocblas-bench --tune to time each of the candidate solutions.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[out]
+    indices     host array of capacity solution indices. May be nullptr if capacity is 0.
+    @param[in]
+    capacity    the number of elements of indices
+    @param[out]
+    count       the number of candidate solutions, or nullptr to end the query
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_solution_candidates_query(rocblas_handle handle,
+                                                                    int32_t*       indices,
+                                                                    rocblas_int    capacity,
+                                                                    rocblas_int*   count);
+
 /*! \brief specifies the performance metric that solution selection uses
      \details
     Determines which performance metric will be used by Tensile when selecting the optimal solution
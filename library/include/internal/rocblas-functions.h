@@ -2640,6 +2640,95 @@ ROCBLAS_EXPORT rocblas_status rocblas_drotmg_strided_batched(rocblas_handle hand
                                                              rocblas_stride stride_param,
                                                              rocblas_int    batch_count);
 
+ROCBLAS_EXPORT rocblas_status rocblas_svector_stats(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    const float*   x,
+                                                    rocblas_int    incx,
+                                                    const float*   y,
+                                                    rocblas_int    incy,
+                                                    float*         nrm2,
+                                                    float*         asum,
+                                                    rocblas_int*   amax,
+                                                    float*         dot);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dvector_stats(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    const double*  x,
+                                                    rocblas_int    incx,
+                                                    const double*  y,
+                                                    rocblas_int    incy,
+                                                    double*        nrm2,
+                                                    double*        asum,
+                                                    rocblas_int*   amax,
+                                                    double*        dot);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cvector_stats(rocblas_handle               handle,
+                                                    rocblas_int                  n,
+                                                    const rocblas_float_complex* x,
+                                                    rocblas_int                  incx,
+                                                    const rocblas_float_complex* y,
+                                                    rocblas_int                  incy,
+                                                    float*                       nrm2,
+                                                    float*                       asum,
+                                                    rocblas_int*                 amax,
+                                                    rocblas_float_complex*       dot);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    vector_stats computes a selection of nrm2, asum, iamax and dotc of a real or complex vector
+    in one pass over the vectors, instead of reading them once per statistic
+
+              nrm2 := sqrt( x**H*x )
+              asum := sum( |Re(x_i)| + |Im(x_i)| )
+              amax := the first index of the element of x with the largest |Re(x_i)| + |Im(x_i)|,
+                      starting from 1
+              dot  := x**H*y
+
+    Each statistic is computed if its result pointer is not null, and is the result of
+    rocblas_Xnrm2, rocblas_Xasum, rocblas_iXamax or rocblas_Xdotc up to rounding.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer storing vector y. y is only read if dot is not null.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    nrm2      device pointer or host pointer to store the euclidean norm of x, or null.
+    @param[inout]
+    asum      device pointer or host pointer to store the sum of magnitudes of x, or null.
+    @param[inout]
+    amax      device pointer or host pointer to store the index of the maximum magnitude of x,
+              or null.
+    @param[inout]
+    dot       device pointer or host pointer to store the dot product of x and y, or null.
+              The results are 0 if n <= 0. If incx <= 0, nrm2, asum and amax are 0, as they are
+              in rocblas_Xnrm2, rocblas_Xasum and rocblas_iXamax, but dot is computed with incx,
+              as it is in rocblas_Xdotc. Returns rocblas_status_invalid_pointer if all of the
+              result pointers are null.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zvector_stats(rocblas_handle                handle,
+                                                    rocblas_int                   n,
+                                                    const rocblas_double_complex* x,
+                                                    rocblas_int                   incx,
+                                                    const rocblas_double_complex* y,
+                                                    rocblas_int                   incy,
+                                                    double*                       nrm2,
+                                                    double*                       asum,
+                                                    rocblas_int*                  amax,
+                                                    rocblas_double_complex*       dot);
+
 /*
  * ===========================================================================
  *    level 2 BLAS
@@ -13586,6 +13675,123 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemm(rocblas_handle                handle
                                             rocblas_double_complex*       C,
                                             rocblas_int                   ldc);
 
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_ooc(rocblas_handle    handle,
+                                                rocblas_operation transA,
+                                                rocblas_operation transB,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                const float*      alpha,
+                                                const float*      A,
+                                                rocblas_int       lda,
+                                                const float*      B,
+                                                rocblas_int       ldb,
+                                                const float*      beta,
+                                                float*            C,
+                                                rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_ooc(rocblas_handle    handle,
+                                                rocblas_operation transA,
+                                                rocblas_operation transB,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                const double*     alpha,
+                                                const double*     A,
+                                                rocblas_int       lda,
+                                                const double*     B,
+                                                rocblas_int       ldb,
+                                                const double*     beta,
+                                                double*           C,
+                                                rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_ooc(rocblas_handle               handle,
+                                                rocblas_operation            transA,
+                                                rocblas_operation            transB,
+                                                rocblas_int                  m,
+                                                rocblas_int                  n,
+                                                rocblas_int                  k,
+                                                const rocblas_float_complex* alpha,
+                                                const rocblas_float_complex* A,
+                                                rocblas_int                  lda,
+                                                const rocblas_float_complex* B,
+                                                rocblas_int                  ldb,
+                                                const rocblas_float_complex* beta,
+                                                rocblas_float_complex*       C,
+                                                rocblas_int                  ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEMM_OOC performs the matrix-matrix operation of xGEMM,
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    out of core: A, B and C are in host memory, and may be larger than device memory.
+    Tiles of the matrices are streamed through the handle's device memory, which must
+    hold two tiles each of A, B and C. Copies of the next tiles of A and B to the device,
+    the multiplication of the current tiles, and copies of finished tiles of C back to the
+    host are overlapped on separate streams. The tiling is chosen to fit the device memory
+    available in the handle; a device memory size query returns the size for 64 x 64 x 64
+    tiles, and larger workspaces allow larger, more efficient tiles.
+
+    The copies only overlap the multiplications when the host memory is pinned, for
+    example with hipHostMalloc. The function returns when C has been updated on the host.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A )
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B )
+    @param[in]
+    m         [rocblas_int]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [rocblas_int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_ooc(rocblas_handle                handle,
+                                                rocblas_operation             transA,
+                                                rocblas_operation             transB,
+                                                rocblas_int                   m,
+                                                rocblas_int                   n,
+                                                rocblas_int                   k,
+                                                const rocblas_double_complex* alpha,
+                                                const rocblas_double_complex* A,
+                                                rocblas_int                   lda,
+                                                const rocblas_double_complex* B,
+                                                rocblas_int                   ldb,
+                                                const rocblas_double_complex* beta,
+                                                rocblas_double_complex*       C,
+                                                rocblas_int                   ldc);
+
 ROCBLAS_EXPORT rocblas_status rocblas_sgemm_batched(rocblas_handle     handle,
                                                     rocblas_operation  transA,
                                                     rocblas_operation  transB,
@@ -14880,6 +15086,130 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex(rocblas_handle    handle,
                         flags)
 // clang-format on
 
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_EPILOGUE_EX performs rocblas_gemm_ex followed by an epilogue:
+
+        D = alpha*op( A )*op( B ) + beta*C,
+        output(i,j) = activation( D(i,j) * scale + bias ),
+
+    where scale and bias are optional vectors with one element per row or per column of D,
+    and activation is one of rocblas_activation. The epilogue is computed in compute_type,
+    and its result overwrites D, or is converted to the type of a separate output matrix,
+    in a single pass over D. The epilogue supports compute_type rocblas_datatype_f16_r and
+    rocblas_datatype_f64_r with the same d_type, and rocblas_datatype_f32_r with d_type
+    rocblas_datatype_f16_r, rocblas_datatype_bf16_r or rocblas_datatype_f32_r. The output
+    type may be any of these real types.
+
+    The arguments other than epilogue are as in rocblas_gemm_ex.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    a         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    b         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    @param[in, out]
+    d         [void *]
+              device pointer storing matrix D.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    epilogue  [const rocblas_gemm_epilogue *]
+              host pointer to the epilogue. Its scale and bias are device arrays of compute_type.
+              Its output, if not nullptr, must not overlap D unless it is D with ldo == ldd.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              reserved for future use.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_epilogue_ex(rocblas_handle               handle,
+                                                       rocblas_operation            transA,
+                                                       rocblas_operation            transB,
+                                                       rocblas_int                  m,
+                                                       rocblas_int                  n,
+                                                       rocblas_int                  k,
+                                                       const void*                  alpha,
+                                                       const void*                  a,
+                                                       rocblas_datatype             a_type,
+                                                       rocblas_int                  lda,
+                                                       const void*                  b,
+                                                       rocblas_datatype             b_type,
+                                                       rocblas_int                  ldb,
+                                                       const void*                  beta,
+                                                       const void*                  c,
+                                                       rocblas_datatype             c_type,
+                                                       rocblas_int                  ldc,
+                                                       void*                        d,
+                                                       rocblas_datatype             d_type,
+                                                       rocblas_int                  ldd,
+                                                       rocblas_datatype             compute_type,
+                                                       const rocblas_gemm_epilogue* epilogue,
+                                                       rocblas_gemm_algo            algo,
+                                                       int32_t                      solution_index,
+                                                       uint32_t                     flags);
+
 /*! \brief BLAS EX API
     \details
     GEMM_BATCHED_EX performs one of the batched matrix-matrix operations
@@ -15072,6 +15402,137 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex(rocblas_handle    handle,
                                                       int32_t           solution_index,
                                                       uint32_t          flags);
 
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_GROUPED_EX performs groups of batched matrix-matrix operations, where each group g
+    has its own sizes, leading dimensions and scalars:
+
+        D_i = alpha_g*op(A_i)*op(B_i) + beta_g*C_i, for each of the group_size[g] problems i of group g
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    The problems of group 0 come first in the pointer arrays a, b, c and d, followed by those of
+    group 1, and so on. All groups share the data types, which are supported as in
+    rocblas_gemm_batched_ex. Groups with the same transposes, sizes, leading dimensions and
+    scalars are computed together in one batched operation, so a call costs about as many kernel
+    launches as it has distinct problem shapes.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    group_count
+              [rocblas_int]
+              number of groups.
+    @param[in]
+    transA    [const rocblas_operation *]
+              host array of the form of op( A ) for each group.
+    @param[in]
+    transB    [const rocblas_operation *]
+              host array of the form of op( B ) for each group.
+    @param[in]
+    m         [const rocblas_int *]
+              host array of matrix dimension m for each group.
+    @param[in]
+    n         [const rocblas_int *]
+              host array of matrix dimension n for each group.
+    @param[in]
+    k         [const rocblas_int *]
+              host array of matrix dimension k for each group.
+    @param[in]
+    alpha     [const void *]
+              device array or host array of the scalar alpha for each group. Same datatype as compute_type.
+    @param[in]
+    a         [void *]
+              device pointer storing array of pointers to each matrix A_i.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [const rocblas_int *]
+              host array of the leading dimension of each A_i for each group.
+    @param[in]
+    b         [void *]
+              device pointer storing array of pointers to each matrix B_i.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [const rocblas_int *]
+              host array of the leading dimension of each B_i for each group.
+    @param[in]
+    beta      [const void *]
+              device array or host array of the scalar beta for each group. Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device array of device pointers to each matrix C_i.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [const rocblas_int *]
+              host array of the leading dimension of each C_i for each group.
+    @param[out]
+    d         [void *]
+              device array of device pointers to each matrix D_i.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of each matrix D_i.
+    @param[in]
+    ldd       [const rocblas_int *]
+              host array of the leading dimension of each D_i for each group.
+    @param[in]
+    group_size
+              [const rocblas_int *]
+              host array of the number of gemm operations in each group.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              reserved for future use.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_grouped_ex(rocblas_handle           handle,
+                                                      rocblas_int              group_count,
+                                                      const rocblas_operation* transA,
+                                                      const rocblas_operation* transB,
+                                                      const rocblas_int*       m,
+                                                      const rocblas_int*       n,
+                                                      const rocblas_int*       k,
+                                                      const void*              alpha,
+                                                      const void*              a,
+                                                      rocblas_datatype         a_type,
+                                                      const rocblas_int*       lda,
+                                                      const void*              b,
+                                                      rocblas_datatype         b_type,
+                                                      const rocblas_int*       ldb,
+                                                      const void*              beta,
+                                                      const void*              c,
+                                                      rocblas_datatype         c_type,
+                                                      const rocblas_int*       ldc,
+                                                      void*                    d,
+                                                      rocblas_datatype         d_type,
+                                                      const rocblas_int*       ldd,
+                                                      const rocblas_int*       group_size,
+                                                      rocblas_datatype         compute_type,
+                                                      rocblas_gemm_algo        algo,
+                                                      int32_t                  solution_index,
+                                                      uint32_t                 flags);
+
 /*! \brief BLAS EX API
 
     \details
@@ -15650,6 +16111,138 @@ ROCBLAS_EXPORT rocblas_status rocblas_trsm_ex(rocblas_handle    handle,
                         compute_type)
 // clang-format on
 
+/*! BLAS EX API
+
+    \details
+    rocblas_trsm_operator_create prepares the triangular matrix A of TRSM_EX for solves with
+    many right-hand side matrices B. It computes the inverses of the diagonal blocks of A
+    once, in device memory owned by the operator, which rocblas_trsm_operator_apply then
+    reuses instead of computing them on every run.
+
+    The operator refers to A, which must stay allocated and unchanged until the operator is
+    destroyed with rocblas_trsm_operator_destroy. The inverses are computed on the handle's
+    stream, so an operator applied on another stream must be synchronized with it first.
+
+    @param[in]
+    handle  [rocblas_handle]
+            handle to the rocblas library context queue.
+
+    @param[in]
+    side    [rocblas_side]
+            rocblas_side_left:       op(A)*X = alpha*B.
+            rocblas_side_right:      X*op(A) = alpha*B.
+
+    @param[in]
+    uplo    [rocblas_fill]
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a lower triangular matrix.
+
+    @param[in]
+    transA  [rocblas_operation]
+            rocblas_operation_none:      op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    diag    [rocblas_diagonal]
+            rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    k       [rocblas_int]
+            k specifies the order of A, which is m when rocblas_side_left and is n when
+            rocblas_side_right. k >= 0.
+
+    @param[in]
+    A       [void *]
+            device pointer storing matrix A of dimension ( lda, k ).
+            only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     [rocblas_int]
+            lda specifies the first dimension of A. lda >= max( 1, k ).
+
+    @param[in]
+    compute_type [rocblas_datatype]
+            specifies the datatype of computation
+
+    @param[out]
+    op      [rocblas_trsm_operator*]
+            receives the prepared operator.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_operator_create(rocblas_handle         handle,
+                                                           rocblas_side           side,
+                                                           rocblas_fill           uplo,
+                                                           rocblas_operation      transA,
+                                                           rocblas_diagonal       diag,
+                                                           rocblas_int            k,
+                                                           const void*            A,
+                                                           rocblas_int            lda,
+                                                           rocblas_datatype       compute_type,
+                                                           rocblas_trsm_operator* op);
+
+/*! BLAS EX API
+
+    \details
+    rocblas_trsm_operator_apply solves
+
+        op(A)*X = alpha*B or X*op(A) = alpha*B,
+
+    with the A, side, uplo, transA and diag of a prepared operator, as TRSM_EX does with the
+    inverses of the diagonal blocks of A which the operator holds. The matrix X is overwritten
+    on B.
+
+    @param[in]
+    handle  [rocblas_handle]
+            handle to the rocblas library context queue.
+
+    @param[in]
+    op      [rocblas_trsm_operator]
+            the operator returned by rocblas_trsm_operator_create.
+
+    @param[in]
+    m       [rocblas_int]
+            m specifies the number of rows of B. m is the k of the operator when
+            rocblas_side_left.
+
+    @param[in]
+    n       [rocblas_int]
+            n specifies the number of columns of B. n is the k of the operator when
+            rocblas_side_right.
+
+    @param[in]
+    alpha   [void *]
+            device pointer or host pointer specifying the scalar alpha, of the compute_type
+            of the operator.
+
+    @param[in, out]
+    B       [void *]
+            device pointer storing matrix B of dimension ( ldb, n ), which is overwritten by
+            the solution matrix X.
+
+    @param[in]
+    ldb    [rocblas_int]
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_operator_apply(rocblas_handle        handle,
+                                                          rocblas_trsm_operator op,
+                                                          rocblas_int           m,
+                                                          rocblas_int           n,
+                                                          const void*           alpha,
+                                                          void*                 B,
+                                                          rocblas_int           ldb);
+
+/*! BLAS EX API
+
+    \details
+    rocblas_trsm_operator_destroy frees an operator returned by rocblas_trsm_operator_create,
+    and the inverses of the diagonal blocks of A which it holds.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_operator_destroy(rocblas_trsm_operator op);
+
 /*! BLAS EX API
 
     \details
@@ -17068,10 +17661,92 @@ ROCBLAS_EXPORT rocblas_status rocblas_scal_strided_batched_ex(rocblas_handle   h
 ROCBLAS_EXPORT const char* rocblas_status_to_string(rocblas_status status);
 
 /* \brief Initialize rocBLAS on the current HIP device, to avoid costly startup time at the first call on that device.
+    All of the device's Tensile code objects are loaded, rather than when their kernels are first launched.
 */
 
 ROCBLAS_EXPORT void rocblas_initialize(void);
 
+/*! BLAS Auxiliary API
+
+    \details
+    rocblas_get_solution_cache_stats
+
+    Returns the number of hits and misses of the Tensile solution cache of the handle's device.
+    Repeated gemm-like calls with the same problem shape, types, flags and atomics mode reuse the
+    Tensile solution selected for the first call, instead of repeating solution selection.
+    The cache holds 1024 entries by default, which can be changed with the
+    ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE environment variable (0 disables the cache).
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if hits or misses is nullptr; rocblas_status_success otherwise
+
+    @param[in]
+    handle  [rocblas_handle]
+            the handle of device
+    @param[out]
+    hits    number of solution selections served from the cache
+    @param[out]
+    misses  number of solution selections which went through Tensile
+*/
+
+ROCBLAS_EXPORT rocblas_status rocblas_get_solution_cache_stats(rocblas_handle handle,
+                                                               size_t*        hits,
+                                                               size_t*        misses);
+
+/*! BLAS Auxiliary API
+
+    \details
+    rocblas_get_tensile_load_stats
+
+    Returns the time taken to initialize Tensile for the handle's device, and how many of the
+    device's Tensile code objects have been loaded. Code objects are indexed when Tensile is
+    initialized, and each is loaded when a kernel it defines is first launched. rocblas_initialize
+    loads all code objects, as does implicit initialization when the ROCBLAS_TENSILE_LAZY_LOAD
+    environment variable is set to 0.
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if startup_ms, loaded_code_objects or total_code_objects is nullptr; rocblas_status_success otherwise
+
+    @param[in]
+    handle  [rocblas_handle]
+            the handle of device
+    @param[out]
+    startup_ms          milliseconds taken to initialize Tensile for the device
+    @param[out]
+    loaded_code_objects number of code objects loaded for the device
+    @param[out]
+    total_code_objects  number of code objects available for the device
+*/
+
+ROCBLAS_EXPORT rocblas_status rocblas_get_tensile_load_stats(rocblas_handle handle,
+                                                             double*        startup_ms,
+                                                             size_t*        loaded_code_objects,
+                                                             size_t*        total_code_objects);
+
+/*! BLAS Auxiliary API
+
+    \details
+    rocblas_get_tuning_db_stats
+
+    Returns the number of entries of the tuning database for the handle's device, and the number
+    of solution selections they have served. The tuning database is read from the file named by
+    the ROCBLAS_TENSILE_TUNING_DB environment variable when Tensile is initialized for the device,
+    and is written by rocblas-bench --tune. Its entries give the Tensile solution to use for a
+    problem, instead of the solution selected by Tensile.
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if entries or hits is nullptr; rocblas_status_success otherwise
+
+    @param[in]
+    handle  [rocblas_handle]
+            the handle of device
+    @param[out]
+    entries number of entries for the device's architecture
+    @param[out]
+    hits    number of solution selections served by the tuning database
+*/
+
+ROCBLAS_EXPORT rocblas_status rocblas_get_tuning_db_stats(rocblas_handle handle,
+                                                          size_t*        entries,
+                                                          size_t*        hits);
+
 /*
  * ===========================================================================
  *    build information
@@ -17150,6 +17825,35 @@ ROCBLAS_EXPORT void           rocblas_device_malloc_set_default_memory_size(size
  ******************************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_size(rocblas_handle handle, size_t* size);
 
+/*! \brief
+    \details
+    Gets statistics of the device memory for the handle.
+    When rocBLAS manages device memory, it grows by adding further allocations instead of
+    reallocating, so allocated can exceed the largest amount of memory in use at once.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if allocated or high_water is nullptr; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[out]
+    allocated       total device memory currently allocated for the handle
+    @param[out]
+    high_water      largest amount of device memory in use at once since the handle was created
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_stats(rocblas_handle handle,
+                                                              size_t*        allocated,
+                                                              size_t*        high_water);
+
+/*! \brief
+    \details
+    Frees the rocBLAS-managed device memory of the handle which is not in use.
+    Device memory set with rocblas_set_device_memory_size or rocblas_set_workspace is not freed.
+    Since freeing device memory synchronizes the device, this should be called outside of
+    performance-critical sections, such as after a warm-up phase.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_memory_error if freeing fails; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trim_device_memory(rocblas_handle handle);
+
 /*! \brief
     \details
     Changes the size of allocated device memory at runtime.
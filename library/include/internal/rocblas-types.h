@@ -40,6 +40,19 @@
  */
 typedef struct _rocblas_handle* rocblas_handle;
 
+/*! \brief rocblas_graph holds a sequence of rocBLAS calls captured on a handle
+ * between rocblas_begin_capture() and rocblas_end_capture(), which
+ * rocblas_graph_launch() replays. It should be destroyed using rocblas_graph_destroy().
+ */
+typedef struct _rocblas_graph* rocblas_graph;
+
+/*! \brief rocblas_trsm_operator holds a triangular matrix A prepared for solves by
+ * rocblas_trsm_operator_create(), with the inverses of its diagonal blocks, which
+ * rocblas_trsm_operator_apply() reuses for each right-hand side matrix B.
+ * It should be destroyed using rocblas_trsm_operator_destroy().
+ */
+typedef struct _rocblas_trsm_operator* rocblas_trsm_operator;
+
 // Forward declaration of hipStream_t
 typedef struct ihipStream_t* hipStream_t;
 
@@ -211,6 +224,39 @@ typedef enum rocblas_atomics_mode_
     rocblas_atomics_allowed = 1,
 } rocblas_atomics_mode;
 
+/*! \brief Indicates whether small gemm calls are launched when they are made, or queued
+*    and launched together in batches of calls with the same arguments */
+typedef enum rocblas_gemm_batching_mode_
+{
+    /*! \brief Each gemm call is launched when it is made */
+    rocblas_gemm_batching_none = 0,
+    /*! \brief Small gemm calls are queued, and launched by rocblas_flush_gemm_batches or
+     *    before other work on the handle's stream */
+    rocblas_gemm_batching_deferred = 1,
+} rocblas_gemm_batching_mode;
+
+/*! \brief Indicates whether the results of reductions to host pointers are written before
+*    the call returns, or in stream order */
+typedef enum rocblas_host_result_mode_
+{
+    /*! \brief Results to host pointers are written before the call returns */
+    rocblas_host_result_blocking = 0,
+    /*! \brief Results to host pointers are written in stream order, and can be read after
+     *    rocblas_synchronize_host_results or the event of rocblas_get_host_results_event */
+    rocblas_host_result_deferred = 1,
+} rocblas_host_result_mode;
+
+/*! \brief Indicates whether trsm keeps the inverses of the diagonal blocks of A, which it
+*    computes with trtri, for later calls with the same A */
+typedef enum rocblas_trsm_inverse_cache_mode_
+{
+    /*! \brief The inverses are computed by each trsm call */
+    rocblas_trsm_inverse_cache_none = 0,
+    /*! \brief The inverses are kept by the handle and reused by trsm calls with the same A,
+     *    until the generation set with rocblas_set_trsm_inverse_generation changes */
+    rocblas_trsm_inverse_cache_enabled = 1,
+} rocblas_trsm_inverse_cache_mode;
+
 /*! \brief Indicates which performance metric Tensile uses when selecting the optimal
 *    solution for gemm problems.  */
 typedef enum rocblas_performance_metric_
@@ -240,7 +286,9 @@ typedef enum rocblas_layer_mode_
 /*! \brief Indicates if layer is active with bitmask*/
 typedef enum rocblas_gemm_algo_
 {
-    rocblas_gemm_algo_standard = 0x0,
+    rocblas_gemm_algo_standard       = 0x0,
+    /*! \brief Use the Tensile solution given by solution_index */
+    rocblas_gemm_algo_solution_index = 0x1,
 } rocblas_gemm_algo;
 
 /*! \brief Control flags passed into gemm algorithms invoked by Tensile Host */
@@ -257,6 +305,50 @@ typedef enum rocblas_gemm_flags_
     rocblas_gemm_flags_use_cu_efficiency = 0x2
 } rocblas_gemm_flags;
 
+/*! \brief Activation function applied by a gemm epilogue */
+typedef enum rocblas_activation_
+{
+    rocblas_activation_none = 0, /**< Identity. */
+    rocblas_activation_relu = 1, /**< max(x, 0). */
+    rocblas_activation_gelu = 2, /**< GELU, with the tanh approximation. */
+} rocblas_activation;
+
+/*! \brief Indexing of a gemm epilogue vector */
+typedef enum rocblas_epilogue_vector_
+{
+    rocblas_epilogue_vector_none   = 0, /**< The vector is not used. */
+    rocblas_epilogue_vector_row    = 1, /**< One element per row of D, for m elements. */
+    rocblas_epilogue_vector_column = 2, /**< One element per column of D, for n elements. */
+} rocblas_epilogue_vector;
+
+/*! \brief Operations applied to the result of a gemm, as in
+    output(i,j) = activation( D(i,j) * scale + bias ), in the compute type */
+typedef struct rocblas_gemm_epilogue_
+{
+    /*! \brief Device array of compute_type scale factors, indexed by scale_mode */
+    const void*             scale;
+    rocblas_epilogue_vector scale_mode;
+    /*! \brief Device array of compute_type bias values, indexed by bias_mode */
+    const void*             bias;
+    rocblas_epilogue_vector bias_mode;
+    rocblas_activation      activation;
+    /*! \brief Device matrix of output_type receiving the result with leading dimension ldo,
+        or nullptr to overwrite D */
+    void*            output;
+    rocblas_datatype output_type;
+    rocblas_int      ldo;
+} rocblas_gemm_epilogue;
+
+/*! \brief Replacement of a buffer of the calls of a rocblas_graph, used by rocblas_graph_launch.
+    Pointers into [captured, captured + size) are replaced with the same offsets into
+    replacement. */
+typedef struct rocblas_graph_remap_
+{
+    const void* captured;
+    void*       replacement;
+    size_t      size;
+} rocblas_graph_remap;
+
 /*! \brief Union for representing scalar values */
 typedef union rocblas_union_u
 {
@@ -285,6 +377,10 @@ typedef enum rocblas_check_numerics_mode_
     //Return 'rocblas_status_check_numeric_fail' status if there is NaN or Inf
     rocblas_check_numerics_mode_fail = 0x4,
 
+    //Report the checks without synchronizing, once their results have reached the host;
+    //a NaN or Inf found in fail mode is returned by a later check or by rocblas_synchronize_check_numerics
+    rocblas_check_numerics_mode_deferred = 0x8,
+
 } rocblas_check_numerics_mode;
 
 #endif
@@ -305,6 +305,46 @@ module rocblas
         end function rocblas_get_matrix_async
     end interface
 
+    interface
+        function rocblas_set_matrix_async_panels(rows, cols, elem_size, a, lda, b, ldb, &
+                panel_cols, panel_events, stream) &
+                result(c_int) &
+                bind(c, name = 'rocblas_set_matrix_async_panels')
+            use iso_c_binding
+            implicit none
+            integer(c_int), value :: rows
+            integer(c_int), value :: cols
+            integer(c_int), value :: elem_size
+            type(c_ptr), value :: a
+            integer(c_int), value :: lda
+            type(c_ptr), value :: b
+            integer(c_int), value :: ldb
+            integer(c_int), value :: panel_cols
+            type(c_ptr), value :: panel_events
+            type(c_ptr), value :: stream
+        end function rocblas_set_matrix_async_panels
+    end interface
+
+    interface
+        function rocblas_get_matrix_async_panels(rows, cols, elem_size, a, lda, b, ldb, &
+                panel_cols, panel_events, stream) &
+                result(c_int) &
+                bind(c, name = 'rocblas_get_matrix_async_panels')
+            use iso_c_binding
+            implicit none
+            integer(c_int), value :: rows
+            integer(c_int), value :: cols
+            integer(c_int), value :: elem_size
+            type(c_ptr), value :: a
+            integer(c_int), value :: lda
+            type(c_ptr), value :: b
+            integer(c_int), value :: ldb
+            integer(c_int), value :: panel_cols
+            type(c_ptr), value :: panel_events
+            type(c_ptr), value :: stream
+        end function rocblas_get_matrix_async_panels
+    end interface
+
     interface
         function rocblas_set_start_stop_events(handle, start_event, stop_event) &
                 result(c_int) &
@@ -2410,6 +2450,83 @@ module rocblas
         end function rocblas_izamin_strided_batched
     end interface
 
+    ! vector_stats
+    interface
+        function rocblas_svector_stats(handle, n, x, incx, y, incy, nrm2, asum, amax, dot) &
+                result(c_int) &
+                bind(c, name = 'rocblas_svector_stats')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: nrm2
+            type(c_ptr), value :: asum
+            type(c_ptr), value :: amax
+            type(c_ptr), value :: dot
+        end function rocblas_svector_stats
+    end interface
+
+    interface
+        function rocblas_dvector_stats(handle, n, x, incx, y, incy, nrm2, asum, amax, dot) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dvector_stats')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: nrm2
+            type(c_ptr), value :: asum
+            type(c_ptr), value :: amax
+            type(c_ptr), value :: dot
+        end function rocblas_dvector_stats
+    end interface
+
+    interface
+        function rocblas_cvector_stats(handle, n, x, incx, y, incy, nrm2, asum, amax, dot) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cvector_stats')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: nrm2
+            type(c_ptr), value :: asum
+            type(c_ptr), value :: amax
+            type(c_ptr), value :: dot
+        end function rocblas_cvector_stats
+    end interface
+
+    interface
+        function rocblas_zvector_stats(handle, n, x, incx, y, incy, nrm2, asum, amax, dot) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zvector_stats')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: nrm2
+            type(c_ptr), value :: asum
+            type(c_ptr), value :: amax
+            type(c_ptr), value :: dot
+        end function rocblas_zvector_stats
+    end interface
+
     ! rot
     interface
         function rocblas_srot(handle, n, x, incx, y, incy, c, s) &
@@ -10924,6 +11041,107 @@ module rocblas
         end function rocblas_zgemm
     end interface
 
+    ! gemm_ooc
+    interface
+        function rocblas_sgemm_ooc(handle, transA, transB, m, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgemm_ooc')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_sgemm_ooc
+    end interface
+
+    interface
+        function rocblas_dgemm_ooc(handle, transA, transB, m, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgemm_ooc')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_dgemm_ooc
+    end interface
+
+    interface
+        function rocblas_cgemm_ooc(handle, transA, transB, m, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgemm_ooc')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_cgemm_ooc
+    end interface
+
+    interface
+        function rocblas_zgemm_ooc(handle, transA, transB, m, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgemm_ooc')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_zgemm_ooc
+    end interface
+
     ! gemm_batched
     interface
         function rocblas_hgemm_batched(handle, transA, transB, m, n, k, alpha, &
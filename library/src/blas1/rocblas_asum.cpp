@@ -26,6 +26,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         static constexpr bool           isbatched     = false;
         static constexpr rocblas_stride stridex_0     = 0;
         static constexpr rocblas_int    batch_count_1 = 1;
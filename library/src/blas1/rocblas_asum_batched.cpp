@@ -29,6 +29,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         static constexpr bool           isbatched = true;
         static constexpr rocblas_stride stridex_0 = 0;
 
@@ -34,6 +34,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         static constexpr bool isbatched = true;
 
         return rocblas_reduction_impl<NB,
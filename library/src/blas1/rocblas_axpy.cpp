@@ -34,6 +34,40 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
+        // Calls made while the handle is capturing are run and recorded by its graph
+        if(auto* graph = handle->get_capture())
+        {
+            _rocblas_graph::scalar_t<T> alpha_s(alpha, handle->pointer_mode);
+            return graph->capture(
+                handle,
+                0,
+                [=](rocblas_handle                  handle,
+                    const _rocblas_graph::remapper& remap,
+                    void*,
+                    bool                            resolved) -> rocblas_status {
+                    auto alpha_r = alpha_s(remap);
+                    if(!resolved || n <= 0)
+                        return rocblas_axpy_impl<NB>(handle,
+                                                     n,
+                                                     alpha_r,
+                                                     remap(x),
+                                                     incx,
+                                                     remap(y),
+                                                     incy,
+                                                     name,
+                                                     bench_name);
+
+                    if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha_r == 0)
+                        return rocblas_status_success;
+
+                    return rocblas_internal_axpy_template<NB, T>(
+                        handle, n, alpha_r, 0, remap(x), 0, incx, 0, remap(y), 0, incy, 0, 1);
+                });
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
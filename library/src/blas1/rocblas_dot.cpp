@@ -47,13 +47,17 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T2>(n);
         if(handle->is_device_memory_size_query())
         {
             if(n <= 0)
                 return rocblas_status_size_unchanged;
             else
-                return handle->set_optimal_device_memory_size(dev_bytes);
+                return handle->set_optimal_device_memory_size(
+                    dev_bytes, handle->host_results_size(sizeof(T) * 1));
         }
 
         auto layer_mode     = handle->layer_mode;
@@ -117,8 +121,11 @@ namespace
                 return dot_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_internal_dot_template<NB, CONJ, T>(
-            handle, n, x, 0, incx, 0, y, 0, incy, 0, 1, result, (T2*)w_mem);
+        auto dot = [&](T* dst) {
+            return rocblas_internal_dot_template<NB, CONJ, T>(
+                handle, n, x, 0, incx, 0, y, 0, incy, 0, 1, dst, (T2*)w_mem);
+        };
+        rocblas_status status = handle->reduce_to_host_results(result, sizeof(T) * 1, dot);
         if(status != rocblas_status_success)
             return status;
 
@@ -30,6 +30,9 @@ namespace
         static constexpr rocblas_int    batch_count_1 = 1;
         static constexpr int            NB            = 1024;
 
+        rocblas_profile_scope profile_scope(handle);
+
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, rocblas_index_value_t<S>>(
@@ -72,16 +75,19 @@ namespace
         {
             return rocblas_status_memory_error;
         }
+        auto iamax = [&](rocblas_int* dst) {
+            return rocblas_internal_iamax_template<NB, isbatched>(handle,
+                                                                  n,
+                                                                  x,
+                                                                  shiftx_0,
+                                                                  incx,
+                                                                  stridex_0,
+                                                                  batch_count_1,
+                                                                  dst,
+                                                                  (rocblas_index_value_t<S>*)w_mem);
+        };
         rocblas_status status
-            = rocblas_internal_iamax_template<NB, isbatched>(handle,
-                                                             n,
-                                                             x,
-                                                             shiftx_0,
-                                                             incx,
-                                                             stridex_0,
-                                                             batch_count_1,
-                                                             result,
-                                                             (rocblas_index_value_t<S>*)w_mem);
+            = handle->reduce_to_host_results(result, sizeof(rocblas_int) * batch_count_1, iamax);
         if(status != rocblas_status_success)
             return status;
 
@@ -35,6 +35,9 @@ namespace
         static constexpr rocblas_int shiftx_0  = 0;
         static constexpr int         NB        = 1024;
 
+        rocblas_profile_scope profile_scope(handle);
+
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, rocblas_index_value_t<S>>(
@@ -77,16 +80,19 @@ namespace
         {
             return rocblas_status_memory_error;
         }
+        auto iamin = [&](rocblas_int* dst) {
+            return rocblas_internal_iamin_template<NB, isbatched>(handle,
+                                                                  n,
+                                                                  x,
+                                                                  shiftx_0,
+                                                                  incx,
+                                                                  stridex,
+                                                                  batch_count,
+                                                                  dst,
+                                                                  (rocblas_index_value_t<S>*)w_mem);
+        };
         rocblas_status status
-            = rocblas_internal_iamin_template<NB, isbatched>(handle,
-                                                             n,
-                                                             x,
-                                                             shiftx_0,
-                                                             incx,
-                                                             stridex,
-                                                             batch_count,
-                                                             result,
-                                                             (rocblas_index_value_t<S>*)w_mem);
+            = handle->reduce_to_host_results(result, sizeof(rocblas_int) * batch_count, iamin);
         if(status != rocblas_status_success)
             return status;
 
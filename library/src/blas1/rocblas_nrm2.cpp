@@ -32,6 +32,31 @@ namespace
         static constexpr rocblas_int    batch_count_1 = 1;
         static constexpr rocblas_int    shiftx_0      = 0;
 
+        // Calls made while the handle is capturing are run and recorded by its graph
+        if(handle && handle->get_capture())
+            return handle->get_capture()->capture(
+                handle,
+                rocblas_reduction_kernel_workspace_size<NB, To>(n, batch_count_1),
+                [=](rocblas_handle                  handle,
+                    const _rocblas_graph::remapper& remap,
+                    void*                           workspace,
+                    bool                            resolved) -> rocblas_status {
+                    if(!resolved || n <= 0 || incx <= 0)
+                        return rocblas_nrm2_impl<NB>(handle, n, remap(x), incx, remap(results));
+                    return rocblas_internal_nrm2_template<NB, isbatched>(handle,
+                                                                         n,
+                                                                         remap(x),
+                                                                         shiftx_0,
+                                                                         incx,
+                                                                         stridex_0,
+                                                                         batch_count_1,
+                                                                         remap(results),
+                                                                         (To*)workspace);
+                });
+
+        rocblas_profile_scope profile_scope(handle);
+
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, To>(handle,
@@ -73,8 +98,12 @@ namespace
         {
             return rocblas_status_memory_error;
         }
-        rocblas_status status = rocblas_internal_nrm2_template<NB, isbatched>(
-            handle, n, x, shiftx_0, incx, stridex_0, batch_count_1, results, (To*)w_mem);
+        auto nrm2 = [&](To* dst) {
+            return rocblas_internal_nrm2_template<NB, isbatched>(
+                handle, n, x, shiftx_0, incx, stridex_0, batch_count_1, dst, (To*)w_mem);
+        };
+        rocblas_status status
+            = handle->reduce_to_host_results(results, sizeof(To) * batch_count_1, nrm2);
         if(status != rocblas_status_success)
             return status;
 
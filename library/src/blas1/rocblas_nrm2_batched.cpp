@@ -33,6 +33,9 @@ namespace
         static constexpr rocblas_int    shiftx_0  = 0;
         static constexpr rocblas_stride stridex_0 = 0;
 
+        rocblas_profile_scope profile_scope(handle);
+
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, To>(handle,
@@ -74,8 +77,12 @@ namespace
         {
             return rocblas_status_memory_error;
         }
-        rocblas_status status = rocblas_internal_nrm2_template<NB, isbatched>(
-            handle, n, x, shiftx_0, incx, stridex_0, batch_count, results, (To*)w_mem);
+        auto nrm2 = [&](To* dst) {
+            return rocblas_internal_nrm2_template<NB, isbatched>(
+                handle, n, x, shiftx_0, incx, stridex_0, batch_count, dst, (To*)w_mem);
+        };
+        rocblas_status status
+            = handle->reduce_to_host_results(results, sizeof(To) * batch_count, nrm2);
         if(status != rocblas_status_success)
             return status;
 
@@ -155,6 +155,8 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
         return rocblas_status_invalid_handle;
     }
 
+    handle->launch_deferred_gemms();
+
     size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB, Tw>(n, batch_count);
 
     if(handle->is_device_memory_size_query())
@@ -165,7 +167,8 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
         }
         else
         {
-            return handle->set_optimal_device_memory_size(dev_bytes);
+            return handle->set_optimal_device_memory_size(
+                dev_bytes, handle->host_results_size(sizeof(Tr) * batch_count));
         }
     }
 
@@ -238,6 +241,8 @@ rocblas_status rocblas_reduction_impl(rocblas_handle handle,
                                       const char*    name,
                                       const char*    name_bench)
 {
+    rocblas_profile_scope profile_scope(handle);
+
     size_t         dev_bytes     = 0;
     rocblas_status checks_status = rocblas_reduction_setup<NB, ISBATCHED, Tw>(
         handle, n, x, incx, stridex, batch_count, results, name, name_bench, dev_bytes);
@@ -264,8 +269,12 @@ rocblas_status rocblas_reduction_impl(rocblas_handle handle,
     }
 
     static constexpr rocblas_int shiftx_0 = 0;
-    rocblas_status status = rocblas_reduction_template<NB, ISBATCHED, FETCH, REDUCE, FINALIZE>(
-        handle, n, x, shiftx_0, incx, stridex, batch_count, results, (Tw*)w_mem);
+    auto reduction = [&](Tr* dst) {
+        return rocblas_reduction_template<NB, ISBATCHED, FETCH, REDUCE, FINALIZE>(
+            handle, n, x, shiftx_0, incx, stridex, batch_count, dst, (Tw*)w_mem);
+    };
+    rocblas_status status
+        = handle->reduce_to_host_results(results, sizeof(Tr) * batch_count, reduction);
     if(status != rocblas_status_success)
         return status;
 
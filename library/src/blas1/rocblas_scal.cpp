@@ -32,6 +32,27 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
+        // Calls made while the handle is capturing are run and recorded by its graph
+        if(auto* graph = handle->get_capture())
+        {
+            _rocblas_graph::scalar_t<U> alpha_s(alpha, handle->pointer_mode);
+            return graph->capture(
+                handle,
+                0,
+                [=](rocblas_handle                  handle,
+                    const _rocblas_graph::remapper& remap,
+                    void*,
+                    bool                            resolved) -> rocblas_status {
+                    if(!resolved || n <= 0 || incx <= 0)
+                        return rocblas_scal_impl<NB>(handle, n, alpha_s(remap), remap(x), incx);
+                    return rocblas_internal_scal_template<NB, T>(
+                        handle, n, alpha_s(remap), 0, remap(x), 0, incx, 0, 1);
+                });
+        }
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
@@ -0,0 +1,284 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_vector_stats.hpp"
+#include "check_numerics_vector.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr int NB = 512;
+
+    template <typename>
+    constexpr char rocblas_vector_stats_name[] = "unknown";
+    template <>
+    constexpr char rocblas_vector_stats_name<float>[] = "rocblas_svector_stats";
+    template <>
+    constexpr char rocblas_vector_stats_name<double>[] = "rocblas_dvector_stats";
+    template <>
+    constexpr char rocblas_vector_stats_name<rocblas_float_complex>[] = "rocblas_cvector_stats";
+    template <>
+    constexpr char rocblas_vector_stats_name<rocblas_double_complex>[] = "rocblas_zvector_stats";
+
+    template <typename T>
+    rocblas_status rocblas_vector_stats_check_numerics(rocblas_handle handle,
+                                                       rocblas_int    n,
+                                                       const T*       x,
+                                                       rocblas_int    incx,
+                                                       const T*       y,
+                                                       rocblas_int    incy,
+                                                       bool           is_input)
+    {
+        auto           check_numerics = handle->check_numerics;
+        rocblas_status status
+            = rocblas_internal_check_numerics_vector_template(rocblas_vector_stats_name<T>,
+                                                              handle,
+                                                              n,
+                                                              x,
+                                                              0,
+                                                              incx,
+                                                              0,
+                                                              1,
+                                                              check_numerics,
+                                                              is_input);
+        if(status != rocblas_status_success || !y)
+            return status;
+        return rocblas_internal_check_numerics_vector_template(rocblas_vector_stats_name<T>,
+                                                               handle,
+                                                               n,
+                                                               y,
+                                                               0,
+                                                               incy,
+                                                               0,
+                                                               1,
+                                                               check_numerics,
+                                                               is_input);
+    }
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_vector_stats_impl(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const T*       x,
+                                             rocblas_int    incx,
+                                             const T*       y,
+                                             rocblas_int    incy,
+                                             real_t<T>*     nrm2,
+                                             real_t<T>*     asum,
+                                             rocblas_int*   amax,
+                                             T*             dot)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
+        using To = rocblas_vector_stats_t<T>;
+
+        // nrm2, asum and amax are 0 for incx <= 0, as in their own routines, but dot is not
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB, To>(n);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || (incx <= 0 && !dot))
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(
+                    dev_bytes, handle->host_results_size(sizeof(To)));
+        }
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_vector_stats_name<T>,
+                      n,
+                      x,
+                      incx,
+                      y,
+                      incy,
+                      nrm2 != nullptr,
+                      asum != nullptr,
+                      amax != nullptr,
+                      dot != nullptr);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_vector_stats_name<T>,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "nrm2",
+                        nrm2 != nullptr,
+                        "asum",
+                        asum != nullptr,
+                        "amax",
+                        amax != nullptr,
+                        "dot",
+                        dot != nullptr);
+
+        // At least one statistic must be requested
+        if(!nrm2 && !asum && !amax && !dot)
+            return rocblas_status_invalid_pointer;
+
+        // Quick return if possible. nrm2, asum and amax are 0 for incx <= 0, as in their own
+        // routines, but the dot product is computed for any incx, as in rocblas_Xdotc.
+        if(n <= 0 || incx <= 0)
+        {
+            T* dot_zero = n <= 0 ? dot : nullptr;
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+            {
+                if(nrm2)
+                    RETURN_IF_HIP_ERROR(
+                        hipMemsetAsync(nrm2, 0, sizeof(*nrm2), handle->get_stream()));
+                if(asum)
+                    RETURN_IF_HIP_ERROR(
+                        hipMemsetAsync(asum, 0, sizeof(*asum), handle->get_stream()));
+                if(amax)
+                    RETURN_IF_HIP_ERROR(
+                        hipMemsetAsync(amax, 0, sizeof(*amax), handle->get_stream()));
+                if(dot_zero)
+                    RETURN_IF_HIP_ERROR(
+                        hipMemsetAsync(dot_zero, 0, sizeof(*dot_zero), handle->get_stream()));
+            }
+            else
+            {
+                if(nrm2)
+                    *nrm2 = 0;
+                if(asum)
+                    *asum = 0;
+                if(amax)
+                    *amax = 0;
+                if(dot_zero)
+                    *dot_zero = T(0);
+            }
+
+            if(n <= 0 || !dot)
+                return rocblas_status_success;
+            nrm2 = asum = nullptr;
+            amax        = nullptr;
+        }
+
+        if(!x || (dot && !y))
+            return rocblas_status_invalid_pointer;
+
+        // y is only read for dot
+        if(!dot)
+            y = nullptr;
+
+        auto w_mem = handle->device_malloc(dev_bytes, handle->host_results_size(sizeof(To)));
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(handle->check_numerics)
+        {
+            rocblas_status check_numerics_status
+                = rocblas_vector_stats_check_numerics(handle, n, x, incx, y, incy, true);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        const T* x_start = incx < 0 ? x - ptrdiff_t(incx) * (n - 1) : x;
+        const T* y_start = y && incy < 0 ? y - ptrdiff_t(incy) * (n - 1) : y;
+
+        auto stats = [&](real_t<T>* d_nrm2, real_t<T>* d_asum, rocblas_int* d_amax, T* d_dot) {
+            return rocblas_internal_vector_stats_template<NB>(handle,
+                                                              n,
+                                                              x_start,
+                                                              incx,
+                                                              y_start,
+                                                              incy,
+                                                              d_nrm2,
+                                                              d_asum,
+                                                              d_amax,
+                                                              d_dot,
+                                                              (To*)w_mem[0]);
+        };
+
+        // When results to host pointers are written in stream order, the statistics are
+        // computed in device memory, from which each requested one is posted
+        rocblas_status status;
+        if(handle->defer_host_results())
+        {
+            auto r = (To*)w_mem[1];
+            {
+                auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_device);
+                status = stats(nrm2 ? &r->nrm2 : nullptr,
+                               asum ? &r->asum : nullptr,
+                               amax ? &r->amax.index : nullptr,
+                               dot ? &r->dot : nullptr);
+            }
+            auto post = [&](void* dst, const void* src, size_t bytes) {
+                if(!dst || status != rocblas_status_success)
+                    return status;
+                return handle->host_results.post(handle->get_stream(), dst, src, bytes);
+            };
+            status = post(nrm2, &r->nrm2, sizeof(*nrm2));
+            status = post(asum, &r->asum, sizeof(*asum));
+            status = post(amax, &r->amax.index, sizeof(*amax));
+            status = post(dot, &r->dot, sizeof(*dot));
+        }
+        else
+            status = stats(nrm2, asum, amax, dot);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(handle->check_numerics)
+        {
+            rocblas_status check_numerics_status
+                = rocblas_vector_stats_check_numerics(handle, n, x, incx, y, incy, false);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/* ============================================================================================ */
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+#define IMPL(name_, type_, typer_)                                                            \
+    rocblas_status name_(rocblas_handle handle,                                               \
+                         rocblas_int    n,                                                    \
+                         const type_*   x,                                                    \
+                         rocblas_int    incx,                                                 \
+                         const type_*   y,                                                    \
+                         rocblas_int    incy,                                                 \
+                         typer_*        nrm2,                                                 \
+                         typer_*        asum,                                                 \
+                         rocblas_int*   amax,                                                 \
+                         type_*         dot)                                                  \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_vector_stats_impl(handle, n, x, incx, y, incy, nrm2, asum, amax, dot); \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+IMPL(rocblas_svector_stats, float, float);
+IMPL(rocblas_dvector_stats, double, double);
+IMPL(rocblas_cvector_stats, rocblas_float_complex, float);
+IMPL(rocblas_zvector_stats, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
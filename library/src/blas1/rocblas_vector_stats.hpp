@@ -0,0 +1,209 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "fetch_template.hpp"
+#include "handle.hpp"
+#include "reduction_strided_batched.hpp"
+#include "rocblas_iamax.hpp"
+
+// Statistics of x, and of x and y for dot, reduced together in one pass over the vectors
+template <typename T>
+struct rocblas_vector_stats_t
+{
+    real_t<T>                        nrm2; // Sum of squares until finalized
+    real_t<T>                        asum;
+    rocblas_index_value_t<real_t<T>> amax; // 0-based index until finalized
+    T                                dot;
+};
+
+template <typename T>
+struct rocblas_default_value<rocblas_vector_stats_t<T>>
+{
+    __forceinline__ __host__ __device__ constexpr auto operator()() const
+    {
+        rocblas_vector_stats_t<T> x{};
+        x.amax.index = -1;
+        return x;
+    }
+};
+
+//!
+//! @brief Struct-operator to fetch the statistics of x[index] and y[index]
+//!
+struct rocblas_fetch_vector_stats
+{
+    template <typename T>
+    __forceinline__ __device__ rocblas_vector_stats_t<T> operator()(T x, T y, rocblas_int index)
+    {
+        return {fetch_abs2(x), fetch_asum(x), {index, fetch_asum(x)}, y * conj(x)};
+    }
+};
+
+//!
+//! @brief Struct-operator to reduce each statistic as its own routine does
+//!
+struct rocblas_reduce_vector_stats
+{
+    template <typename T>
+    __forceinline__ __host__ __device__ void
+        operator()(rocblas_vector_stats_t<T>& __restrict__ x,
+                   const rocblas_vector_stats_t<T>& __restrict__ y)
+    {
+        x.nrm2 += y.nrm2;
+        x.asum += y.asum;
+        rocblas_reduce_amax{}(x.amax, y.amax);
+        x.dot += y.dot;
+    }
+};
+
+//!
+//! @brief Struct-operator to finalize the statistics as their own routines do
+//!
+struct rocblas_finalize_vector_stats
+{
+    template <typename T>
+    __forceinline__ __host__ __device__ auto operator()(rocblas_vector_stats_t<T> x)
+    {
+        x.nrm2       = sqrt(x.nrm2);
+        x.amax.index = rocblas_finalize_amax_amin{}(x.amax);
+        return x;
+    }
+};
+
+// kernel 1 writes the statistics of each thread block in workspace, reading y only for dot
+template <rocblas_int NB, typename FETCH, typename REDUCE, typename T, typename To>
+__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
+ROCBLAS_KERNEL void rocblas_vector_stats_kernel_part1(rocblas_int n,
+                                                      const T*    x,
+                                                      rocblas_int incx,
+                                                      const T*    y,
+                                                      rocblas_int incy,
+                                                      To*         workspace)
+{
+    ptrdiff_t     tx  = hipThreadIdx_x;
+    ptrdiff_t     tid = hipBlockIdx_x * hipBlockDim_x + tx;
+    __shared__ To tmp[NB];
+
+    // bound
+    if(tid < n)
+        tmp[tx] = FETCH{}(x[tid * incx], y ? y[tid * incy] : T(0), tid);
+    else
+        tmp[tx] = rocblas_default_value<To>{}(); // pad with default value
+
+    rocblas_reduction<NB, REDUCE>(tx, tmp);
+
+    if(tx == 0)
+        workspace[hipBlockIdx_x] = tmp[0];
+}
+
+// Writes the selected statistics to their device pointers
+template <typename T>
+ROCBLAS_KERNEL __launch_bounds__(1) void
+    rocblas_vector_stats_scatter_kernel(const rocblas_vector_stats_t<T>* stats,
+                                        real_t<T>*                       nrm2,
+                                        real_t<T>*                       asum,
+                                        rocblas_int*                     amax,
+                                        T*                               dot)
+{
+    if(nrm2)
+        *nrm2 = stats->nrm2;
+    if(asum)
+        *asum = stats->asum;
+    if(amax)
+        *amax = stats->amax.index;
+    if(dot)
+        *dot = stats->dot;
+}
+
+/*! \brief
+
+    \details
+    rocblas_internal_vector_stats_template computes the statistics of x which have a non-null
+    result pointer, and the dot product of x and y if dot is not null, reading x and y
+    once. The statistics are those of rocblas_Xnrm2, rocblas_Xasum, rocblas_iXamax and
+    rocblas_Xdotc, reduced with the kernels of rocblas_reduction_strided_batched_kernel.
+    n must be > 0, and incx must be > 0 unless only dot is requested. For negative incx or
+    incy, x or y must point to the last element, which is read first.
+    @param[in]
+    workspace rocblas_vector_stats_t<T>*
+              temporary GPU buffer of rocblas_reduction_kernel_workspace_size<NB,
+              rocblas_vector_stats_t<T>>(n) bytes
+    ********************************************************************/
+template <rocblas_int NB, typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_vector_stats_template(rocblas_handle             handle,
+                                           rocblas_int                n,
+                                           const T*                   x,
+                                           rocblas_int                incx,
+                                           const T*                   y,
+                                           rocblas_int                incy,
+                                           real_t<T>*                 nrm2,
+                                           real_t<T>*                 asum,
+                                           rocblas_int*               amax,
+                                           T*                         dot,
+                                           rocblas_vector_stats_t<T>* workspace)
+{
+    using To = rocblas_vector_stats_t<T>;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
+    To*         stats  = workspace + blocks;
+
+    hipLaunchKernelGGL((rocblas_vector_stats_kernel_part1<NB,
+                                                          rocblas_fetch_vector_stats,
+                                                          rocblas_reduce_vector_stats>),
+                       blocks,
+                       NB,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       x,
+                       incx,
+                       dot ? y : nullptr,
+                       incy,
+                       workspace);
+
+    // kernel 2 finalizes the statistics, so it is launched even for one block
+    hipLaunchKernelGGL(
+        (rocblas_reduction_strided_batched_kernel_part2<NB,
+                                                        rocblas_reduce_vector_stats,
+                                                        rocblas_finalize_vector_stats>),
+        1,
+        NB,
+        0,
+        handle->get_stream(),
+        blocks,
+        workspace,
+        stats);
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((rocblas_vector_stats_scatter_kernel<T>),
+                           1,
+                           1,
+                           0,
+                           handle->get_stream(),
+                           stats,
+                           nrm2,
+                           asum,
+                           amax,
+                           dot);
+    }
+    else
+    {
+        To res;
+        RETURN_IF_HIP_ERROR(hipMemcpy(&res, stats, sizeof(To), hipMemcpyDeviceToHost));
+        if(nrm2)
+            *nrm2 = res.nrm2;
+        if(asum)
+            *asum = res.asum;
+        if(amax)
+            *amax = res.amax.index;
+        if(dot)
+            *dot = res.dot;
+    }
+
+    return rocblas_status_success;
+}
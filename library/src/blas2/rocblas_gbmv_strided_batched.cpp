@@ -39,6 +39,10 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
+
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
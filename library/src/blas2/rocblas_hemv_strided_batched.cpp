@@ -32,6 +32,10 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
+
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         auto check_numerics = handle->check_numerics;
         if(!handle->is_device_memory_size_query())
         {
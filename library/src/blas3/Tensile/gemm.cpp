@@ -19,6 +19,122 @@ namespace
     template <>
     constexpr char rocblas_gemm_name<rocblas_double_complex>[] = "rocblas_zgemm";
 
+    /*******************************************************************************
+    * Deferred GEMM batching (rocblas_gemm_batching_deferred)
+    ******************************************************************************/
+    template <typename T>
+    rocblas_status rocblas_gemm_deferred_launch(rocblas_handle                     handle,
+                                                const rocblas_gemm_batcher::key_t& key,
+                                                const void* const*                 a,
+                                                const void* const*                 b,
+                                                void* const*                       c,
+                                                rocblas_int                        count)
+    {
+        auto alpha = reinterpret_cast<const T*>(key.alpha.data());
+        auto beta  = reinterpret_cast<const T*>(key.beta.data());
+
+        // The queued gemms are launched with the state of rocblas_Xgemm, not with the solution
+        // index or graph node of the call which launches the queue
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        auto saved_index = handle->push_solution_index(rocblas_gemm_algo_solution_index, -1);
+        auto saved_solution = handle->push_graph_solution(nullptr, false);
+
+        if(count == 1)
+            return rocblas_internal_gemm_template<false>(handle,
+                                                         key.trans_a,
+                                                         key.trans_b,
+                                                         key.m,
+                                                         key.n,
+                                                         key.k,
+                                                         alpha,
+                                                         static_cast<const T*>(a[0]),
+                                                         0,
+                                                         key.lda,
+                                                         0,
+                                                         static_cast<const T*>(b[0]),
+                                                         0,
+                                                         key.ldb,
+                                                         0,
+                                                         beta,
+                                                         static_cast<T*>(c[0]),
+                                                         0,
+                                                         key.ldc,
+                                                         0,
+                                                         1);
+
+        return rocblas_internal_gemm_template<true>(handle,
+                                                    key.trans_a,
+                                                    key.trans_b,
+                                                    key.m,
+                                                    key.n,
+                                                    key.k,
+                                                    alpha,
+                                                    reinterpret_cast<const T* const*>(a),
+                                                    0,
+                                                    key.lda,
+                                                    0,
+                                                    reinterpret_cast<const T* const*>(b),
+                                                    0,
+                                                    key.ldb,
+                                                    0,
+                                                    beta,
+                                                    reinterpret_cast<T* const*>(c),
+                                                    0,
+                                                    key.ldc,
+                                                    0,
+                                                    count);
+    }
+
+    // Bytes spanned by a rows x cols matrix
+    template <typename T>
+    size_t rocblas_gemm_matrix_bytes(rocblas_int rows, rocblas_int cols, rocblas_int ld)
+    {
+        return rows && cols ? (size_t(ld) * (cols - 1) + rows) * sizeof(T) : 0;
+    }
+
+    // Whether a gemm is queued by rocblas_gemm_batching_deferred, instead of launched. Only
+    // gemms whose alpha and beta are, or are copied, on the host are queued.
+    bool rocblas_gemm_deferrable(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k)
+    {
+        return handle->gemm_batching_mode == rocblas_gemm_batching_deferred
+               && !handle->check_numerics
+               && (handle->pointer_mode == rocblas_pointer_mode_host
+                   || rocblas_gemm_needs_host_scalars(handle))
+               && !handle->get_solution_candidates_query()
+               && std::max({m, n, k}) <= rocblas_gemm_batcher::MAX_SIZE;
+    }
+
+    // Queue a gemm whose alpha and beta are on the host
+    template <typename T>
+    rocblas_status rocblas_gemm_defer(rocblas_handle    handle,
+                                      rocblas_operation trans_a,
+                                      rocblas_operation trans_b,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      rocblas_int       k,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      rocblas_int       ld_a,
+                                      const T*          B,
+                                      rocblas_int       ld_b,
+                                      const T*          beta,
+                                      T*                C,
+                                      rocblas_int       ld_c)
+    {
+        rocblas_gemm_batcher::key_t key{
+            rocblas_gemm_deferred_launch<T>, trans_a, trans_b, m, n, k, ld_a, ld_b, ld_c, {}, {}};
+        memcpy(key.alpha.data(), alpha, sizeof(T));
+        memcpy(key.beta.data(), beta, sizeof(T));
+
+        bool   a_none  = trans_a == rocblas_operation_none;
+        bool   b_none  = trans_b == rocblas_operation_none;
+        size_t a_bytes = rocblas_gemm_matrix_bytes<T>(a_none ? m : k, a_none ? k : m, ld_a);
+        size_t b_bytes = rocblas_gemm_matrix_bytes<T>(b_none ? k : n, b_none ? n : k, ld_b);
+        size_t c_bytes = rocblas_gemm_matrix_bytes<T>(m, n, ld_c);
+
+        return handle->gemm_batcher.enqueue(handle, key, A, a_bytes, B, b_bytes, C, c_bytes);
+    }
+
     /*******************************************************************************
     * GEMM implementation
     ******************************************************************************/
@@ -41,13 +157,76 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        // A gemm which is queued launches the queue itself if it depends on a queued gemm
+        bool deferrable = rocblas_gemm_deferrable(handle, m, n, k);
+        if(!deferrable)
+            handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
 
-        // Copy alpha and beta to host if on device
-        T alpha_h, beta_h;
-        RETURN_IF_ROCBLAS_ERROR(
-            copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
-        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        // Calls made while the handle is capturing are run and recorded by its graph
+        if(auto* graph = handle->get_capture())
+        {
+            _rocblas_graph::scalar_t<T> alpha_s(alpha, handle->pointer_mode);
+            _rocblas_graph::scalar_t<T> beta_s(beta, handle->pointer_mode);
+            return graph->capture(
+                handle,
+                0,
+                [=](rocblas_handle                  handle,
+                    const _rocblas_graph::remapper& remap,
+                    void*,
+                    bool                            resolved) -> rocblas_status {
+                    if(!resolved)
+                        return rocblas_gemm_impl(handle,
+                                                 trans_a,
+                                                 trans_b,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha_s(remap),
+                                                 remap(A),
+                                                 ld_a,
+                                                 remap(B),
+                                                 ld_b,
+                                                 beta_s(remap),
+                                                 remap(C),
+                                                 ld_c);
+
+                    return rocblas_internal_gemm_template<false>(handle,
+                                                                 trans_a,
+                                                                 trans_b,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha_s(remap),
+                                                                 remap(A),
+                                                                 0,
+                                                                 ld_a,
+                                                                 0,
+                                                                 remap(B),
+                                                                 0,
+                                                                 ld_b,
+                                                                 0,
+                                                                 beta_s(remap),
+                                                                 remap(C),
+                                                                 0,
+                                                                 ld_c,
+                                                                 0,
+                                                                 1);
+                });
+        }
+
+        // In device pointer mode, the product A*B is held in device memory
+        if(handle->is_device_memory_size_query())
+            return rocblas_gemm_device_scalars_size(handle, m, n, k, 1, false, sizeof(T));
+
+        // Copy alpha and beta to host if on device, and if they are needed there
+        T    alpha_h, beta_h;
+        bool host_scalars = rocblas_gemm_needs_host_scalars(handle);
+        if(host_scalars)
+            RETURN_IF_ROCBLAS_ERROR(
+                copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+        auto saved_pointer_mode = handle->push_pointer_mode(
+            host_scalars ? rocblas_pointer_mode_host : handle->pointer_mode);
 
         // Perform logging
         auto layer_mode     = handle->layer_mode;
@@ -132,6 +311,11 @@ namespace
         if(validArgs != rocblas_status_continue)
             return validArgs;
 
+        // Small gemms with host scalars are queued, to be launched in batches
+        if(deferrable)
+            return rocblas_gemm_defer(
+                handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -364,10 +364,11 @@ inline rocblas_status tensile_helper(const rocblas_double_complex& alpha_h,
 #endif // USE_TENSILE_HOST
 
 /*********************************************************************************
- * Right now Tensile requires alpha and beta to be passed by value on host.      *
+ * Tensile requires alpha and beta to be passed by value on host.                *
  * If in device pointer mode, copy alpha and beta to host.                       *
  * If k == 0, we set alpha = 0 instead of copying from device.                   *
- * TODO: Make this asynchronous, putting synchronization closer to Tensile call. *
+ * With the Tensile host library, gemm only does this when the values are needed *
+ * on the host (see rocblas_gemm_needs_host_scalars below).                      *
  *********************************************************************************/
 template <typename T, typename Tc>
 rocblas_status copy_alpha_beta_to_host_if_on_device(
@@ -392,6 +393,45 @@ rocblas_status copy_alpha_beta_to_host_if_on_device(
     return rocblas_status_success;
 }
 
+/*********************************************************************************
+ * Whether gemm needs alpha and beta on the host. With the Tensile host library, *
+ * runContractionProblem() applies them on the device in device pointer mode, so *
+ * they are only needed on the host for logging. The legacy Tensile client takes *
+ * them by value.                                                                *
+ *********************************************************************************/
+inline bool rocblas_gemm_needs_host_scalars(rocblas_handle handle)
+{
+#ifdef USE_TENSILE_HOST
+    return handle->layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile);
+#else
+    return true;
+#endif
+}
+
+/*********************************************************************************
+ * Device memory size query of a gemm which gives Tensile no workspace. In       *
+ * device pointer mode, runContractionProblemDeviceScalars() holds A*B in the    *
+ * compute type until alpha and beta are applied, with an array of pointers into *
+ * it for batched gemms. Otherwise the size is 0.                                *
+ *********************************************************************************/
+inline rocblas_status rocblas_gemm_device_scalars_size(rocblas_handle handle,
+                                                       rocblas_int    m,
+                                                       rocblas_int    n,
+                                                       rocblas_int    k,
+                                                       rocblas_int    batch_count,
+                                                       bool           batched,
+                                                       size_t         compute_size)
+{
+    if(handle->pointer_mode == rocblas_pointer_mode_host || rocblas_gemm_needs_host_scalars(handle)
+       || m <= 0 || n <= 0 || k <= 0 || batch_count <= 0)
+        return rocblas_status_size_unchanged;
+
+    return handle->set_optimal_device_memory_size(batched ? batch_count * sizeof(void*) : 0,
+                                                  size_t(m) * n * batch_count * compute_size);
+}
+
 /*******************************************************************************
  * Tensile Function call
  ******************************************************************************/
@@ -602,12 +642,16 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(m == 0 || n == 0 || batch_count == 0)
         return rocblas_status_success;
 
+#ifndef USE_TENSILE_HOST
     T alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
         copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+#endif
 
     // When beta == 1 and either k == 0 or alpha == 0, the operation is a no-op
-    if(*beta == 1 && (k == 0 || *alpha == 0))
+    // In device pointer mode, this is checked on the device, after the product is computed
+    if(handle->pointer_mode == rocblas_pointer_mode_host && *beta == 1 && (k == 0 || *alpha == 0))
         return rocblas_status_success;
 
     return call_tensile(handle,
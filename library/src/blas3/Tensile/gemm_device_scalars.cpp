@@ -0,0 +1,352 @@
+/**************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ ************************************************************************** */
+
+// Gemm in device pointer mode, for the Tensile host library, which takes alpha and beta by value
+
+#ifdef USE_TENSILE_HOST
+
+#include "handle.hpp"
+#include "tensile_host.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // Round down to the alignment of device memory allocations
+    constexpr size_t rocblas_gemm_device_scalars_align(size_t size)
+    {
+        return size / 256 * 256;
+    }
+
+    // D = alpha*W + beta*C for each matrix of a batch, where W is the product A*B in the compute
+    // type, with leading dimension m. alpha and beta are read on the device.
+    template <int DIM_X, int DIM_Y, typename To, typename Tc, typename TConstPtr, typename TPtr>
+    ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void gemm_device_scalars_kernel(
+        rocblas_int    m,
+        rocblas_int    n,
+        bool           has_w,
+        const Tc*      alpha_device,
+        const Tc*      W,
+        rocblas_stride stride_w,
+        const Tc*      beta_device,
+        TConstPtr      C_array,
+        ptrdiff_t      shift_c,
+        rocblas_stride row_stride_c,
+        rocblas_stride col_stride_c,
+        rocblas_stride stride_c,
+        TPtr           D_array,
+        ptrdiff_t      shift_d,
+        rocblas_stride row_stride_d,
+        rocblas_stride col_stride_d,
+        rocblas_stride stride_d,
+        bool           c_equals_d)
+    {
+        // W is not written when k == 0, and is not read when alpha == 0. C is not read when
+        // beta == 0.
+        Tc alpha = has_w && alpha_device ? *alpha_device : Tc(0);
+        Tc beta  = beta_device ? *beta_device : Tc(0);
+
+        // C is unchanged when beta == 1 and either k == 0 or alpha == 0
+        if(c_equals_d && beta == Tc(1) && alpha == Tc(0))
+            return;
+
+        auto tx = blockIdx.x * blockDim.x + threadIdx.x;
+        auto ty = blockIdx.y * blockDim.y + threadIdx.y;
+        if(tx < m && ty < n)
+        {
+            Tc d = alpha == Tc(0) ? Tc(0) : alpha * W[blockIdx.z * stride_w + ty * size_t(m) + tx];
+            if(beta != Tc(0))
+            {
+                auto C = load_ptr_batch(C_array, blockIdx.z, shift_c, stride_c);
+                d += beta * Tc(C[tx * row_stride_c + ty * col_stride_c]);
+            }
+
+            auto D = load_ptr_batch(D_array, blockIdx.z, shift_d, stride_d);
+            D[tx * row_stride_d + ty * col_stride_d] = To(d);
+        }
+    }
+
+    template <typename To, typename Tc, typename TConstPtr, typename TPtr>
+    void gemm_device_scalars_launcher(rocblas_handle handle,
+                                      size_t         m,
+                                      size_t         n,
+                                      bool           has_w,
+                                      const Tc*      alpha,
+                                      const Tc*      W,
+                                      size_t         stride_w,
+                                      const Tc*      beta,
+                                      TConstPtr      C,
+                                      size_t         shift_c,
+                                      size_t         row_stride_c,
+                                      size_t         col_stride_c,
+                                      size_t         stride_c,
+                                      TPtr           D,
+                                      size_t         shift_d,
+                                      size_t         row_stride_d,
+                                      size_t         col_stride_d,
+                                      size_t         stride_d,
+                                      size_t         batch_count,
+                                      bool           c_equals_d)
+    {
+        static constexpr int DIM_X = 128;
+        static constexpr int DIM_Y = 8;
+        dim3                 grid((m - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1, batch_count);
+        dim3                 threads(DIM_X, DIM_Y);
+
+        hipLaunchKernelGGL((gemm_device_scalars_kernel<DIM_X, DIM_Y, To>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           rocblas_int(m),
+                           rocblas_int(n),
+                           has_w,
+                           alpha,
+                           W,
+                           rocblas_stride(stride_w),
+                           beta,
+                           C,
+                           ptrdiff_t(shift_c),
+                           rocblas_stride(row_stride_c),
+                           rocblas_stride(col_stride_c),
+                           rocblas_stride(stride_c),
+                           D,
+                           ptrdiff_t(shift_d),
+                           rocblas_stride(row_stride_d),
+                           rocblas_stride(col_stride_d),
+                           rocblas_stride(stride_d),
+                           c_equals_d);
+    }
+} // namespace
+
+/******************************************************************************
+ * Tensile computes W = A*B for all of D, with alpha = 1 and beta = 0 on the  *
+ * host, and gemm_device_scalars_kernel then computes D = alpha*W + beta*C.   *
+ * W is kept in the compute type, so that A*B is not rounded, nor overflows,  *
+ * in a half precision output type before alpha is applied. Tensile computes  *
+ * A*B whenever k != 0, and only the use of W is skipped when alpha == 0.     *
+ * When a GSU workspace has been allocated, which takes all of the available  *
+ * device memory, W is taken from its end, and otherwise W is allocated from  *
+ * the handle, which can grow its device memory. W is included in the size   *
+ * of device memory queries. When W does not fit, or when the tuning database *
+ * has an entry for the problem, which would not be found for the product,    *
+ * alpha and beta are copied to the host and the problem is solved as given.  *
+ ******************************************************************************/
+template <typename Ti, typename To, typename Tc>
+rocblas_status
+    runContractionProblemDeviceScalars(const RocblasContractionProblem<Ti, To, Tc>& prob,
+                                       bool                                         tuned)
+{
+    // general is a value of alpha and beta for which Tensile does not restrict solutions
+    static const Tc one = Tc(1), zero = Tc(0), general = Tc(2);
+
+    auto   handle      = prob.handle;
+    size_t m           = prob.m;
+    size_t n           = prob.n;
+    size_t batch_count = prob.batch_count;
+
+    // The problem solved by Tensile for D, which writes W in the compute type, so that
+    // alpha*A*B is rounded to the output type only once. The matrices of W are m*n apart,
+    // or are pointed to by batch_W.
+    auto product = [&](Tc* W, Tc* const* batch_W) {
+        RocblasContractionProblem<Ti, Tc, Tc> problem{handle,
+                                                      rocblas_int(m),
+                                                      rocblas_int(n),
+                                                      rocblas_int(prob.k),
+                                                      &one,
+                                                      prob.A,
+                                                      prob.batch_A,
+                                                      rocblas_stride(prob.row_stride_a),
+                                                      rocblas_stride(prob.col_stride_a),
+                                                      rocblas_stride(prob.batch_stride_a),
+                                                      0,
+                                                      prob.B,
+                                                      prob.batch_B,
+                                                      rocblas_stride(prob.row_stride_b),
+                                                      rocblas_stride(prob.col_stride_b),
+                                                      rocblas_stride(prob.batch_stride_b),
+                                                      0,
+                                                      &zero,
+                                                      W,
+                                                      batch_W,
+                                                      1,
+                                                      rocblas_stride(m),
+                                                      rocblas_stride(m * n),
+                                                      0,
+                                                      W,
+                                                      batch_W,
+                                                      1,
+                                                      rocblas_stride(m),
+                                                      rocblas_stride(m * n),
+                                                      0,
+                                                      rocblas_int(batch_count),
+                                                      prob.strided_batch};
+
+        problem.flags           = prob.flags;
+        problem.trans_a         = prob.trans_a;
+        problem.trans_b         = prob.trans_b;
+        problem.buffer_offset_a = prob.buffer_offset_a;
+        problem.buffer_offset_b = prob.buffer_offset_b;
+        return problem;
+    };
+
+    // The problem as it is given, with alpha and beta on the host
+    auto given = [&](const Tc* alpha, const Tc* beta) {
+        auto problem  = prob;
+        problem.alpha = alpha;
+        problem.beta  = beta;
+        return problem;
+    };
+
+    // From here on, Tensile is called in host pointer mode
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    // Sizes of W for all of the batch, and of the array of pointers into W
+    size_t w_size     = prob.k ? m * n * batch_count * sizeof(Tc) : 0;
+    size_t array_size = prob.k && !prob.strided_batch ? batch_count * sizeof(Tc*) : 0;
+
+    // Size queries include both the problem as given, which is solved when W does not fit,
+    // and the product, to which W and its array of pointers are added
+    if(handle->is_device_memory_size_query())
+    {
+        rocblas_status status = runContractionProblem(given(&general, &general));
+        if(tuned || (status != rocblas_status_size_increased
+                     && status != rocblas_status_size_unchanged))
+            return status;
+
+        rocblas_status product_status = handle->set_optimal_device_memory_size_nested(
+            [&] { return runContractionProblem(product(nullptr, nullptr)); },
+            array_size,
+            w_size);
+        return product_status == rocblas_status_size_unchanged ? status : product_status;
+    }
+
+    // Other queries are about the problem which Tensile solves
+    if(handle->get_solution_fitness_query() || handle->get_solution_candidates_query())
+        return runContractionProblem(tuned ? given(&general, &general)
+                                           : product(nullptr, nullptr));
+
+    // W and its array of pointers take the end of the GSU workspace, leaving the rest to Tensile
+    size_t gsu_size    = handle->gsu_workspace_size;
+    size_t array_bytes = roundup_device_memory_size(array_size);
+    size_t w_bytes     = roundup_device_memory_size(w_size);
+    bool   use_gsu     = gsu_size >= array_bytes + w_bytes;
+    size_t gsu_kept
+        = use_gsu ? rocblas_gemm_device_scalars_align(gsu_size - array_bytes - w_bytes) : 0;
+
+    auto w_mem = handle->device_malloc(tuned || use_gsu ? 0 : array_size,
+                                       tuned || use_gsu ? 0 : w_size);
+
+    if(tuned || (!use_gsu && !w_mem))
+    {
+        Tc alpha_h = 0, beta_h;
+        if(prob.k)
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(&alpha_h, prob.alpha, sizeof(Tc), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(&beta_h, prob.beta, sizeof(Tc), hipMemcpyDeviceToHost));
+        return runContractionProblem(given(&alpha_h, &beta_h));
+    }
+
+    Tc** batch_W = static_cast<Tc**>(w_mem[0]);
+    Tc*  W       = static_cast<Tc*>(w_mem[1]);
+    if(use_gsu)
+    {
+        batch_W = reinterpret_cast<Tc**>(static_cast<char*>(handle->gsu_workspace) + gsu_kept);
+        W       = reinterpret_cast<Tc*>(reinterpret_cast<char*>(batch_W) + array_bytes);
+    }
+    auto saved_gsu_size = handle->push_gsu_workspace_size(gsu_kept);
+
+    if(array_size)
+        setup_device_pointer_array(handle->get_stream(), W, m * n, batch_W, batch_count);
+
+    if(prob.k)
+        RETURN_IF_ROCBLAS_ERROR(
+            runContractionProblem(product(W, array_size ? batch_W : nullptr)));
+
+    if(prob.strided_batch)
+        gemm_device_scalars_launcher(handle,
+                                     m,
+                                     n,
+                                     prob.k != 0,
+                                     prob.alpha,
+                                     W,
+                                     m * n,
+                                     prob.beta,
+                                     prob.C,
+                                     prob.buffer_offset_c,
+                                     prob.row_stride_c,
+                                     prob.col_stride_c,
+                                     prob.batch_stride_c,
+                                     prob.D,
+                                     prob.buffer_offset_d,
+                                     prob.row_stride_d,
+                                     prob.col_stride_d,
+                                     prob.batch_stride_d,
+                                     batch_count,
+                                     prob.C == prob.D);
+    else
+        gemm_device_scalars_launcher(handle,
+                                     m,
+                                     n,
+                                     prob.k != 0,
+                                     prob.alpha,
+                                     W,
+                                     m * n,
+                                     prob.beta,
+                                     prob.batch_C,
+                                     prob.buffer_offset_c,
+                                     prob.row_stride_c,
+                                     prob.col_stride_c,
+                                     prob.batch_stride_c,
+                                     prob.batch_D,
+                                     prob.buffer_offset_d,
+                                     prob.row_stride_d,
+                                     prob.col_stride_d,
+                                     prob.batch_stride_d,
+                                     batch_count,
+                                     prob.batch_C == prob.batch_D);
+
+    return rocblas_status_success;
+}
+
+/******************************************************************************
+ * Intantiate the cases of runContractionProblemDeviceScalars which are       *
+ * called by runContractionProblem                                            *
+ ******************************************************************************/
+
+// Non-EX types
+template rocblas_status
+    runContractionProblemDeviceScalars(const RocblasContractionProblem<rocblas_half>&, bool);
+
+template rocblas_status
+    runContractionProblemDeviceScalars(const RocblasContractionProblem<float>&, bool);
+
+template rocblas_status
+    runContractionProblemDeviceScalars(const RocblasContractionProblem<double>&, bool);
+
+template rocblas_status runContractionProblemDeviceScalars(
+    const RocblasContractionProblem<rocblas_float_complex>&, bool);
+
+template rocblas_status runContractionProblemDeviceScalars(
+    const RocblasContractionProblem<rocblas_double_complex>&, bool);
+
+// EX types
+template rocblas_status runContractionProblemDeviceScalars(
+    const RocblasContractionProblem<rocblas_half, rocblas_half, float>&, bool);
+
+template rocblas_status runContractionProblemDeviceScalars(
+    const RocblasContractionProblem<rocblas_half, float, float>&, bool);
+
+template rocblas_status runContractionProblemDeviceScalars(
+    const RocblasContractionProblem<rocblas_bfloat16, rocblas_bfloat16, float>&, bool);
+
+template rocblas_status runContractionProblemDeviceScalars(
+    const RocblasContractionProblem<rocblas_bfloat16, float, float>&, bool);
+
+template rocblas_status runContractionProblemDeviceScalars(
+    const RocblasContractionProblem<int8_t, int32_t, int32_t>&, bool);
+
+template rocblas_status runContractionProblemDeviceScalars(
+    const RocblasContractionProblem<rocblas_int8x4, int32_t, int32_t>&, bool);
+
+#endif // USE_TENSILE_HOST
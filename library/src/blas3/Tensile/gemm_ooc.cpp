@@ -0,0 +1,420 @@
+/**************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ ************************************************************************** */
+#include "gemm_ooc.hpp"
+#include "gemm.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_ooc_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_ooc_name<float>[] = "rocblas_sgemm_ooc";
+    template <>
+    constexpr char rocblas_gemm_ooc_name<double>[] = "rocblas_dgemm_ooc";
+    template <>
+    constexpr char rocblas_gemm_ooc_name<rocblas_float_complex>[] = "rocblas_cgemm_ooc";
+    template <>
+    constexpr char rocblas_gemm_ooc_name<rocblas_double_complex>[] = "rocblas_zgemm_ooc";
+
+    // Copy streams and events of one out-of-core gemm, destroyed on return
+    struct rocblas_gemm_ooc_sync
+    {
+        hipStream_t h2d = nullptr, d2h = nullptr;
+        hipEvent_t  start = nullptr, buffer_events[rocblas_gemm_ooc_n_buffers]{};
+
+        hipError_t init()
+        {
+            hipError_t status;
+            if((status = hipStreamCreateWithFlags(&h2d, hipStreamNonBlocking)) != hipSuccess
+               || (status = hipStreamCreateWithFlags(&d2h, hipStreamNonBlocking)) != hipSuccess
+               || (status = hipEventCreateWithFlags(&start, hipEventDisableTiming)) != hipSuccess)
+                return status;
+            for(auto& event : buffer_events)
+                if((status = hipEventCreateWithFlags(&event, hipEventDisableTiming)) != hipSuccess)
+                    return status;
+            return hipSuccess;
+        }
+
+        ~rocblas_gemm_ooc_sync()
+        {
+            for(auto event : buffer_events)
+                if(event)
+                    (void)hipEventDestroy(event);
+            if(start)
+                (void)hipEventDestroy(start);
+            if(d2h)
+                (void)hipStreamDestroy(d2h);
+            if(h2d)
+                (void)hipStreamDestroy(h2d);
+        }
+    };
+
+    /*******************************************************************************
+    * Out-of-core GEMM implementation
+    ******************************************************************************/
+    template <typename T>
+    rocblas_status rocblas_gemm_ooc_impl(rocblas_handle    handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const T*          alpha,
+                                         const T*          A,
+                                         rocblas_int       ld_a,
+                                         const T*          B,
+                                         rocblas_int       ld_b,
+                                         const T*          beta,
+                                         T*                C,
+                                         rocblas_int       ld_c)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
+        // The tiling adapts to the workspace; 64 x 64 x 64 tiles are the smallest efficient ones
+        if(handle->is_device_memory_size_query())
+        {
+            if(m <= 0 || n <= 0)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(rocblas_gemm_ooc_workspace_size(
+                std::min(m, 64), std::min(n, 64), std::max(std::min(k, 64), 0), sizeof(T)));
+        }
+
+        // Copy alpha and beta to host if on device
+        T alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(
+            copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto trans_a_letter = rocblas_transpose_letter(trans_a);
+            auto trans_b_letter = rocblas_transpose_letter(trans_b);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_gemm_ooc_name<T>,
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          A,
+                          ld_a,
+                          B,
+                          ld_b,
+                          LOG_TRACE_SCALAR_VALUE(handle, beta),
+                          C,
+                          ld_c);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemm_ooc_name<T>,
+                            "transA",
+                            trans_a_letter,
+                            "transB",
+                            trans_b_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "alpha",
+                            value_category(*alpha),
+                            "lda",
+                            ld_a,
+                            "ldb",
+                            ld_b,
+                            "beta",
+                            value_category(*beta),
+                            "ldc",
+                            ld_c);
+        }
+
+        auto validArgs = validateArgs(
+            handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+        if(validArgs != rocblas_status_continue)
+            return validArgs;
+
+        // With alpha == 0, A and B are not read
+        if(*alpha == 0)
+            k = 0;
+
+        auto plan
+            = rocblas_plan_gemm_ooc(m, n, k, sizeof(T), handle->get_available_device_memory());
+        if(!plan.tile_m)
+            return rocblas_status_memory_error;
+
+        auto mem = handle->device_malloc(size_t(plan.tile_m) * plan.tile_k * sizeof(T),
+                                         size_t(plan.tile_m) * plan.tile_k * sizeof(T),
+                                         size_t(plan.tile_k) * plan.tile_n * sizeof(T),
+                                         size_t(plan.tile_k) * plan.tile_n * sizeof(T),
+                                         size_t(plan.tile_m) * plan.tile_n * sizeof(T),
+                                         size_t(plan.tile_m) * plan.tile_n * sizeof(T));
+        if(!mem)
+            return rocblas_status_memory_error;
+
+        T* buffers[rocblas_gemm_ooc_n_buffers];
+        for(int b = 0; b < rocblas_gemm_ooc_n_buffers; ++b)
+            buffers[b] = static_cast<T*>(mem[b]);
+
+        // Leading dimensions of the tiles, which hold op(A) and op(B) as they are stored
+        rocblas_int ld_a_tile
+            = std::max(trans_a == rocblas_operation_none ? plan.tile_m : plan.tile_k, 1);
+        rocblas_int ld_b_tile
+            = std::max(trans_b == rocblas_operation_none ? plan.tile_k : plan.tile_n, 1);
+        rocblas_int ld_c_tile = plan.tile_m;
+
+        rocblas_gemm_ooc_sync sync;
+        RETURN_IF_HIP_ERROR(sync.init());
+
+        // Loads and stores wait for the work already on the handle's stream
+        hipStream_t streams[rocblas_gemm_ooc_n_streams];
+        streams[rocblas_gemm_ooc_stream_load]    = sync.h2d;
+        streams[rocblas_gemm_ooc_stream_compute] = handle->get_stream();
+        streams[rocblas_gemm_ooc_stream_store]   = sync.d2h;
+        RETURN_IF_HIP_ERROR(hipEventRecord(sync.start, handle->get_stream()));
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(sync.h2d, sync.start, 0));
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(sync.d2h, sync.start, 0));
+
+        const T one = 1;
+
+        int last_stream[rocblas_gemm_ooc_n_buffers] = {-1, -1, -1, -1, -1, -1};
+
+        using kind = rocblas_gemm_ooc_op_kind;
+        for(auto& op : rocblas_schedule_gemm_ooc(plan, m, n, k, *beta == 0))
+        {
+            int         s      = op.stream();
+            hipStream_t stream = streams[s];
+
+            // Wait for the last op on another stream which used any of the op's buffers
+            int used[3];
+            int count = op.buffers(used);
+            for(int b = 0; b < count; ++b)
+                if(last_stream[used[b]] >= 0 && last_stream[used[b]] != s)
+                    RETURN_IF_HIP_ERROR(
+                        hipStreamWaitEvent(stream, sync.buffer_events[used[b]], 0));
+
+            T* tile_a = buffers[rocblas_gemm_ooc_buffer_a + op.ab_slot];
+            T* tile_b = buffers[rocblas_gemm_ooc_buffer_b + op.ab_slot];
+            T* tile_c = buffers[rocblas_gemm_ooc_buffer_c + op.c_slot];
+
+            switch(op.kind)
+            {
+            case kind::load_a:
+                if(trans_a == rocblas_operation_none)
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(tile_a,
+                                                         sizeof(T) * ld_a_tile,
+                                                         A + op.i + op.kk * size_t(ld_a),
+                                                         sizeof(T) * ld_a,
+                                                         sizeof(T) * op.rows,
+                                                         op.depth,
+                                                         hipMemcpyHostToDevice,
+                                                         stream));
+                else
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(tile_a,
+                                                         sizeof(T) * ld_a_tile,
+                                                         A + op.kk + op.i * size_t(ld_a),
+                                                         sizeof(T) * ld_a,
+                                                         sizeof(T) * op.depth,
+                                                         op.rows,
+                                                         hipMemcpyHostToDevice,
+                                                         stream));
+                break;
+
+            case kind::load_b:
+                if(trans_b == rocblas_operation_none)
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(tile_b,
+                                                         sizeof(T) * ld_b_tile,
+                                                         B + op.kk + op.j * size_t(ld_b),
+                                                         sizeof(T) * ld_b,
+                                                         sizeof(T) * op.depth,
+                                                         op.cols,
+                                                         hipMemcpyHostToDevice,
+                                                         stream));
+                else
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(tile_b,
+                                                         sizeof(T) * ld_b_tile,
+                                                         B + op.j + op.kk * size_t(ld_b),
+                                                         sizeof(T) * ld_b,
+                                                         sizeof(T) * op.cols,
+                                                         op.depth,
+                                                         hipMemcpyHostToDevice,
+                                                         stream));
+                break;
+
+            case kind::load_c:
+                RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(tile_c,
+                                                     sizeof(T) * ld_c_tile,
+                                                     C + op.i + op.j * size_t(ld_c),
+                                                     sizeof(T) * ld_c,
+                                                     sizeof(T) * op.rows,
+                                                     op.cols,
+                                                     hipMemcpyHostToDevice,
+                                                     stream));
+                break;
+
+            case kind::compute:
+            {
+                rocblas_status status
+                    = rocblas_internal_gemm_template<false>(handle,
+                                                            trans_a,
+                                                            trans_b,
+                                                            op.rows,
+                                                            op.cols,
+                                                            op.depth,
+                                                            alpha,
+                                                            (const T*)tile_a,
+                                                            0,
+                                                            ld_a_tile,
+                                                            0,
+                                                            (const T*)tile_b,
+                                                            0,
+                                                            ld_b_tile,
+                                                            0,
+                                                            op.first ? beta : &one,
+                                                            tile_c,
+                                                            0,
+                                                            ld_c_tile,
+                                                            0,
+                                                            1);
+                if(status != rocblas_status_success)
+                    return status;
+                break;
+            }
+
+            case kind::store_c:
+                RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(C + op.i + op.j * size_t(ld_c),
+                                                     sizeof(T) * ld_c,
+                                                     tile_c,
+                                                     sizeof(T) * ld_c_tile,
+                                                     sizeof(T) * op.rows,
+                                                     op.cols,
+                                                     hipMemcpyDeviceToHost,
+                                                     stream));
+                break;
+            }
+
+            for(int b = 0; b < count; ++b)
+            {
+                RETURN_IF_HIP_ERROR(hipEventRecord(sync.buffer_events[used[b]], stream));
+                last_stream[used[b]] = s;
+            }
+        }
+
+        // Every op precedes the last store, and C on the host is complete on return
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(sync.d2h));
+        return rocblas_status_success;
+    }
+}
+
+/*******************************************************************************
+ * Out-of-core GEMM APIs
+ ******************************************************************************/
+extern "C" {
+
+rocblas_status rocblas_sgemm_ooc(rocblas_handle    handle,
+                                 rocblas_operation trans_a,
+                                 rocblas_operation trans_b,
+                                 rocblas_int       m,
+                                 rocblas_int       n,
+                                 rocblas_int       k,
+                                 const float*      alpha,
+                                 const float*      A,
+                                 rocblas_int       ld_a,
+                                 const float*      B,
+                                 rocblas_int       ld_b,
+                                 const float*      beta,
+                                 float*            C,
+                                 rocblas_int       ld_c)
+try
+{
+    return rocblas_gemm_ooc_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dgemm_ooc(rocblas_handle    handle,
+                                 rocblas_operation trans_a,
+                                 rocblas_operation trans_b,
+                                 rocblas_int       m,
+                                 rocblas_int       n,
+                                 rocblas_int       k,
+                                 const double*     alpha,
+                                 const double*     A,
+                                 rocblas_int       ld_a,
+                                 const double*     B,
+                                 rocblas_int       ld_b,
+                                 const double*     beta,
+                                 double*           C,
+                                 rocblas_int       ld_c)
+try
+{
+    return rocblas_gemm_ooc_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_cgemm_ooc(rocblas_handle               handle,
+                                 rocblas_operation            trans_a,
+                                 rocblas_operation            trans_b,
+                                 rocblas_int                  m,
+                                 rocblas_int                  n,
+                                 rocblas_int                  k,
+                                 const rocblas_float_complex* alpha,
+                                 const rocblas_float_complex* A,
+                                 rocblas_int                  ld_a,
+                                 const rocblas_float_complex* B,
+                                 rocblas_int                  ld_b,
+                                 const rocblas_float_complex* beta,
+                                 rocblas_float_complex*       C,
+                                 rocblas_int                  ld_c)
+try
+{
+    return rocblas_gemm_ooc_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_zgemm_ooc(rocblas_handle                handle,
+                                 rocblas_operation             trans_a,
+                                 rocblas_operation             trans_b,
+                                 rocblas_int                   m,
+                                 rocblas_int                   n,
+                                 rocblas_int                   k,
+                                 const rocblas_double_complex* alpha,
+                                 const rocblas_double_complex* A,
+                                 rocblas_int                   ld_a,
+                                 const rocblas_double_complex* B,
+                                 rocblas_int                   ld_b,
+                                 const rocblas_double_complex* beta,
+                                 rocblas_double_complex*       C,
+                                 rocblas_int                   ld_c)
+try
+{
+    return rocblas_gemm_ooc_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
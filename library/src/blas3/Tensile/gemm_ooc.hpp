@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/*******************************************************************************
+ * Out-of-core gemm streams tiles of host-resident A, B and C through device
+ * memory. The workspace holds two tiles each of A, B and C, so that the next
+ * tiles of A and B are loaded while the current tile is computed, and a
+ * finished tile of C is stored while the next one is computed.
+ ******************************************************************************/
+struct rocblas_gemm_ooc_plan
+{
+    rocblas_int tile_m; // Rows of a tile of C and op(A); 0 if no tiling fits
+    rocblas_int tile_n; // Columns of a tile of C and op(B)
+    rocblas_int tile_k; // Depth of a tile of op(A) and op(B)
+    size_t      workspace_size; // Bytes of device memory used by the tiles
+};
+
+// Device memory buffers of the tiles: two slots each of A, B and C
+enum rocblas_gemm_ooc_buffer
+{
+    rocblas_gemm_ooc_buffer_a  = 0,
+    rocblas_gemm_ooc_buffer_b  = 2,
+    rocblas_gemm_ooc_buffer_c  = 4,
+    rocblas_gemm_ooc_n_buffers = 6,
+};
+
+// Streams of the schedule: loads, compute and stores each have their own
+enum rocblas_gemm_ooc_stream
+{
+    rocblas_gemm_ooc_stream_load    = 0,
+    rocblas_gemm_ooc_stream_compute = 1,
+    rocblas_gemm_ooc_stream_store   = 2,
+    rocblas_gemm_ooc_n_streams      = 3,
+};
+
+enum class rocblas_gemm_ooc_op_kind
+{
+    load_a, // Copy a tile of op(A) from the host
+    load_b, // Copy a tile of op(B) from the host
+    load_c, // Copy a tile of C from the host
+    compute, // Multiply the tiles of A and B into the tile of C
+    store_c, // Copy a tile of C to the host
+};
+
+struct rocblas_gemm_ooc_op
+{
+    rocblas_gemm_ooc_op_kind kind;
+    rocblas_int              i, j, kk; // Offsets of the tile in C and along k
+    rocblas_int              rows, cols, depth; // Size of the tile (depth 0 if k == 0)
+    int                      ab_slot; // Slot of the A and B buffers
+    int                      c_slot; // Slot of the C buffer
+    bool                     first; // Whether this is the first compute of the tile of C
+
+    int stream() const
+    {
+        return kind == rocblas_gemm_ooc_op_kind::compute ? rocblas_gemm_ooc_stream_compute
+               : kind == rocblas_gemm_ooc_op_kind::store_c ? rocblas_gemm_ooc_stream_store
+                                                           : rocblas_gemm_ooc_stream_load;
+    }
+
+    // Stores the buffers which the op reads or writes into buffers[], returning their count
+    int buffers(int buffers[3]) const
+    {
+        int count = 0;
+        if(kind == rocblas_gemm_ooc_op_kind::load_a
+           || (kind == rocblas_gemm_ooc_op_kind::compute && depth))
+            buffers[count++] = rocblas_gemm_ooc_buffer_a + ab_slot;
+        if(kind == rocblas_gemm_ooc_op_kind::load_b
+           || (kind == rocblas_gemm_ooc_op_kind::compute && depth))
+            buffers[count++] = rocblas_gemm_ooc_buffer_b + ab_slot;
+        if(kind == rocblas_gemm_ooc_op_kind::load_c || kind == rocblas_gemm_ooc_op_kind::compute
+           || kind == rocblas_gemm_ooc_op_kind::store_c)
+            buffers[count++] = rocblas_gemm_ooc_buffer_c + c_slot;
+        return count;
+    }
+};
+
+// Device memory bytes of the tiles, with each buffer rounded up as by device_malloc()
+inline size_t rocblas_gemm_ooc_workspace_size(
+    rocblas_int tile_m, rocblas_int tile_n, rocblas_int tile_k, size_t elem_size)
+{
+    auto roundup = [](size_t size) { return (size + 63) / 64 * 64; };
+    return 2
+           * (roundup(size_t(tile_m) * tile_k * elem_size)
+              + roundup(size_t(tile_k) * tile_n * elem_size)
+              + roundup(size_t(tile_m) * tile_n * elem_size));
+}
+
+/*******************************************************************************
+ * Plan the tiles of an m x n x k out-of-core gemm whose workspace fits in
+ * budget bytes. Square tiles are preferred, as they move the fewest bytes per
+ * flop; a tile edge larger than 64 is a multiple of 64, and the tiles are then
+ * made as deep as the budget allows, which reduces the number of launches.
+ * tile_m is 0 if not even a 1 x 1 x 1 tiling fits.
+ ******************************************************************************/
+inline rocblas_gemm_ooc_plan rocblas_plan_gemm_ooc(
+    rocblas_int m, rocblas_int n, rocblas_int k, size_t elem_size, size_t budget)
+{
+    auto tiles = [=](rocblas_int s) {
+        return rocblas_gemm_ooc_plan{std::min(m, s), std::min(n, s), std::min(k, s), 0};
+    };
+    auto fits = [=](const rocblas_gemm_ooc_plan& plan) {
+        return rocblas_gemm_ooc_workspace_size(plan.tile_m, plan.tile_n, plan.tile_k, elem_size)
+               <= budget;
+    };
+
+    // Largest square edge which fits
+    rocblas_int lo = 0, hi = std::max({m, n, k, 1});
+    while(lo < hi)
+    {
+        rocblas_int s = lo + (hi - lo + 1) / 2;
+        if(fits(tiles(s)))
+            lo = s;
+        else
+            hi = s - 1;
+    }
+    if(!lo)
+        return {0, 0, 0, 0};
+
+    // Round the edge down to a multiple of 64 unless it already covers the matrices
+    if(lo > 64 && lo < std::max({m, n, k}))
+        lo -= lo % 64;
+    auto plan = tiles(lo);
+
+    // Deepen the tiles with the remaining budget
+    rocblas_int lo_k = plan.tile_k, hi_k = k;
+    while(lo_k < hi_k)
+    {
+        rocblas_int tk = lo_k + (hi_k - lo_k + 1) / 2;
+        plan.tile_k    = tk;
+        if(fits(plan))
+            lo_k = tk;
+        else
+            hi_k = tk - 1;
+    }
+    plan.tile_k = lo_k;
+
+    plan.workspace_size
+        = rocblas_gemm_ooc_workspace_size(plan.tile_m, plan.tile_n, plan.tile_k, elem_size);
+    return plan;
+}
+
+/*******************************************************************************
+ * Order the copies and multiplies of an out-of-core gemm with a plan. Tiles of
+ * C are visited column by column; each is loaded (unless beta_zero), updated by
+ * one multiply per tile along k, and stored. The A and B slots alternate with
+ * every multiply and the C slots with every tile of C. An op must wait for the
+ * last op issued before it which uses any of its buffers.
+ ******************************************************************************/
+inline std::vector<rocblas_gemm_ooc_op> rocblas_schedule_gemm_ooc(
+    const rocblas_gemm_ooc_plan& plan, rocblas_int m, rocblas_int n, rocblas_int k, bool beta_zero)
+{
+    std::vector<rocblas_gemm_ooc_op> ops;
+    if(!plan.tile_m || !m || !n)
+        return ops;
+
+    using kind = rocblas_gemm_ooc_op_kind;
+    size_t step = 0, tile = 0;
+    for(rocblas_int j = 0; j < n; j += plan.tile_n)
+    {
+        for(rocblas_int i = 0; i < m; i += plan.tile_m, ++tile)
+        {
+            rocblas_int rows   = std::min(plan.tile_m, m - i);
+            rocblas_int cols   = std::min(plan.tile_n, n - j);
+            int         c_slot = tile % 2;
+
+            if(!beta_zero)
+                ops.push_back({kind::load_c, i, j, 0, rows, cols, 0, 0, c_slot, false});
+
+            // With k == 0, one multiply of depth 0 scales C by beta
+            rocblas_int kk = 0;
+            do
+            {
+                rocblas_int depth   = std::min(plan.tile_k, k - kk);
+                int         ab_slot = step++ % 2;
+                if(depth)
+                {
+                    ops.push_back(
+                        {kind::load_a, i, j, kk, rows, cols, depth, ab_slot, c_slot, false});
+                    ops.push_back(
+                        {kind::load_b, i, j, kk, rows, cols, depth, ab_slot, c_slot, false});
+                }
+                ops.push_back(
+                    {kind::compute, i, j, kk, rows, cols, depth, ab_slot, c_slot, kk == 0});
+                kk += depth;
+            } while(kk < k);
+
+            ops.push_back({kind::store_c, i, j, 0, rows, cols, 0, 0, c_slot, false});
+        }
+    }
+    return ops;
+}
+
+/*******************************************************************************
+ * Simulate a schedule of an out-of-core gemm, returning its makespan in seconds.
+ * Copies take their bytes divided by the host-to-device or device-to-host
+ * bandwidth (bytes/s), and multiplies take 2 * rows * cols * depth divided by
+ * the compute rate (flops/s). Ops start when their stream is free and the ops
+ * which they wait for have finished. This is the dependency rule which the
+ * device implementation enforces with events, so it can be tested on the host.
+ ******************************************************************************/
+inline double rocblas_simulate_gemm_ooc(const std::vector<rocblas_gemm_ooc_op>& ops,
+                                        size_t                                  elem_size,
+                                        double                                  h2d_bandwidth,
+                                        double                                  d2h_bandwidth,
+                                        double                                  compute_rate)
+{
+    double stream_free[rocblas_gemm_ooc_n_streams] = {};
+    double buffer_free[rocblas_gemm_ooc_n_buffers] = {};
+    double makespan                                = 0;
+
+    using kind = rocblas_gemm_ooc_op_kind;
+    for(auto& op : ops)
+    {
+        double duration = 0;
+        switch(op.kind)
+        {
+        case kind::load_a:
+            duration = double(op.rows) * op.depth * elem_size / h2d_bandwidth;
+            break;
+        case kind::load_b:
+            duration = double(op.depth) * op.cols * elem_size / h2d_bandwidth;
+            break;
+        case kind::load_c:
+            duration = double(op.rows) * op.cols * elem_size / h2d_bandwidth;
+            break;
+        case kind::compute:
+            duration = 2.0 * op.rows * op.cols * op.depth / compute_rate;
+            break;
+        case kind::store_c:
+            duration = double(op.rows) * op.cols * elem_size / d2h_bandwidth;
+            break;
+        }
+
+        int    buffers[3];
+        int    count = op.buffers(buffers);
+        double start = stream_free[op.stream()];
+        for(int b = 0; b < count; ++b)
+            start = std::max(start, buffer_free[buffers[b]]);
+
+        double finish            = start + duration;
+        stream_free[op.stream()] = finish;
+        for(int b = 0; b < count; ++b)
+            buffer_free[buffers[b]] = finish;
+        makespan = std::max(makespan, finish);
+    }
+    return makespan;
+}
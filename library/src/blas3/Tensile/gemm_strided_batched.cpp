@@ -53,13 +53,22 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        // Copy alpha and beta to host if on device
-        T alpha_h, beta_h;
-        RETURN_IF_ROCBLAS_ERROR(
-            copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
-        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
+        // In device pointer mode, the product A*B is held in device memory
+        if(handle->is_device_memory_size_query())
+            return rocblas_gemm_device_scalars_size(handle, m, n, k, batch_count, false, sizeof(T));
+
+        // Copy alpha and beta to host if on device, and if they are needed there
+        T    alpha_h, beta_h;
+        bool host_scalars = rocblas_gemm_needs_host_scalars(handle);
+        if(host_scalars)
+            RETURN_IF_ROCBLAS_ERROR(
+                copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+        auto saved_pointer_mode = handle->push_pointer_mode(
+            host_scalars ? rocblas_pointer_mode_host : handle->pointer_mode);
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
@@ -41,7 +41,16 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
+        if(handle->is_device_memory_size_query())
+        {
+            size_t w_size = rocblas_internal_syrkx_workspace_size<MIN_NB>(n, 1);
+            if(!w_size)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(w_size, w_size, w_size);
+        }
 
         // Copy alpha and beta to host if on device. This is because gemm is called and it
         // requires alpha and beta to be on host
@@ -802,6 +802,99 @@ void syrkx_dispatch(rocblas_fill      uplo,
     // clang-format on
 }
 
+// The blocked path of syrkx splits C into at most SYRKX_MAX_DIAG_BLOCKS diagonal blocks of size nb
+constexpr rocblas_int SYRKX_MAX_DIAG_BLOCKS = 16;
+
+// Smallest block size MIN_NB * 2^j which splits n into at most SYRKX_MAX_DIAG_BLOCKS blocks
+template <int MIN_NB>
+inline rocblas_int rocblas_syrkx_block_size(rocblas_int n)
+{
+    rocblas_int nb = MIN_NB;
+    while(n / nb > SYRKX_MAX_DIAG_BLOCKS)
+        nb *= 2;
+    return nb;
+}
+
+// Size of each of the three arrays of pointers to the blocks of A, B and C used by
+// rocblas_syrkx_blocked_template, or 0 if C has fewer than two diagonal blocks of size nb,
+// or if the diagonal blocks of the batch do not fit in the z dimension of the grid of syrkx
+template <int MIN_NB>
+inline size_t rocblas_internal_syrkx_workspace_size(rocblas_int n, rocblas_int batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return 0;
+
+    rocblas_int nb   = rocblas_syrkx_block_size<MIN_NB>(n);
+    rocblas_int n_nb = n / nb;
+    if(n_nb < 2 || size_t(batch_count) * n_nb > 65535)
+        return 0;
+
+    size_t n_blocks = n_nb * (n_nb - 1) / 2 + n_nb + (n % nb ? 1 : 0);
+    return n_blocks * batch_count * sizeof(void*);
+}
+
+// Fills the arrays of pointers to the blocks of A, B and C used by
+// rocblas_syrkx_blocked_template. The n_off off-diagonal blocks of all of the batch come first,
+// then the n_nb diagonal blocks, then the remainder diagonal blocks if has_rem is true.
+template <int NB, typename T, typename TConstPtr, typename TPtr, typename TLd>
+ROCBLAS_KERNEL __launch_bounds__(NB) void syrkx_block_pointers_kernel(bool           upper,
+                                                                      rocblas_int    nb,
+                                                                      rocblas_int    n_nb,
+                                                                      rocblas_int    n_off,
+                                                                      bool           has_rem,
+                                                                      TConstPtr*     dA_array,
+                                                                      TLd            offset_a,
+                                                                      TLd            a_s1,
+                                                                      rocblas_stride stride_a,
+                                                                      TConstPtr*     dB_array,
+                                                                      TLd            offset_b,
+                                                                      TLd            b_s1,
+                                                                      rocblas_stride stride_b,
+                                                                      TPtr*          dC_array,
+                                                                      TLd            offset_c,
+                                                                      TLd            ldc,
+                                                                      rocblas_stride stride_c,
+                                                                      rocblas_int    batch_count,
+                                                                      const T**      A_ptrs,
+                                                                      const T**      B_ptrs,
+                                                                      T**            C_ptrs)
+{
+    size_t tid = size_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    size_t t   = tid;
+
+    rocblas_int b, i1, i2;
+    if(t < size_t(batch_count) * n_off)
+    {
+        // block (i1, i2) of the strictly lower triangle of blocks, numbered by rows
+        b             = t / n_off;
+        rocblas_int i = t % n_off;
+        for(i1 = 1; i >= i1; ++i1)
+            i -= i1;
+        i2 = i;
+        if(upper)
+        {
+            i2 = i1;
+            i1 = i;
+        }
+    }
+    else if((t -= size_t(batch_count) * n_off) < size_t(batch_count) * n_nb)
+    {
+        b  = t / n_nb;
+        i1 = i2 = t % n_nb;
+    }
+    else if(has_rem && (t -= size_t(batch_count) * n_nb) < size_t(batch_count))
+    {
+        b  = t;
+        i1 = i2 = n_nb;
+    }
+    else
+        return;
+
+    A_ptrs[tid] = load_ptr_batch(dA_array, b, offset_a + i1 * TLd(nb) * a_s1, stride_a);
+    B_ptrs[tid] = load_ptr_batch(dB_array, b, offset_b + i2 * TLd(nb) * b_s1, stride_b);
+    C_ptrs[tid] = load_ptr_batch(dC_array, b, offset_c + (i1 + i2 * ldc) * TLd(nb), stride_c);
+}
+
 #define OFFSET_A(i1) offset_a + i1* a_s1
 #define OFFSET_B(i1) offset_b + i1* b_s1
 #define OFFSET_C(i1, i2) offset_c + i1* c_s1 + i2* c_s2
@@ -940,6 +1033,150 @@ rocblas_status rocblas_syrkx_template(rocblas_handle    handle,
     return rocblas_status_success;
 }
 
+// Computes C in a constant number of launches, with C split into n_nb diagonal blocks of size nb
+// and a remainder. One batched gemm computes all of the off-diagonal blocks of size nb, one gemm
+// the strip of the remainder, and syrkx_dispatch the diagonal blocks. A_ptrs, B_ptrs and C_ptrs
+// are arrays of rocblas_internal_syrkx_workspace_size<MIN_NB>(n, batch_count) bytes.
+template <int  MIN_NB,
+          bool BATCHED,
+          typename T,
+          typename TScal,
+          typename TPtr,
+          typename TConstPtr,
+          typename TLd>
+rocblas_status rocblas_syrkx_blocked_template(rocblas_handle    handle,
+                                              rocblas_fill      uplo,
+                                              rocblas_operation trans,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              TScal*            alpha,
+                                              TConstPtr*        da,
+                                              TLd               offset_a,
+                                              TLd               lda,
+                                              rocblas_stride    stride_a,
+                                              TConstPtr*        db,
+                                              TLd               offset_b,
+                                              TLd               ldb,
+                                              rocblas_stride    stride_b,
+                                              TScal*            beta,
+                                              TPtr*             dc,
+                                              TLd               offset_c,
+                                              TLd               ldc,
+                                              rocblas_stride    stride_c,
+                                              rocblas_int       batch_count,
+                                              const T**         A_ptrs,
+                                              const T**         B_ptrs,
+                                              T**               C_ptrs)
+{
+    static constexpr int NB_PTRS = 256;
+
+    TLd a_s1 = rocblas_operation_none == trans ? 1 : lda;
+    TLd b_s1 = rocblas_operation_none == trans ? 1 : ldb;
+    TLd c_s1 = 1, c_s2 = ldc;
+
+    rocblas_int nb    = rocblas_syrkx_block_size<MIN_NB>(n);
+    rocblas_int n_nb  = n / nb; // number of diagonal blocks of size nb
+    rocblas_int rem   = n % nb; // size of remainder block when n is not multiple of nb
+    rocblas_int n_off = n_nb * (n_nb - 1) / 2; // number of off-diagonal blocks of size nb
+    rocblas_int i1    = n_nb * nb; // remainder blocks start at row or column i1
+
+    hipStream_t stream = handle->get_stream();
+
+    size_t n_ptrs = size_t(batch_count) * (n_off + n_nb + (rem ? 1 : 0));
+    hipLaunchKernelGGL((syrkx_block_pointers_kernel<NB_PTRS, T>),
+                       dim3((n_ptrs - 1) / NB_PTRS + 1),
+                       dim3(NB_PTRS),
+                       0,
+                       stream,
+                       rocblas_fill_upper == uplo,
+                       nb,
+                       n_nb,
+                       n_off,
+                       rem != 0,
+                       da,
+                       offset_a,
+                       a_s1,
+                       stride_a,
+                       db,
+                       offset_b,
+                       b_s1,
+                       stride_b,
+                       dc,
+                       offset_c,
+                       ldc,
+                       stride_c,
+                       batch_count,
+                       A_ptrs,
+                       B_ptrs,
+                       C_ptrs);
+
+    const T* const* A_array = A_ptrs;
+    const T* const* B_array = B_ptrs;
+    T* const*       C_array = C_ptrs;
+
+    rocblas_operation trans_a
+        = rocblas_operation_none == trans ? rocblas_operation_none : rocblas_operation_transpose;
+    rocblas_operation trans_b
+        = rocblas_operation_none == trans ? rocblas_operation_transpose : rocblas_operation_none;
+
+    // call gemm with batch_count = batch_count * n_off for all off-diagonal blocks of size nb
+    // clang-format off
+    RETURN_IF_ROCBLAS_ERROR( (rocblas_internal_gemm_template<true, T>(
+         handle, trans_a, trans_b, nb, nb, k, alpha,
+         A_array, 0, lda, 0,
+         B_array, 0, ldb, 0, beta,
+         C_array, 0, ldc, 0, batch_count * n_off)));
+    // clang-format on
+
+    // call gemm for the strip of size rem x i1 or i1 x rem beside the remainder diagonal block
+    if(rem != 0)
+    {
+        if(rocblas_fill_lower == uplo)
+        {
+            // clang-format off
+            RETURN_IF_ROCBLAS_ERROR( (rocblas_internal_gemm_template<BATCHED, T>(
+                 handle, trans_a, trans_b, rem, i1, k, alpha,
+                 da, OFFSET_A(i1),    lda, stride_a,
+                 db, OFFSET_B(0),     ldb, stride_b, beta,
+                 dc, OFFSET_C(i1, 0), ldc, stride_c, batch_count)));
+            // clang-format on
+        }
+        else
+        {
+            // clang-format off
+            RETURN_IF_ROCBLAS_ERROR( (rocblas_internal_gemm_template<BATCHED, T>(
+                 handle, trans_a, trans_b, i1, rem, k, alpha,
+                 da, OFFSET_A(0),     lda, stride_a,
+                 db, OFFSET_B(i1),    ldb, stride_b, beta,
+                 dc, OFFSET_C(0, i1), ldc, stride_c, batch_count)));
+            // clang-format on
+        }
+    }
+
+    // call syrkx_dispatch with batch_count = batch_count * n_nb for all diagonal blocks of size
+    // nb, and with batch_count for the remainder diagonal blocks of size rem
+    size_t i_diag = size_t(batch_count) * n_off;
+    // clang-format off
+    syrkx_dispatch<T>( uplo, trans, nb, k, *alpha,
+                       A_array + i_diag, lda, 0,
+                       B_array + i_diag, ldb, 0, *beta,
+                       C_array + i_diag, ldc, 0, batch_count * n_nb, stream);
+    // clang-format on
+
+    if(rem != 0)
+    {
+        i_diag += size_t(batch_count) * n_nb;
+        // clang-format off
+        syrkx_dispatch<T>( uplo, trans, rem, k, *alpha,
+                           A_array + i_diag, lda, 0,
+                           B_array + i_diag, ldb, 0, *beta,
+                           C_array + i_diag, ldc, 0, batch_count, stream);
+        // clang-format on
+    }
+
+    return rocblas_status_success;
+}
+
 template <int  MIN_NB,
           bool BATCHED,
           typename T,
@@ -971,6 +1208,38 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 {
     static constexpr bool TWOK = false;
 
+    // When there is room for the arrays of pointers to the blocks of C, they are computed in a
+    // constant number of launches, rather than with a loop of gemm calls
+    size_t w_size = rocblas_internal_syrkx_workspace_size<MIN_NB>(n, batch_count);
+    if(w_size)
+    {
+        auto w_mem = handle->device_malloc(w_size, w_size, w_size);
+        if(w_mem)
+            return rocblas_syrkx_blocked_template<MIN_NB, BATCHED, T>(handle,
+                                                                      uplo,
+                                                                      trans,
+                                                                      n,
+                                                                      k,
+                                                                      alpha,
+                                                                      da,
+                                                                      offset_a,
+                                                                      lda,
+                                                                      stride_a,
+                                                                      db,
+                                                                      offset_b,
+                                                                      ldb,
+                                                                      stride_b,
+                                                                      beta,
+                                                                      dc,
+                                                                      offset_c,
+                                                                      ldc,
+                                                                      stride_c,
+                                                                      batch_count,
+                                                                      (const T**)w_mem[0],
+                                                                      (const T**)w_mem[1],
+                                                                      (T**)w_mem[2]);
+    }
+
     if(BATCHED == false && batch_count == 1)
     {
         return rocblas_syrkx_template<MIN_NB, BATCHED, T>(handle,
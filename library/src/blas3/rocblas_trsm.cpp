@@ -10,6 +10,28 @@
 #include "trtri_trsm.hpp"
 #include "utility.hpp"
 
+// A triangular matrix prepared by rocblas_trsm_operator_create, with the inverses of its
+// diagonal blocks in device memory owned by the operator
+struct _rocblas_trsm_operator
+{
+    rocblas_side      side;
+    rocblas_fill      uplo;
+    rocblas_operation transA;
+    rocblas_diagonal  diag;
+    rocblas_int       k;
+    const void*       A;
+    rocblas_int       lda;
+    rocblas_datatype  compute_type;
+    void*             invA      = nullptr;
+    rocblas_int       invA_size = 0; // Number of elements of invA
+
+    ~_rocblas_trsm_operator()
+    {
+        if(invA)
+            hipFree(invA);
+    }
+};
+
 namespace
 {
     // Shared memory usuage is (128/2)^2 * sizeof(float) = 32K. LDS is 64K per CU. Theoretically
@@ -28,6 +50,73 @@ namespace
     template <>
     constexpr char rocblas_trsm_name<rocblas_double_complex>[] = "rocblas_ztrsm";
 
+    // Compute the BLOCK * k elements of invA, the inverses of the diagonal blocks of A
+    template <rocblas_int BLOCK, typename T>
+    rocblas_status rocblas_trsm_invA(rocblas_handle   handle,
+                                     rocblas_fill     uplo,
+                                     rocblas_diagonal diag,
+                                     rocblas_int      k,
+                                     const T*         A,
+                                     rocblas_int      lda,
+                                     T*               invA)
+    {
+        auto w_mem = handle->device_malloc(rocblas_internal_trsm_trtri_temp_size<BLOCK, T>(k));
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        // trtri is computed with scalars on the host
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        return rocblas_trtri_trsm_template<BLOCK, false, T>(handle,
+                                                            (T*)w_mem,
+                                                            uplo,
+                                                            diag,
+                                                            k,
+                                                            A,
+                                                            0,
+                                                            lda,
+                                                            0,
+                                                            invA,
+                                                            0,
+                                                            rocblas_stride(BLOCK) * k,
+                                                            1);
+    }
+
+    // Find the inverses of the diagonal blocks of A in the handle's cache, computing and
+    // caching them if they are not found
+    template <rocblas_int BLOCK, typename T>
+    rocblas_status rocblas_trsm_cached_invA(rocblas_handle   handle,
+                                            rocblas_fill     uplo,
+                                            rocblas_diagonal diag,
+                                            rocblas_int      k,
+                                            const T*         A,
+                                            rocblas_int      lda,
+                                            const T**        invA)
+    {
+        rocblas_trsm_inverse_cache::key_t key{
+            A, k, lda, BLOCK, uplo, diag, rocblas_datatype_from_type<T>};
+
+        // The inverses are allocated on the handle's device
+        auto saved_device_id = handle->push_device_id();
+
+        void* buffer;
+        bool  found;
+        RETURN_IF_ROCBLAS_ERROR(handle->trsm_inverses.acquire(
+            key, sizeof(T) * BLOCK * k, handle->get_stream(), &buffer, &found));
+        if(!found)
+        {
+            rocblas_status status
+                = rocblas_trsm_invA<BLOCK>(handle, uplo, diag, k, A, lda, (T*)buffer);
+            if(status != rocblas_status_success)
+            {
+                handle->trsm_inverses.discard(key);
+                return status;
+            }
+        }
+
+        *invA = (const T*)buffer;
+        return rocblas_status_success;
+    }
+
     /* ============================================================================================ */
 
     template <rocblas_int BLOCK, typename T>
@@ -49,6 +138,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         /////////////
         // LOGGING //
         /////////////
@@ -138,6 +230,18 @@ namespace
         if(!alpha || !A || !B)
             return rocblas_status_invalid_pointer;
 
+        // The handle's cache supplies the inverses of A, unless they are supplied by the caller
+        // or the substitution kernels of small sizes are used instead
+        if(!supplied_invA && handle->trsm_inverse_cache_mode == rocblas_trsm_inverse_cache_enabled
+           && !handle->is_device_memory_size_query() && (m > 64 || n > 64))
+        {
+            rocblas_status cache_status = rocblas_trsm_cached_invA<BLOCK>(
+                handle, uplo, diag, k, A, lda, &supplied_invA);
+            if(cache_status != rocblas_status_success)
+                return cache_status;
+            supplied_invA_size = BLOCK * k;
+        }
+
         //////////////////////
         // MEMORY MANAGEMENT//
         //////////////////////
@@ -197,6 +301,97 @@ namespace
         return status != rocblas_status_success ? status : perf_status;
     }
 
+    template <rocblas_int BLOCK, typename T>
+    rocblas_status rocblas_trsm_operator_create_impl(rocblas_handle         handle,
+                                                     rocblas_side           side,
+                                                     rocblas_fill           uplo,
+                                                     rocblas_operation      transA,
+                                                     rocblas_diagonal       diag,
+                                                     rocblas_int            k,
+                                                     const T*               A,
+                                                     rocblas_int            lda,
+                                                     rocblas_datatype       compute_type,
+                                                     rocblas_trsm_operator* op)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
+        if(handle->is_device_memory_size_query())
+        {
+            if(k <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(
+                    rocblas_internal_trsm_trtri_temp_size<BLOCK, T>(k));
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_trsm_operator_create",
+                      side,
+                      uplo,
+                      transA,
+                      diag,
+                      k,
+                      A,
+                      lda,
+                      compute_type);
+
+        if(side != rocblas_side_left && side != rocblas_side_right)
+            return rocblas_status_invalid_value;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(k < 0 || lda < k || lda < 1)
+            return rocblas_status_invalid_size;
+        if(!op || (k && !A))
+            return rocblas_status_invalid_pointer;
+
+        std::unique_ptr<_rocblas_trsm_operator> prepared(
+            new _rocblas_trsm_operator{side, uplo, transA, diag, k, A, lda, compute_type});
+
+        if(k)
+        {
+            // The inverses are allocated on the handle's device
+            auto saved_device_id = handle->push_device_id();
+
+            RETURN_IF_HIP_ERROR((hipMalloc)(&prepared->invA, sizeof(T) * BLOCK * k));
+            prepared->invA_size = BLOCK * k;
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_trsm_invA<BLOCK>(handle, uplo, diag, k, A, lda, (T*)prepared->invA));
+        }
+
+        *op = prepared.release();
+        return rocblas_status_success;
+    }
+
+    template <rocblas_int BLOCK, typename T>
+    rocblas_status rocblas_trsm_operator_apply_impl(rocblas_handle        handle,
+                                                    rocblas_trsm_operator op,
+                                                    rocblas_int           m,
+                                                    rocblas_int           n,
+                                                    const T*              alpha,
+                                                    T*                    B,
+                                                    rocblas_int           ldb)
+    {
+        return rocblas_trsm_ex_impl<BLOCK>(handle,
+                                           op->side,
+                                           op->uplo,
+                                           op->transA,
+                                           op->diag,
+                                           m,
+                                           n,
+                                           alpha,
+                                           static_cast<const T*>(op->A),
+                                           op->lda,
+                                           B,
+                                           ldb,
+                                           static_cast<const T*>(op->invA),
+                                           op->invA_size);
+    }
+
 }
 
 /*
@@ -387,4 +582,159 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+rocblas_status rocblas_trsm_operator_create(rocblas_handle         handle,
+                                            rocblas_side           side,
+                                            rocblas_fill           uplo,
+                                            rocblas_operation      transA,
+                                            rocblas_diagonal       diag,
+                                            rocblas_int            k,
+                                            const void*            A,
+                                            rocblas_int            lda,
+                                            rocblas_datatype       compute_type,
+                                            rocblas_trsm_operator* op)
+try
+{
+    switch(compute_type)
+    {
+    case rocblas_datatype_f64_r:
+        return rocblas_trsm_operator_create_impl<DTRSM_BLOCK>(handle,
+                                                              side,
+                                                              uplo,
+                                                              transA,
+                                                              diag,
+                                                              k,
+                                                              static_cast<const double*>(A),
+                                                              lda,
+                                                              compute_type,
+                                                              op);
+
+    case rocblas_datatype_f32_r:
+        return rocblas_trsm_operator_create_impl<STRSM_BLOCK>(handle,
+                                                              side,
+                                                              uplo,
+                                                              transA,
+                                                              diag,
+                                                              k,
+                                                              static_cast<const float*>(A),
+                                                              lda,
+                                                              compute_type,
+                                                              op);
+
+    case rocblas_datatype_f32_c:
+        return rocblas_trsm_operator_create_impl<STRSM_BLOCK>(
+            handle,
+            side,
+            uplo,
+            transA,
+            diag,
+            k,
+            static_cast<const rocblas_float_complex*>(A),
+            lda,
+            compute_type,
+            op);
+
+    case rocblas_datatype_f64_c:
+        return rocblas_trsm_operator_create_impl<DTRSM_BLOCK>(
+            handle,
+            side,
+            uplo,
+            transA,
+            diag,
+            k,
+            static_cast<const rocblas_double_complex*>(A),
+            lda,
+            compute_type,
+            op);
+
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_trsm_operator_apply(rocblas_handle        handle,
+                                           rocblas_trsm_operator op,
+                                           rocblas_int           m,
+                                           rocblas_int           n,
+                                           const void*           alpha,
+                                           void*                 B,
+                                           rocblas_int           ldb)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->launch_deferred_gemms();
+    rocblas_profile_scope profile_scope(handle);
+
+    if(!op)
+        return rocblas_status_invalid_pointer;
+
+    // The side of B which A multiplies must match the order of A
+    if((op->side == rocblas_side_left ? m : n) != op->k)
+        return rocblas_status_invalid_size;
+
+    switch(op->compute_type)
+    {
+    case rocblas_datatype_f64_r:
+        return rocblas_trsm_operator_apply_impl<DTRSM_BLOCK>(handle,
+                                                             op,
+                                                             m,
+                                                             n,
+                                                             static_cast<const double*>(alpha),
+                                                             static_cast<double*>(B),
+                                                             ldb);
+
+    case rocblas_datatype_f32_r:
+        return rocblas_trsm_operator_apply_impl<STRSM_BLOCK>(handle,
+                                                             op,
+                                                             m,
+                                                             n,
+                                                             static_cast<const float*>(alpha),
+                                                             static_cast<float*>(B),
+                                                             ldb);
+
+    case rocblas_datatype_f32_c:
+        return rocblas_trsm_operator_apply_impl<STRSM_BLOCK>(
+            handle,
+            op,
+            m,
+            n,
+            static_cast<const rocblas_float_complex*>(alpha),
+            static_cast<rocblas_float_complex*>(B),
+            ldb);
+
+    case rocblas_datatype_f64_c:
+        return rocblas_trsm_operator_apply_impl<DTRSM_BLOCK>(
+            handle,
+            op,
+            m,
+            n,
+            static_cast<const rocblas_double_complex*>(alpha),
+            static_cast<rocblas_double_complex*>(B),
+            ldb);
+
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_trsm_operator_destroy(rocblas_trsm_operator op)
+try
+{
+    delete op;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 } // extern "C"
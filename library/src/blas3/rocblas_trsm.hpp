@@ -14,65 +14,33 @@ static const T zero = T(0);
 template <typename T>
 static const T one = T(1);
 
-template <typename T, typename U, typename V>
-ROCBLAS_KERNEL void copy_matrix_trsm(rocblas_int    rows,
-                                     rocblas_int    cols,
-                                     rocblas_int    elem_size,
-                                     U              a,
-                                     rocblas_int    lda,
-                                     rocblas_stride stride_a,
-                                     V              b,
-                                     rocblas_int    ldb,
-                                     rocblas_stride stride_b,
-                                     rocblas_int    offset_a,
-                                     rocblas_int    offset_b)
-{
-    const T* xa = load_ptr_batch(a, hipBlockIdx_z, offset_a, stride_a);
-    T*       xb = load_ptr_batch(b, hipBlockIdx_z, offset_b, stride_b);
-
-    size_t tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    size_t ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
-
-    if(tx < rows && ty < cols)
-        xb[tx + ldb * ty] = xa[tx + lda * ty];
-}
-
 /* ===============copy helper============================================= */
 template <typename T, typename U, typename V>
-void copy_block_unit(rocblas_handle handle,
-                     rocblas_int    m,
-                     rocblas_int    n,
-                     U              src,
-                     rocblas_int    src_ld,
-                     rocblas_stride src_stride,
-                     V              dst,
-                     rocblas_int    dst_ld,
-                     rocblas_stride dst_stride,
-                     rocblas_int    batch_count,
-                     rocblas_int    offset_src = 0,
-                     rocblas_int    offset_dst = 0)
+rocblas_status copy_block_unit(rocblas_handle handle,
+                               rocblas_int    m,
+                               rocblas_int    n,
+                               U              src,
+                               rocblas_int    src_ld,
+                               rocblas_stride src_stride,
+                               V              dst,
+                               rocblas_int    dst_ld,
+                               rocblas_stride dst_stride,
+                               rocblas_int    batch_count,
+                               rocblas_int    offset_src = 0,
+                               rocblas_int    offset_dst = 0)
 {
-    rocblas_int blocksX = (m - 1) / 128 + 1; // parameters for device kernel
-    rocblas_int blocksY = (n - 1) / 8 + 1;
-    dim3        grid(blocksX, blocksY, batch_count);
-    dim3        threads(128, 8);
-
-    hipLaunchKernelGGL(copy_matrix_trsm<T>,
-                       grid,
-                       threads,
-                       0,
-                       handle->get_stream(),
-                       m,
-                       n,
-                       sizeof(T),
-                       src,
-                       src_ld,
-                       src_stride,
-                       dst,
-                       dst_ld,
-                       dst_stride,
-                       offset_src,
-                       offset_dst);
+    return rocblas_copy_matrix<T>(handle,
+                                  m,
+                                  n,
+                                  src,
+                                  offset_src,
+                                  src_ld,
+                                  src_stride,
+                                  dst,
+                                  offset_dst,
+                                  dst_ld,
+                                  dst_stride,
+                                  batch_count);
 }
 
 template <typename T, typename U>
@@ -1068,18 +1036,19 @@ rocblas_status special_trsm_template(rocblas_handle    handle,
 
                 // copy a BLOCK*n piece we are solving at a time
                 if(!r || !tensile_supports_ldc_ne_ldd)
-                    copy_block_unit<T>(handle,
-                                       BLOCK,
-                                       width,
-                                       B,
-                                       ldb,
-                                       stride_B,
-                                       w_x_temp,
-                                       BLOCK,
-                                       stride_X,
-                                       batch_count,
-                                       j * BLOCK + w * B_chunk_size * ldb + offset_Bin,
-                                       0);
+                    RETURN_IF_ROCBLAS_ERROR(
+                        copy_block_unit<T>(handle,
+                                           BLOCK,
+                                           width,
+                                           B,
+                                           ldb,
+                                           stride_B,
+                                           w_x_temp,
+                                           BLOCK,
+                                           stride_X,
+                                           batch_count,
+                                           j * BLOCK + w * B_chunk_size * ldb + offset_Bin,
+                                           0));
 
                 if(r)
                 {
@@ -1191,18 +1160,19 @@ rocblas_status special_trsm_template(rocblas_handle    handle,
 
                 // copy a m*BLOCK piece we are solving at a time
                 if(!r || !tensile_supports_ldc_ne_ldd)
-                    copy_block_unit<T>(handle,
-                                       width,
-                                       BLOCK,
-                                       B,
-                                       ldb,
-                                       stride_B,
-                                       w_x_temp,
-                                       width,
-                                       stride_X,
-                                       batch_count,
-                                       j * BLOCK * ldb + w * B_chunk_size + offset_Bin,
-                                       0);
+                    RETURN_IF_ROCBLAS_ERROR(
+                        copy_block_unit<T>(handle,
+                                           width,
+                                           BLOCK,
+                                           B,
+                                           ldb,
+                                           stride_B,
+                                           w_x_temp,
+                                           width,
+                                           stride_X,
+                                           batch_count,
+                                           j * BLOCK * ldb + w * B_chunk_size + offset_Bin,
+                                           0));
 
                 if(r)
                 {
@@ -1309,6 +1279,27 @@ rocblas_status special_trsm_template(rocblas_handle    handle,
     return rocblas_status_success;
 }
 
+// Bytes of the temporary memory C of trtri, which computes the inverses of the diagonal blocks
+// of a triangular matrix of order k
+template <rocblas_int BLOCK, typename T>
+size_t rocblas_internal_trsm_trtri_temp_size(rocblas_int k)
+{
+    // When k < BLOCK, C is unnecessary for trtri
+    size_t c_temp_bytes = ((k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2))) * sizeof(T);
+
+    // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
+    if(k % BLOCK)
+    {
+        // TODO: Make this more accurate -- right now it's much larger than necessary
+        size_t remainder_bytes = ROCBLAS_TRTRI_NB * BLOCK * 2 * sizeof(T);
+
+        // C is the maximum of the temporary space needed for TRTRI
+        c_temp_bytes = std::max(c_temp_bytes, remainder_bytes);
+    }
+
+    return c_temp_bytes;
+}
+
 /*! \brief rocblas_internal_trsm_workspace_size
     Calculates needed memory allocation for trsm, does not allocate any memory.
     Note that for the batched version of trsm, we are also allocating memory to store the
@@ -1393,19 +1384,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(supplied_invA_size / BLOCK < k)
     {
         invA_temp_bytes = BLOCK * k * sizeof(T) * batch_count;
-
-        // When k < BLOCK, C is unnecessary for trtri
-        c_temp_bytes = ((k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2))) * sizeof(T);
-
-        // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
-        if(!exact_blocks)
-        {
-            // TODO: Make this more accurate -- right now it's much larger than necessary
-            size_t remainder_bytes = ROCBLAS_TRTRI_NB * BLOCK * 2 * sizeof(T);
-
-            // C is the maximum of the temporary space needed for TRTRI
-            c_temp_bytes = std::max(c_temp_bytes, remainder_bytes);
-        }
+        c_temp_bytes    = rocblas_internal_trsm_trtri_temp_size<BLOCK, T>(k);
     }
 
     if(exact_blocks)
@@ -2501,18 +2480,18 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
             if(status != rocblas_status_success)
                 return status;
 
-            copy_block_unit<T>(handle,
-                               m,
-                               n,
-                               U(BATCHED ? w_x_temparr : w_x_temp),
-                               m,
-                               x_temp_els,
-                               V(B),
-                               ldb,
-                               stride_B,
-                               batch_count,
-                               0,
-                               offset_B);
+            RETURN_IF_ROCBLAS_ERROR(copy_block_unit<T>(handle,
+                                                       m,
+                                                       n,
+                                                       U(BATCHED ? w_x_temparr : w_x_temp),
+                                                       m,
+                                                       x_temp_els,
+                                                       V(B),
+                                                       ldb,
+                                                       stride_B,
+                                                       batch_count,
+                                                       0,
+                                                       offset_B));
         }
 
         // If status is successful, return perf_status; else return status
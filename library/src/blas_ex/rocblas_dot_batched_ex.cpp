@@ -31,6 +31,9 @@ namespace
             return rocblas_status_invalid_handle;
         }
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         size_t dev_bytes
             = rocblas_reduction_kernel_workspace_size<NB>(n, batch_count, execution_type);
         if(handle->is_device_memory_size_query())
@@ -38,7 +41,9 @@ namespace
             if(n <= 0 || batch_count <= 0)
                 return rocblas_status_size_unchanged;
             else
-                return handle->set_optimal_device_memory_size(dev_bytes);
+                return handle->set_optimal_device_memory_size(
+                    dev_bytes,
+                    handle->host_results_size(rocblas_sizeof_datatype(result_type) * batch_count));
         }
 
         auto layer_mode = handle->layer_mode;
@@ -140,21 +145,25 @@ namespace
             return rocblas_status_memory_error;
 
         static constexpr rocblas_stride stride_0 = 0;
-        return rocblas_dot_ex_template<NB, true, CONJ>(handle,
-                                                       n,
-                                                       x,
-                                                       x_type,
-                                                       incx,
-                                                       stride_0,
-                                                       y,
-                                                       y_type,
-                                                       incy,
-                                                       stride_0,
-                                                       batch_count,
-                                                       result,
-                                                       result_type,
-                                                       execution_type,
-                                                       (void*)w_mem);
+        auto dot = [&](void* dst) {
+            return rocblas_dot_ex_template<NB, true, CONJ>(handle,
+                                                           n,
+                                                           x,
+                                                           x_type,
+                                                           incx,
+                                                           stride_0,
+                                                           y,
+                                                           y_type,
+                                                           incy,
+                                                           stride_0,
+                                                           batch_count,
+                                                           dst,
+                                                           result_type,
+                                                           execution_type,
+                                                           (void*)w_mem);
+        };
+        return handle->reduce_to_host_results(
+            result, rocblas_sizeof_datatype(result_type) * batch_count, dot);
     }
 
 }
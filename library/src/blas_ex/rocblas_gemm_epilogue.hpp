@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+#include <type_traits>
+
+/*******************************************************************************
+ * Check the epilogue of rocblas_gemm_epilogue_ex for an m x n matrix D.
+ * Returns rocblas_status_continue if the epilogue can be applied. This does not
+ * call HIP, so it can be tested on the host.
+ ******************************************************************************/
+inline rocblas_status rocblas_gemm_epilogue_validate(rocblas_int                  m,
+                                                     rocblas_datatype             d_type,
+                                                     rocblas_datatype             compute_type,
+                                                     const rocblas_gemm_epilogue* epilogue)
+{
+    if(!epilogue)
+        return rocblas_status_invalid_pointer;
+
+    auto valid_mode = [](rocblas_epilogue_vector mode) {
+        return mode == rocblas_epilogue_vector_none || mode == rocblas_epilogue_vector_row
+               || mode == rocblas_epilogue_vector_column;
+    };
+    if(!valid_mode(epilogue->scale_mode) || !valid_mode(epilogue->bias_mode))
+        return rocblas_status_invalid_value;
+    if(epilogue->activation != rocblas_activation_none
+       && epilogue->activation != rocblas_activation_relu
+       && epilogue->activation != rocblas_activation_gelu)
+        return rocblas_status_invalid_value;
+
+    // D is computed in the real floating point types, and the epilogue in the compute type
+    bool types = false;
+    switch(compute_type)
+    {
+    case rocblas_datatype_f16_r:
+    case rocblas_datatype_f64_r:
+        types = d_type == compute_type;
+        break;
+    case rocblas_datatype_f32_r:
+        types = d_type == rocblas_datatype_f32_r || d_type == rocblas_datatype_f16_r
+                || d_type == rocblas_datatype_bf16_r;
+        break;
+    default:
+        break;
+    }
+    if(epilogue->output)
+    {
+        switch(epilogue->output_type)
+        {
+        case rocblas_datatype_f16_r:
+        case rocblas_datatype_bf16_r:
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_f64_r:
+            break;
+        default:
+            types = false;
+        }
+    }
+    if(!types)
+        return rocblas_status_not_implemented;
+
+    if(epilogue->output && epilogue->ldo < m)
+        return rocblas_status_invalid_size;
+
+    return rocblas_status_continue;
+}
+
+// Whether the epilogue leaves D unchanged, so that no pass over D is needed
+inline bool rocblas_gemm_epilogue_is_identity(const rocblas_gemm_epilogue& epilogue)
+{
+    return epilogue.scale_mode == rocblas_epilogue_vector_none
+           && epilogue.bias_mode == rocblas_epilogue_vector_none
+           && epilogue.activation == rocblas_activation_none && !epilogue.output;
+}
+
+template <typename T>
+__device__ T rocblas_gemm_epilogue_activation(T x, rocblas_activation activation)
+{
+    switch(activation)
+    {
+    case rocblas_activation_relu:
+        return x > 0 ? x : T(0);
+    case rocblas_activation_gelu:
+        return T(0.5) * x
+               * (T(1) + tanh(T(0.7978845608028654) * (x + T(0.044715) * x * x * x)));
+    default:
+        return x;
+    }
+}
+
+/*******************************************************************************
+ * Epilogue kernel: one pass which reads D and writes the output, in place of
+ * separate scaling, bias and activation passes. Tw is the working precision.
+ ******************************************************************************/
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename Tw, typename Tc, typename Td, typename To>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+    rocblas_gemm_epilogue_kernel(rocblas_int             m,
+                                 rocblas_int             n,
+                                 const Td*               d,
+                                 rocblas_int             ldd,
+                                 const Tc*               scale,
+                                 rocblas_epilogue_vector scale_mode,
+                                 const Tc*               bias,
+                                 rocblas_epilogue_vector bias_mode,
+                                 rocblas_activation      activation,
+                                 To*                     output,
+                                 rocblas_int             ldo)
+{
+    rocblas_int i = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * DIM_Y + hipThreadIdx_y;
+    if(i >= m || j >= n)
+        return;
+
+    Tw x = Tw(d[i + size_t(ldd) * j]);
+    if(scale_mode != rocblas_epilogue_vector_none)
+        x *= Tw(scale[scale_mode == rocblas_epilogue_vector_row ? i : j]);
+    if(bias_mode != rocblas_epilogue_vector_none)
+        x += Tw(bias[bias_mode == rocblas_epilogue_vector_row ? i : j]);
+
+    output[i + size_t(ldo) * j] = To(rocblas_gemm_epilogue_activation(x, activation));
+}
+
+template <typename Tc, typename Td, typename To>
+rocblas_status rocblas_gemm_epilogue_launch(rocblas_handle               handle,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            const Td*                    d,
+                                            rocblas_int                  ldd,
+                                            const rocblas_gemm_epilogue& epilogue,
+                                            To*                          output,
+                                            rocblas_int                  ldo)
+{
+    static constexpr rocblas_int DIM_X = 64;
+    static constexpr rocblas_int DIM_Y = 16;
+
+    // Half precision epilogues are computed in single precision
+    using Tw = std::conditional_t<std::is_same<Tc, double>{}, double, float>;
+
+    dim3 grid((m - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1);
+    dim3 threads(DIM_X, DIM_Y);
+
+    hipLaunchKernelGGL((rocblas_gemm_epilogue_kernel<DIM_X, DIM_Y, Tw, Tc>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       m,
+                       n,
+                       d,
+                       ldd,
+                       (const Tc*)epilogue.scale,
+                       epilogue.scale_mode,
+                       (const Tc*)epilogue.bias,
+                       epilogue.bias_mode,
+                       epilogue.activation,
+                       output,
+                       ldo);
+    return rocblas_status_success;
+}
+
+template <typename Tc, typename Td>
+rocblas_status rocblas_gemm_epilogue_typecasting(rocblas_handle               handle,
+                                                 rocblas_int                  m,
+                                                 rocblas_int                  n,
+                                                 void*                        d,
+                                                 rocblas_int                  ldd,
+                                                 const rocblas_gemm_epilogue& epilogue)
+{
+    if(!epilogue.output)
+        return rocblas_gemm_epilogue_launch<Tc>(
+            handle, m, n, (const Td*)d, ldd, epilogue, (Td*)d, ldd);
+
+#define EPILOGUE_LAUNCH(To)           \
+    rocblas_gemm_epilogue_launch<Tc>( \
+        handle, m, n, (const Td*)d, ldd, epilogue, (To*)epilogue.output, epilogue.ldo)
+
+    switch(epilogue.output_type)
+    {
+    case rocblas_datatype_f16_r:
+        return EPILOGUE_LAUNCH(rocblas_half);
+    case rocblas_datatype_bf16_r:
+        return EPILOGUE_LAUNCH(rocblas_bfloat16);
+    case rocblas_datatype_f32_r:
+        return EPILOGUE_LAUNCH(float);
+    case rocblas_datatype_f64_r:
+        return EPILOGUE_LAUNCH(double);
+    default:
+        return rocblas_status_not_implemented;
+    }
+
+#undef EPILOGUE_LAUNCH
+}
+
+/*******************************************************************************
+ * Apply a validated epilogue to the m x n matrix D on the handle's stream.
+ ******************************************************************************/
+inline rocblas_status rocblas_gemm_epilogue_template(rocblas_handle               handle,
+                                                     rocblas_int                  m,
+                                                     rocblas_int                  n,
+                                                     void*                        d,
+                                                     rocblas_datatype             d_type,
+                                                     rocblas_int                  ldd,
+                                                     rocblas_datatype             compute_type,
+                                                     const rocblas_gemm_epilogue& epilogue)
+{
+    if(!m || !n || rocblas_gemm_epilogue_is_identity(epilogue))
+        return rocblas_status_success;
+
+    switch(compute_type)
+    {
+    case rocblas_datatype_f16_r:
+        return rocblas_gemm_epilogue_typecasting<rocblas_half, rocblas_half>(
+            handle, m, n, d, ldd, epilogue);
+    case rocblas_datatype_f64_r:
+        return rocblas_gemm_epilogue_typecasting<double, double>(handle, m, n, d, ldd, epilogue);
+    case rocblas_datatype_f32_r:
+        switch(d_type)
+        {
+        case rocblas_datatype_f16_r:
+            return rocblas_gemm_epilogue_typecasting<float, rocblas_half>(
+                handle, m, n, d, ldd, epilogue);
+        case rocblas_datatype_bf16_r:
+            return rocblas_gemm_epilogue_typecasting<float, rocblas_bfloat16>(
+                handle, m, n, d, ldd, epilogue);
+        case rocblas_datatype_f32_r:
+            return rocblas_gemm_epilogue_typecasting<float, float>(handle, m, n, d, ldd, epilogue);
+        default:
+            return rocblas_status_not_implemented;
+        }
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
@@ -38,17 +38,29 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
-        if(!HPA)
-            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        // Without HPA, Tensile takes no workspace, and in device pointer mode, the product A*B is
+        // held in device memory
+        if(!HPA && handle->is_device_memory_size_query())
+            return rocblas_gemm_device_scalars_size(
+                handle, m, n, k, 1, false, rocblas_sizeof_datatype(compute_type));
 
-        // Copy alpha and beta to host if on device
+        // Copy alpha and beta to host if on device, and if they are needed there, which includes
+        // checking that they are 0 when C, or A or B, is nullptr
         rocblas_union_t alpha_h, beta_h;
-        RETURN_IF_ROCBLAS_ERROR(copy_alpha_beta_to_host_if_on_device(
-            handle, alpha, beta, alpha_h, beta_h, k, compute_type));
-        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        bool            host_scalars
+            = rocblas_gemm_needs_host_scalars(handle) || !c || (k && (!a || !b));
+        if(host_scalars)
+            RETURN_IF_ROCBLAS_ERROR(copy_alpha_beta_to_host_if_on_device(
+                handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+        auto saved_pointer_mode   = handle->push_pointer_mode(
+            host_scalars ? rocblas_pointer_mode_host : handle->pointer_mode);
+        auto saved_solution_index = handle->push_solution_index(algo, solution_index);
 
         // If this is a solution fitness query (internal testing), bypass logging and error checks
         if(handle->get_solution_fitness_query())
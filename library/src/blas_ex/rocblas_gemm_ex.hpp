@@ -11,6 +11,7 @@
 #include "gemm.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
+#include "matrix_copy.hpp"
 
 /////////////////
 // Device Side //
@@ -30,40 +31,9 @@ rocblas_status device_strided_batched_matrix_copy(rocblas_handle handle,
     if(rocblas_internal_tensile_debug_skip_launch())
         return rocblas_status_success;
 
-    if(src == dst && ld_src == ld_dst && stride_src == stride_dst)
-        return rocblas_status_success; // no copy if src matrix == dst matrix
-
-    if(n1 == ld_src && n1 == ld_dst && stride_src == n2 * ld_src && stride_dst == n2 * ld_dst)
-    {
-        // src and dst batch matrices are contiguous, use single copy
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dst,
-                                           src,
-                                           sizeof(To) * n1 * n2 * batch_count,
-                                           hipMemcpyDeviceToDevice,
-                                           handle->get_stream()));
-    }
-    else if(n1 == ld_src && n1 == ld_dst)
-    {
-        // individual matrices in batch matrix are contiguous, one copy for each matrix
-        for(size_t i3 = 0; i3 < batch_count; i3++)
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(dst + i3 * stride_dst,
-                                               src + i3 * stride_src,
-                                               sizeof(To) * n1 * n2,
-                                               hipMemcpyDeviceToDevice,
-                                               handle->get_stream()));
-    }
-    else
-    {
-        // individual matrices not contiguous, one copy for each contiguous column
-        for(int i3 = 0; i3 < batch_count; i3++)
-            for(int i2 = 0; i2 < n2; i2++)
-                RETURN_IF_HIP_ERROR(hipMemcpyAsync(dst + i2 * ld_dst + i3 * stride_dst,
-                                                   src + i2 * ld_src + i3 * stride_src,
-                                                   sizeof(To) * n1,
-                                                   hipMemcpyDeviceToDevice,
-                                                   handle->get_stream()));
-    }
-    return rocblas_status_success;
+    // One memcpy or kernel launch for all of the matrices
+    return rocblas_copy_matrix<To>(
+        handle, n1, n2, src, 0, ld_src, stride_src, dst, 0, ld_dst, stride_dst, batch_count);
 }
 
 #ifndef USE_TENSILE_HOST
@@ -693,9 +663,12 @@ rocblas_status gemm_ex_typecasting(rocblas_handle     handle,
                                    rocblas_int        batch_count,
                                    rocblas_gemm_flags flags)
 {
+#ifndef USE_TENSILE_HOST
+    // The legacy Tensile client takes alpha and beta by value
     Tc alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
         copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+#endif
 
     // check alignment of pointers before casting
     if(BATCHED)
@@ -176,14 +176,21 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
-        // Copy alpha and beta to host if on device
+        // Copy alpha and beta to host if on device, and if they are needed there
         rocblas_union_t alpha_h, beta_h;
-        RETURN_IF_ROCBLAS_ERROR(copy_alpha_beta_to_host_if_on_device(
-            handle, alpha, beta, alpha_h, beta_h, k, compute_type));
-        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        bool            host_scalars = rocblas_gemm_needs_host_scalars(handle);
+        if(host_scalars)
+            RETURN_IF_ROCBLAS_ERROR(copy_alpha_beta_to_host_if_on_device(
+                handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+        auto saved_pointer_mode   = handle->push_pointer_mode(
+            host_scalars ? rocblas_pointer_mode_host : handle->pointer_mode);
+        auto saved_solution_index = handle->push_solution_index(algo, solution_index);
 
         if(!handle->is_device_memory_size_query())
         {
@@ -445,6 +452,10 @@ namespace
                                          : nullptr};
             std::unique_ptr<char[]> hd{new char[rocblas_sizeof_datatype(d_type) * size_d]};
 
+            // The on-host algorithm needs alpha and beta on the host
+            RETURN_IF_ROCBLAS_ERROR(copy_alpha_beta_to_host_if_on_device(
+                handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+
             if(a)
                 RETURN_IF_HIP_ERROR(hipMemcpy(
                     ha.get(), a, rocblas_sizeof_datatype(a_type) * size_a, hipMemcpyDeviceToHost));
@@ -108,10 +108,6 @@ rocblas_status gemm_ext2_typecasting(rocblas_handle handle,
                                      rocblas_stride batch_stride_d,
                                      rocblas_int    batch_count)
 {
-    Tc alpha_h, beta_h;
-    RETURN_IF_ROCBLAS_ERROR(
-        copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
-
     // check alignment of pointers before casting
     if(!isAligned(a, sizeof(Ti)) || !isAligned(b, sizeof(Ti)) || !isAligned(c, sizeof(To))
        || !isAligned(d, sizeof(To)))
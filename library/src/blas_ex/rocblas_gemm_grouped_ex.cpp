@@ -0,0 +1,358 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_gemm_grouped_ex.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+#include <algorithm>
+
+namespace
+{
+    rocblas_status rocblas_gemm_grouped_ex_impl(rocblas_handle           handle,
+                                                rocblas_int              group_count,
+                                                const rocblas_operation* trans_a,
+                                                const rocblas_operation* trans_b,
+                                                const rocblas_int*       m,
+                                                const rocblas_int*       n,
+                                                const rocblas_int*       k,
+                                                const void*              alpha,
+                                                const void*              a,
+                                                rocblas_datatype         a_type,
+                                                const rocblas_int*       lda,
+                                                const void*              b,
+                                                rocblas_datatype         b_type,
+                                                const rocblas_int*       ldb,
+                                                const void*              beta,
+                                                const void*              c,
+                                                rocblas_datatype         c_type,
+                                                const rocblas_int*       ldc,
+                                                void*                    d,
+                                                rocblas_datatype         d_type,
+                                                const rocblas_int*       ldd,
+                                                const rocblas_int*       group_size,
+                                                rocblas_datatype         compute_type,
+                                                rocblas_gemm_algo        algo,
+                                                int32_t                  solution_index,
+                                                uint32_t                 flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_gemm_grouped_ex",
+                      group_count,
+                      a,
+                      rocblas_datatype_string(a_type),
+                      b,
+                      rocblas_datatype_string(b_type),
+                      c,
+                      rocblas_datatype_string(c_type),
+                      d,
+                      rocblas_datatype_string(d_type),
+                      rocblas_datatype_string(compute_type),
+                      algo,
+                      solution_index,
+                      rocblas_gemm_flags(flags));
+
+        if(group_count < 0)
+            return rocblas_status_invalid_size;
+        if(!group_count)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return rocblas_status_success;
+        }
+        if(!trans_a || !trans_b || !m || !n || !k || !alpha || !lda || !ldb || !beta || !ldc
+           || !ldd || !group_size)
+            return rocblas_status_invalid_pointer;
+
+        // At most, the pointers of every problem are gathered into workspace
+        if(handle->is_device_memory_size_query())
+        {
+            size_t problems = 0;
+            for(rocblas_int g = 0; g < group_count; ++g)
+                problems += std::max(group_size[g], 0);
+            if(!problems)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(sizeof(void*) * 4 * problems);
+        }
+
+        // The scalars of all groups are used on the host, and copied with one synchronization
+        size_t            scalar_size = rocblas_sizeof_datatype(compute_type);
+        std::vector<char> alpha_h, beta_h;
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            alpha_h.resize(scalar_size * group_count);
+            beta_h.resize(scalar_size * group_count);
+            hipStream_t stream = handle->get_stream();
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                alpha_h.data(), alpha, alpha_h.size(), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                beta_h.data(), beta, beta_h.size(), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+            alpha = alpha_h.data();
+            beta  = beta_h.data();
+        }
+        auto saved_pointer_mode   = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        auto saved_solution_index = handle->push_solution_index(algo, solution_index);
+
+        // Each group is validated like rocblas_gemm_batched_ex
+        for(rocblas_int g = 0; g < group_count; ++g)
+        {
+            auto validArgs = validateArgs(handle,
+                                          trans_a[g],
+                                          trans_b[g],
+                                          m[g],
+                                          n[g],
+                                          k[g],
+                                          static_cast<const char*>(alpha) + g * scalar_size,
+                                          a,
+                                          lda[g],
+                                          b,
+                                          ldb[g],
+                                          static_cast<const char*>(beta) + g * scalar_size,
+                                          c,
+                                          ldc[g],
+                                          d,
+                                          ldd[g],
+                                          compute_type,
+                                          group_size[g]);
+            if(validArgs != rocblas_status_continue && validArgs != rocblas_status_success)
+                return validArgs;
+        }
+
+        auto launches = rocblas_plan_gemm_grouped(group_count,
+                                                  trans_a,
+                                                  trans_b,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  lda,
+                                                  ldb,
+                                                  beta,
+                                                  ldc,
+                                                  ldd,
+                                                  group_size,
+                                                  scalar_size);
+
+        // Launches whose problems are not consecutive gather their pointers into workspace
+        size_t gathered = 0;
+        for(auto& launch : launches)
+            if(launch.segments.size() > 1)
+                gathered += launch.batch_count;
+        auto w_mem = handle->device_malloc(sizeof(void*) * 4 * gathered);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+        auto* w_ptrs = (void**)w_mem;
+
+        const bool HPA = compute_type == rocblas_datatype_f32_r
+                         && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
+
+        for(auto& launch : launches)
+        {
+            rocblas_int g       = launch.group;
+            rocblas_int batch   = launch.batch_count;
+            rocblas_int first   = launch.segments[0].first;
+            auto        a_array = (const void* const*)a + first;
+            auto        b_array = (const void* const*)b + first;
+            auto        c_array = (const void* const*)c + first;
+            auto        d_array = (void**)d + first;
+
+            if(launch.segments.size() > 1)
+            {
+                const void* const* arrays[] = {(const void* const*)a,
+                                               (const void* const*)b,
+                                               (const void* const*)c,
+                                               (const void* const*)d};
+                for(int i = 0; i < 4; ++i)
+                {
+                    rocblas_int pos = 0;
+                    for(auto& segment : launch.segments)
+                    {
+                        RETURN_IF_HIP_ERROR(hipMemcpyAsync(w_ptrs + i * batch + pos,
+                                                           arrays[i] + segment.first,
+                                                           sizeof(void*) * segment.second,
+                                                           hipMemcpyDeviceToDevice,
+                                                           handle->get_stream()));
+                        pos += segment.second;
+                    }
+                }
+                a_array = w_ptrs;
+                b_array = w_ptrs + batch;
+                c_array = w_ptrs + 2 * batch;
+                d_array = w_ptrs + 3 * batch;
+                w_ptrs += 4 * batch;
+            }
+
+            const void* alpha_g = static_cast<const char*>(alpha) + g * scalar_size;
+            const void* beta_g  = static_cast<const char*>(beta) + g * scalar_size;
+
+            // Each launch is profiled as one batched problem
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            "rocblas_gemm_grouped_ex",
+                            "a_type",
+                            rocblas_datatype_string(a_type),
+                            "b_type",
+                            rocblas_datatype_string(b_type),
+                            "c_type",
+                            rocblas_datatype_string(c_type),
+                            "d_type",
+                            rocblas_datatype_string(d_type),
+                            "compute_type",
+                            rocblas_datatype_string(compute_type),
+                            "transA",
+                            rocblas_transpose_letter(trans_a[g]),
+                            "transB",
+                            rocblas_transpose_letter(trans_b[g]),
+                            "M",
+                            m[g],
+                            "N",
+                            n[g],
+                            "K",
+                            k[g],
+                            "alpha",
+                            value_category(alpha_g, compute_type),
+                            "lda",
+                            lda[g],
+                            "ldb",
+                            ldb[g],
+                            "beta",
+                            value_category(beta_g, compute_type),
+                            "ldc",
+                            ldc[g],
+                            "ldd",
+                            ldd[g],
+                            "batch_count",
+                            batch,
+                            "algo",
+                            algo,
+                            "solution_index",
+                            solution_index,
+                            "flags",
+                            rocblas_gemm_flags(flags));
+
+            auto gemm_ex = [&] {
+                return rocblas_gemm_ex_template<true>(handle,
+                                                      trans_a[g],
+                                                      trans_b[g],
+                                                      m[g],
+                                                      n[g],
+                                                      k[g],
+                                                      alpha_g,
+                                                      a_array,
+                                                      a_type,
+                                                      0,
+                                                      lda[g],
+                                                      0,
+                                                      b_array,
+                                                      b_type,
+                                                      0,
+                                                      ldb[g],
+                                                      0,
+                                                      beta_g,
+                                                      c_array,
+                                                      c_type,
+                                                      0,
+                                                      ldc[g],
+                                                      0,
+                                                      d_array,
+                                                      d_type,
+                                                      0,
+                                                      ldd[g],
+                                                      0,
+                                                      batch,
+                                                      compute_type,
+                                                      flags);
+            };
+
+            if(HPA)
+            {
+                // Allocate GSU workspace in handle
+                auto gsu_malloc = handle->gsu_malloc();
+                RETURN_IF_ROCBLAS_ERROR(gemm_ex());
+            }
+            else
+            {
+                RETURN_IF_ROCBLAS_ERROR(gemm_ex());
+            }
+        }
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_gemm_grouped_ex(rocblas_handle           handle,
+                                                  rocblas_int              group_count,
+                                                  const rocblas_operation* trans_a,
+                                                  const rocblas_operation* trans_b,
+                                                  const rocblas_int*       m,
+                                                  const rocblas_int*       n,
+                                                  const rocblas_int*       k,
+                                                  const void*              alpha,
+                                                  const void*              a,
+                                                  rocblas_datatype         a_type,
+                                                  const rocblas_int*       lda,
+                                                  const void*              b,
+                                                  rocblas_datatype         b_type,
+                                                  const rocblas_int*       ldb,
+                                                  const void*              beta,
+                                                  const void*              c,
+                                                  rocblas_datatype         c_type,
+                                                  const rocblas_int*       ldc,
+                                                  void*                    d,
+                                                  rocblas_datatype         d_type,
+                                                  const rocblas_int*       ldd,
+                                                  const rocblas_int*       group_size,
+                                                  rocblas_datatype         compute_type,
+                                                  rocblas_gemm_algo        algo,
+                                                  int32_t                  solution_index,
+                                                  uint32_t                 flags)
+try
+{
+    return rocblas_gemm_grouped_ex_impl(handle,
+                                        group_count,
+                                        trans_a,
+                                        trans_b,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        a,
+                                        a_type,
+                                        lda,
+                                        b,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        c,
+                                        c_type,
+                                        ldc,
+                                        d,
+                                        d_type,
+                                        ldd,
+                                        group_size,
+                                        compute_type,
+                                        algo,
+                                        solution_index,
+                                        flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+ * A launch of rocblas_gemm_grouped_ex is one batched gemm over all of the
+ * problems of the groups with the same transposes, sizes, leading dimensions,
+ * alpha and beta, since a batched gemm takes one of each. Groups whose sizes
+ * differ are launched separately, even when Tensile selects the same solution
+ * for them.
+ ******************************************************************************/
+struct rocblas_gemm_grouped_launch
+{
+    rocblas_int group; // First group of the launch, whose arguments are used
+    rocblas_int batch_count; // Number of problems in the launch
+
+    // Ranges of problems (first, count) in the pointer arrays, in order
+    std::vector<std::pair<rocblas_int, rocblas_int>> segments;
+};
+
+/*******************************************************************************
+ * Plan the launches of rocblas_gemm_grouped_ex. The problems of each group are
+ * consecutive in the pointer arrays. alpha and beta are host arrays of
+ * scalar_size-byte scalars, one per group. Groups without work are skipped,
+ * and the launches are in the order of their first groups. This does not call
+ * HIP, so it can be tested on the host.
+ ******************************************************************************/
+inline std::vector<rocblas_gemm_grouped_launch>
+    rocblas_plan_gemm_grouped(rocblas_int              group_count,
+                              const rocblas_operation* trans_a,
+                              const rocblas_operation* trans_b,
+                              const rocblas_int*       m,
+                              const rocblas_int*       n,
+                              const rocblas_int*       k,
+                              const void*              alpha,
+                              const rocblas_int*       lda,
+                              const rocblas_int*       ldb,
+                              const void*              beta,
+                              const rocblas_int*       ldc,
+                              const rocblas_int*       ldd,
+                              const rocblas_int*       group_size,
+                              size_t                   scalar_size)
+{
+    using key_t = std::tuple<rocblas_operation,
+                             rocblas_operation,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_int,
+                             std::string>;
+
+    std::vector<rocblas_gemm_grouped_launch> launches;
+    std::map<key_t, size_t>                  launch_of_key;
+
+    rocblas_int first = 0;
+    for(rocblas_int g = 0; g < group_count; first += group_size[g++])
+    {
+        if(!group_size[g] || !m[g] || !n[g])
+            continue;
+
+        // Scalars are compared by value, as bytes
+        std::string scalars(static_cast<const char*>(alpha) + g * scalar_size, scalar_size);
+        scalars.append(static_cast<const char*>(beta) + g * scalar_size, scalar_size);
+
+        key_t key{trans_a[g],
+                  trans_b[g],
+                  m[g],
+                  n[g],
+                  k[g],
+                  lda[g],
+                  ldb[g],
+                  ldc[g],
+                  ldd[g],
+                  std::move(scalars)};
+
+        auto it = launch_of_key.emplace(std::move(key), launches.size()).first;
+        if(it->second == launches.size())
+            launches.push_back({g, 0, {}});
+
+        // Extend the last segment if this group follows it in the pointer arrays
+        auto& launch = launches[it->second];
+        if(!launch.segments.empty()
+           && launch.segments.back().first + launch.segments.back().second == first)
+            launch.segments.back().second += group_size[g];
+        else
+            launch.segments.emplace_back(first, group_size[g]);
+        launch.batch_count += group_size[g];
+    }
+    return launches;
+}
@@ -24,6 +24,9 @@ namespace
             return rocblas_status_invalid_handle;
         }
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         size_t dev_bytes
             = rocblas_reduction_kernel_workspace_size<NB>(n, batch_count, execution_type);
 
@@ -35,7 +38,9 @@ namespace
             }
             else
             {
-                return handle->set_optimal_device_memory_size(dev_bytes);
+                return handle->set_optimal_device_memory_size(
+                    dev_bytes,
+                    handle->host_results_size(rocblas_sizeof_datatype(result_type) * batch_count));
             }
         }
 
@@ -126,18 +131,22 @@ namespace
         static constexpr rocblas_stride stridex_0 = 0;
         static constexpr rocblas_int    shiftx_0  = 0;
 
-        return rocblas_nrm2_ex_template<NB, isbatched>(handle,
-                                                       n,
-                                                       x,
-                                                       x_type,
-                                                       shiftx_0,
-                                                       incx,
-                                                       stridex_0,
-                                                       batch_count,
-                                                       results,
-                                                       result_type,
-                                                       execution_type,
-                                                       (void*)w_mem);
+        auto nrm2 = [&](void* dst) {
+            return rocblas_nrm2_ex_template<NB, isbatched>(handle,
+                                                           n,
+                                                           x,
+                                                           x_type,
+                                                           shiftx_0,
+                                                           incx,
+                                                           stridex_0,
+                                                           batch_count,
+                                                           dst,
+                                                           result_type,
+                                                           execution_type,
+                                                           (void*)w_mem);
+        };
+        return handle->reduce_to_host_results(
+            results, rocblas_sizeof_datatype(result_type) * batch_count, nrm2);
     }
 
 } // namespace
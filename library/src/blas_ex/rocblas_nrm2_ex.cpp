@@ -23,6 +23,9 @@ namespace
             return rocblas_status_invalid_handle;
         }
 
+        handle->launch_deferred_gemms();
+        rocblas_profile_scope profile_scope(handle);
+
         size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB>(n, 1, execution_type);
 
         if(handle->is_device_memory_size_query())
@@ -33,7 +36,8 @@ namespace
             }
             else
             {
-                return handle->set_optimal_device_memory_size(dev_bytes);
+                return handle->set_optimal_device_memory_size(
+                    dev_bytes, handle->host_results_size(rocblas_sizeof_datatype(result_type)));
             }
         }
 
@@ -111,18 +115,22 @@ namespace
         static constexpr rocblas_int    batch_count_1 = 1;
         static constexpr rocblas_int    shiftx_0      = 0;
 
-        return rocblas_nrm2_ex_template<NB, isbatched>(handle,
-                                                       n,
-                                                       x,
-                                                       x_type,
-                                                       shiftx_0,
-                                                       incx,
-                                                       stridex_0,
-                                                       batch_count_1,
-                                                       results,
-                                                       result_type,
-                                                       execution_type,
-                                                       (void*)w_mem);
+        auto nrm2 = [&](void* dst) {
+            return rocblas_nrm2_ex_template<NB, isbatched>(handle,
+                                                           n,
+                                                           x,
+                                                           x_type,
+                                                           shiftx_0,
+                                                           incx,
+                                                           stridex_0,
+                                                           batch_count_1,
+                                                           dst,
+                                                           result_type,
+                                                           execution_type,
+                                                           (void*)w_mem);
+        };
+        return handle->reduce_to_host_results(
+            results, rocblas_sizeof_datatype(result_type) * batch_count_1, nrm2);
     }
 
 } // namespace
@@ -48,18 +48,6 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!m || !n || !batch_count || !A)
         return rocblas_status_success;
 
-    //Creating structure host object
-    rocblas_check_numerics_t h_abnormal;
-
-    //Allocating memory for device structure
-    auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
-
-    //Transferring the rocblas_check_numerics_t structure from host to the device
-    RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_t*)d_abnormal,
-                                  &h_abnormal,
-                                  sizeof(rocblas_check_numerics_t),
-                                  hipMemcpyHostToDevice));
-
     //Checking trans_a to transpose a matrix 'A'
     rocblas_int num_rows_a = trans_a == rocblas_operation_none ? m : n;
     rocblas_int num_cols_a = trans_a == rocblas_operation_none ? n : m;
@@ -73,6 +61,40 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     dim3 blocks(blocks_X, blocks_Y, batch_count);
     dim3 threads(DIM_X, DIM_Y);
 
+    //In deferred mode, the structure is a persistent record which is reported later
+    if(check_numerics & rocblas_check_numerics_mode_deferred)
+    {
+        rocblas_check_numerics_t* d_record;
+        RETURN_IF_ROCBLAS_ERROR(handle->check_numerics_deferred.begin(rocblas_stream, &d_record));
+
+        hipLaunchKernelGGL(rocblas_check_numerics_ge_matrix_kernel,
+                           blocks,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           num_rows_a,
+                           num_cols_a,
+                           A,
+                           offset_a,
+                           lda,
+                           stride_a,
+                           d_record);
+
+        return handle->check_numerics_deferred.end(function_name, check_numerics, is_input);
+    }
+
+    //Creating structure host object
+    rocblas_check_numerics_t h_abnormal;
+
+    //Allocating memory for device structure
+    auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
+
+    //Transferring the rocblas_check_numerics_t structure from host to the device
+    RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_t*)d_abnormal,
+                                  &h_abnormal,
+                                  sizeof(rocblas_check_numerics_t),
+                                  hipMemcpyHostToDevice));
+
     hipLaunchKernelGGL(rocblas_check_numerics_ge_matrix_kernel,
                        blocks,
                        threads,
@@ -55,6 +55,89 @@ rocblas_status rocblas_check_numerics_abnormal_struct(const char*
     }
     return rocblas_status_success;
 }
+
+/*******************************************************************************
+ * rocblas_check_numerics_deferred functions
+ ******************************************************************************/
+
+rocblas_check_numerics_deferred::~rocblas_check_numerics_deferred()
+{
+    // Report any checks which are still pending before releasing the records
+    harvest(true);
+
+    if(event)
+        hipEventDestroy(event);
+    if(h_records)
+        hipHostFree(h_records);
+    if(d_records)
+        (hipFree)(d_records);
+}
+
+rocblas_status rocblas_check_numerics_deferred::begin(hipStream_t                stream,
+                                                      rocblas_check_numerics_t** record)
+{
+    // Checks on another stream, or a full buffer, require the pending checks to be waited on
+    bool wait = !pending.empty() && (stream != this->stream || pending.size() == MAX_PENDING);
+    RETURN_IF_ROCBLAS_ERROR(harvest(wait));
+
+    // Allocate the records on first use
+    if(!d_records)
+    {
+        RETURN_IF_HIP_ERROR(
+            (hipMalloc)(&d_records, MAX_PENDING * sizeof(rocblas_check_numerics_t)));
+        RETURN_IF_HIP_ERROR(hipHostMalloc(&h_records,
+                                          MAX_PENDING * sizeof(rocblas_check_numerics_t),
+                                          hipHostMallocDefault));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+    }
+
+    this->stream = stream;
+    *record      = d_records + pending.size();
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(*record, 0, sizeof(rocblas_check_numerics_t), stream));
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_check_numerics_deferred::end(const char* function_name,
+                                                    int         check_numerics,
+                                                    bool        is_input)
+{
+    size_t slot = pending.size();
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_records + slot,
+                                       d_records + slot,
+                                       sizeof(rocblas_check_numerics_t),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipEventRecord(event, stream));
+    pending.push_back({function_name, check_numerics, is_input});
+
+    // A NaN/Inf found by an earlier check in fail mode is returned here
+    return take_status();
+}
+
+rocblas_status rocblas_check_numerics_deferred::harvest(bool wait)
+{
+    if(pending.empty())
+        return rocblas_status_success;
+
+    // The event follows the latest copy, so all pending records are on the host once it completes
+    if(wait)
+        RETURN_IF_HIP_ERROR(hipEventSynchronize(event));
+    else if(hipEventQuery(event) != hipSuccess)
+        return rocblas_status_success;
+
+    for(size_t i = 0; i < pending.size(); ++i)
+    {
+        if(rocblas_check_numerics_abnormal_struct(pending[i].function_name,
+                                                  pending[i].check_numerics,
+                                                  pending[i].is_input,
+                                                  &h_records[i])
+           != rocblas_status_success)
+            failed = true;
+    }
+    pending.clear();
+    return rocblas_status_success;
+}
+
 /**
   *
   * rocblas_internal_check_numerics_vector_template(function_name, handle, n, x, offset_x, inc_x, stride_x, batch_count, check_numerics, is_input)
@@ -100,6 +183,32 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_success;
     }
 
+    hipStream_t           rocblas_stream = handle->get_stream();
+    constexpr rocblas_int NB             = 256;
+    dim3                  blocks((n - 1) / NB + 1, batch_count);
+    dim3                  threads(NB);
+
+    //In deferred mode, the structure is a persistent record which is reported later
+    if(check_numerics & rocblas_check_numerics_mode_deferred)
+    {
+        rocblas_check_numerics_t* d_record;
+        RETURN_IF_ROCBLAS_ERROR(handle->check_numerics_deferred.begin(rocblas_stream, &d_record));
+
+        hipLaunchKernelGGL(rocblas_check_numerics_vector_kernel,
+                           blocks,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           n,
+                           x,
+                           offset_x,
+                           inc_x,
+                           stride_x,
+                           d_record);
+
+        return handle->check_numerics_deferred.end(function_name, check_numerics, is_input);
+    }
+
     //Creating structure host object
     rocblas_check_numerics_t h_abnormal;
 
@@ -112,11 +221,6 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                   sizeof(rocblas_check_numerics_t),
                                   hipMemcpyHostToDevice));
 
-    hipStream_t           rocblas_stream = handle->get_stream();
-    constexpr rocblas_int NB             = 256;
-    dim3                  blocks((n - 1) / NB + 1, batch_count);
-    dim3                  threads(NB);
-
     hipLaunchKernelGGL(rocblas_check_numerics_vector_kernel,
                        blocks,
                        threads,
@@ -2,7 +2,9 @@
  * Copyright 2016-2021 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #include "handle.hpp"
+#include <algorithm>
 #include <cstdarg>
+#include <cstring>
 #include <limits>
 #ifdef WIN32
 #include <windows.h>
@@ -16,6 +18,33 @@
 // see TensileHost.cpp for normal rocblas_initialize definition
 // it isn't compiled if not BUILD_WITH_TENSILE so defining here
 extern "C" void rocblas_initialize() {}
+
+// Without Tensile, there is no solution cache
+extern "C" rocblas_status
+    rocblas_get_solution_cache_stats(rocblas_handle handle, size_t* hits, size_t* misses)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!hits || !misses)
+        return rocblas_status_invalid_pointer;
+    *hits = *misses = 0;
+    return rocblas_status_success;
+}
+
+// Without Tensile, there are no code objects to load
+extern "C" rocblas_status rocblas_get_tensile_load_stats(rocblas_handle handle,
+                                                         double*        startup_ms,
+                                                         size_t*        loaded_code_objects,
+                                                         size_t*        total_code_objects)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!startup_ms || !loaded_code_objects || !total_code_objects)
+        return rocblas_status_invalid_pointer;
+    *startup_ms          = 0;
+    *loaded_code_objects = *total_code_objects = 0;
+    return rocblas_status_success;
+}
 #endif
 
 // forcing early cleanup
@@ -80,7 +109,8 @@ _rocblas_handle::_rocblas_handle()
 #endif
 
     // Device memory size
-    const char* env = read_env("ROCBLAS_DEVICE_MEMORY_SIZE");
+    size_t      device_memory_size = 0;
+    const char* env                = read_env("ROCBLAS_DEVICE_MEMORY_SIZE");
     if(env)
         device_memory_size = strtoul(env, nullptr, 0);
 
@@ -106,9 +136,13 @@ _rocblas_handle::_rocblas_handle()
         }
     }
 
-    // Allocate device memory
+    // Allocate device memory as the first arena
     if(device_memory_size)
+    {
+        void* device_memory;
         THROW_IF_HIP_ERROR((hipMalloc)(&device_memory, device_memory_size));
+        device_arenas.add_arena(device_memory, device_memory_size, true);
+    }
 
     // Initialize logging
     init_logging();
@@ -122,7 +156,13 @@ _rocblas_handle::_rocblas_handle()
  ******************************************************************************/
 _rocblas_handle::~_rocblas_handle()
 {
-    if(device_memory_in_use)
+    // Launch any deferred gemms before the handle's resources are released
+    gemm_batcher.launch(this);
+
+    // Results in flight may be copied from the handle's device memory
+    host_results.synchronize();
+
+    if(device_arenas.in_use())
     {
         rocblas_cerr
             << "rocBLAS internal error: Handle object destroyed while device memory still in use."
@@ -131,51 +171,12 @@ _rocblas_handle::~_rocblas_handle()
     }
 
     // Free device memory unless it's user-owned
-    if(device_memory_owner != rocblas_device_memory_ownership::user_owned)
+    if(!device_arenas.release())
     {
-        auto hipStatus = (hipFree)(device_memory);
-        if(hipStatus != hipSuccess)
-        {
-            rocblas_cerr << "rocBLAS error during hipFree in handle destructor: "
-                         << rocblas_status_to_string(get_rocblas_status_for_hip_status(hipStatus))
-                         << std::endl;
-            rocblas_abort();
-        };
-    }
-}
-
-/*******************************************************************************
- * helper for allocating device memory
- ******************************************************************************/
-#if ROCBLAS_REALLOC_ON_DEMAND
-bool _rocblas_handle::device_allocator(size_t size)
-{
-    bool success = size <= device_memory_size - device_memory_in_use;
-    if(!success && device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
-    {
-        if(device_memory_in_use)
-        {
-            rocblas_cerr << "rocBLAS internal error: Cannot reallocate device memory while it is "
-                            "already in use.";
-            rocblas_abort();
-        }
-
-        // Temporarily change the thread's default device ID to the handle's device ID
-        auto saved_device_id = push_device_id();
-
-        device_memory_size = 0;
-        if(!device_memory || (hipFree)(device_memory) == hipSuccess)
-        {
-            success = (hipMalloc)(&device_memory, size) == hipSuccess;
-            if(success)
-                device_memory_size = size;
-            else
-                device_memory = nullptr;
-        }
+        rocblas_cerr << "rocBLAS error during hipFree in handle destructor" << std::endl;
+        rocblas_abort();
     }
-    return success;
 }
-#endif
 
 /*******************************************************************************
  * start device memory size queries
@@ -227,7 +228,27 @@ try
         return rocblas_status_invalid_handle;
     if(!size)
         return rocblas_status_invalid_pointer;
-    *size = handle->device_memory_size;
+    *size = handle->device_arenas.capacity();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Get the device memory statistics
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_device_memory_stats(rocblas_handle handle, size_t* allocated, size_t* high_water)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!allocated || !high_water)
+        return rocblas_status_invalid_pointer;
+    *allocated  = handle->device_arenas.capacity();
+    *high_water = handle->device_arenas.high_water();
     return rocblas_status_success;
 }
 catch(...)
@@ -235,6 +256,26 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * Release rocBLAS-managed device memory which is not in use
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_trim_device_memory(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // Memory set by the user is left alone
+    if(handle->device_memory_owner != rocblas_device_memory_ownership::rocblas_managed)
+        return rocblas_status_success;
+
+    return handle->device_arenas.trim() ? rocblas_status_success : rocblas_status_memory_error;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * Free any allocated memory unless owned by user, and reset the handle to being
  * rocBLAS-managed
@@ -244,19 +285,16 @@ static rocblas_status free_existing_device_memory(rocblas_handle handle)
     // Cannot change memory allocation when a device_malloc object is alive and
     // using device memory. This should never happen unless this function is
     // called from inside library code which borrows allocated device memory.
-    if(handle->device_memory_in_use)
+    if(handle->device_arenas.in_use())
         return rocblas_status_internal_error;
 
     // Free existing device memory in handle, unless owned by user
-    if(handle->device_memory_owner != rocblas_device_memory_ownership::user_owned)
-        RETURN_IF_HIP_ERROR((hipFree)(handle->device_memory));
+    bool success = handle->device_arenas.release();
 
-    // Clear the memory size and address, and set the memory to be rocBLAS-managed
-    handle->device_memory_size  = 0;
-    handle->device_memory       = nullptr;
+    // Set the memory to be rocBLAS-managed
     handle->device_memory_owner = rocblas_device_memory_ownership::rocblas_managed;
 
-    return rocblas_status_success;
+    return success ? rocblas_status_success : rocblas_status_memory_error;
 }
 
 /*******************************************************************************
@@ -282,20 +320,21 @@ try
         return rocblas_status_success;
 
     // Allocate size rounded up to MIN_CHUNK_SIZE
+    void* device_memory;
     size           = roundup_device_memory_size(size);
-    auto hipStatus = (hipMalloc)(&handle->device_memory, size);
+    auto hipStatus = (hipMalloc)(&device_memory, size);
 
     if(hipStatus != hipSuccess)
     {
-        // If allocation fails, nullify device memory address and return error
+        // If allocation fails, return error
         // Leave the memory under rocBLAS management for future calls
-        handle->device_memory = nullptr;
         return get_rocblas_status_for_hip_status(hipStatus);
     }
     else
     {
-        // If allocation succeeds, set size, mark it under user-management, and return success
-        handle->device_memory_size  = size;
+        // If allocation succeeds, add it as the only arena, mark it under user-management,
+        // and return success
+        handle->device_arenas.add_arena(device_memory, size, true);
         handle->device_memory_owner = rocblas_device_memory_ownership::user_managed;
         return rocblas_status_success;
     }
@@ -328,8 +367,7 @@ try
     if(size && addr)
     {
         handle->device_memory_owner = rocblas_device_memory_ownership::user_owned;
-        handle->device_memory_size  = size;
-        handle->device_memory       = addr;
+        handle->device_arenas.add_arena(addr, size, false);
     }
 
     return rocblas_status_success;
@@ -585,10 +623,588 @@ void _rocblas_handle::init_logging()
         if(layer_mode & rocblas_layer_mode_log_bench)
             log_bench_os = open_log_stream("ROCBLAS_LOG_BENCH_PATH");
 
-        // open log_profile file
+        // open log_profile file, and time the profiled calls if ROCBLAS_LOG_PROFILE_TIMING is set
         if(layer_mode & rocblas_layer_mode_log_profile)
+        {
             log_profile_os = open_log_stream("ROCBLAS_LOG_PROFILE_PATH");
+
+            const char* timing = read_env("ROCBLAS_LOG_PROFILE_TIMING");
+            log_profile_timing = timing && strcmp(timing, "0");
+        }
+    }
+}
+
+/*******************************************************************************
+ * rocblas_profile_timer functions
+ ******************************************************************************/
+rocblas_profile_timer::~rocblas_profile_timer()
+{
+    // Pass the times of the pending calls to their sinks before releasing the events
+    stop();
+    harvest(true);
+
+    for(auto& r : records)
+    {
+        hipEventDestroy(r.start);
+        if(r.stop)
+            hipEventDestroy(r.stop);
+    }
+    for(auto event : free_events)
+        hipEventDestroy(event);
+}
+
+rocblas_status rocblas_profile_timer::record(hipEvent_t& event, hipStream_t stream)
+{
+    if(free_events.empty())
+        RETURN_IF_HIP_ERROR(hipEventCreate(&event));
+    else
+    {
+        event = free_events.back();
+        free_events.pop_back();
+    }
+
+    hipError_t status = hipEventRecord(event, stream);
+    if(status != hipSuccess)
+    {
+        free_events.push_back(event);
+        return get_rocblas_status_for_hip_status(status);
+    }
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_profile_timer::start(hipStream_t stream, sink_t sink, void* entry)
+{
+    // A call made by another rocBLAS call is part of that call's time
+    if(depth > 1)
+        return rocblas_status_success;
+
+    // A call profiled outside of a scope ends when the next call starts
+    RETURN_IF_ROCBLAS_ERROR(stop());
+    RETURN_IF_ROCBLAS_ERROR(harvest(false));
+
+    // Wait on the oldest call when too many calls are pending
+    if(records.size() >= MAX_PENDING)
+    {
+        RETURN_IF_HIP_ERROR(hipEventSynchronize(records.front().stop));
+        RETURN_IF_ROCBLAS_ERROR(harvest(false));
+    }
+
+    hipEvent_t event;
+    RETURN_IF_ROCBLAS_ERROR(record(event, stream));
+    records.push_back({event, nullptr, sink, entry});
+    this->stream = stream;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_profile_timer::stop()
+{
+    if(records.empty() || records.back().stop)
+        return rocblas_status_success;
+
+    hipEvent_t     event;
+    rocblas_status status = record(event, stream);
+    if(status == rocblas_status_success)
+        records.back().stop = event;
+    else
+    {
+        // A call whose end cannot be recorded is not timed
+        free_events.push_back(records.back().start);
+        records.pop_back();
+    }
+    return status;
+}
+
+rocblas_status rocblas_profile_timer::harvest(bool wait)
+{
+    while(!records.empty() && records.front().stop)
+    {
+        auto& r = records.front();
+        if(wait)
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(r.stop));
+        else if(hipEventQuery(r.stop) != hipSuccess)
+            break;
+
+        float ms;
+        RETURN_IF_HIP_ERROR(hipEventElapsedTime(&ms, r.start, r.stop));
+        r.sink(r.entry, ms);
+        free_events.push_back(r.start);
+        free_events.push_back(r.stop);
+        records.pop_front();
+    }
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * rocblas_gemm_batcher functions
+ ******************************************************************************/
+rocblas_gemm_batcher::~rocblas_gemm_batcher()
+{
+    // The handle launches the queued gemms before it is destroyed
+    for(auto& slot : slots)
+    {
+        if(slot.event)
+        {
+            hipEventSynchronize(slot.event);
+            hipEventDestroy(slot.event);
+        }
+        if(slot.h_ptrs)
+            hipHostFree(slot.h_ptrs);
+        if(slot.d_ptrs)
+            (hipFree)(slot.d_ptrs);
+    }
+}
+
+rocblas_status rocblas_gemm_batcher::enqueue(rocblas_handle handle,
+                                             const key_t&   key,
+                                             const void*    a,
+                                             size_t         a_bytes,
+                                             const void*    b,
+                                             size_t         b_bytes,
+                                             void*          c,
+                                             size_t         c_bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    extent_t ea{static_cast<const char*>(a), static_cast<const char*>(a) + a_bytes};
+    extent_t eb{static_cast<const char*>(b), static_cast<const char*>(b) + b_bytes};
+    extent_t ec{static_cast<const char*>(c), static_cast<const char*>(c) + c_bytes};
+
+    auto overlaps = [](const std::vector<extent_t>& extents, const extent_t& x) {
+        if(x.begin != x.end)
+            for(auto& e : extents)
+                if(x.begin < e.end && e.begin < x.end)
+                    return true;
+        return false;
+    };
+
+    // A gemm which depends on a queued one, or a full queue, launches the queue first
+    if(pending == MAX_PENDING || overlaps(writes, ea) || overlaps(writes, eb)
+       || overlaps(writes, ec) || overlaps(reads, ec))
+        keep_status(launch_pending(handle));
+
+    auto it = std::find_if(
+        buckets.begin(), buckets.end(), [&](const bucket_t& x) { return x.key == key; });
+    if(it == buckets.end())
+        it = buckets.insert(buckets.end(), bucket_t{key, {}, {}, {}});
+    it->a.push_back(a);
+    it->b.push_back(b);
+    it->c.push_back(c);
+
+    if(a_bytes)
+        reads.push_back(ea);
+    if(b_bytes)
+        reads.push_back(eb);
+    if(c_bytes)
+        writes.push_back(ec);
+    ++pending;
+
+    return take_status();
+}
+
+rocblas_status rocblas_gemm_batcher::launch_pending(rocblas_handle handle)
+{
+    if(buckets.empty())
+        return rocblas_status_success;
+
+    // The queue is emptied first, so that it is empty even if a launch fails
+    auto launching = std::move(buckets);
+    buckets.clear();
+    reads.clear();
+    writes.clear();
+    pending = 0;
+
+    hipStream_t stream = handle->get_stream();
+
+    // The pointers of the buckets with more than one gemm are copied to the device together
+    size_t batched = 0;
+    for(auto& bucket : launching)
+        if(bucket.c.size() > 1)
+            batched += bucket.c.size();
+
+    slot_t* slot = nullptr;
+    if(batched)
+    {
+        slot = &slots[next_slot++ % N_SLOTS];
+        if(!slot->event)
+        {
+            RETURN_IF_HIP_ERROR(hipHostMalloc(
+                &slot->h_ptrs, 3 * MAX_PENDING * sizeof(void*), hipHostMallocDefault));
+            RETURN_IF_HIP_ERROR((hipMalloc)(&slot->d_ptrs, 3 * MAX_PENDING * sizeof(void*)));
+            RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&slot->event, hipEventDisableTiming));
+        }
+        else
+        {
+            // The launches which last used the slot must have read its pointers
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(slot->event));
+        }
+
+        auto h_ptrs = (const void**)slot->h_ptrs;
+        for(auto& bucket : launching)
+        {
+            if(bucket.c.size() > 1)
+            {
+                h_ptrs = std::copy(bucket.a.begin(), bucket.a.end(), h_ptrs);
+                h_ptrs = std::copy(bucket.b.begin(), bucket.b.end(), h_ptrs);
+                h_ptrs = std::copy(bucket.c.begin(), bucket.c.end(), h_ptrs);
+            }
+        }
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(slot->d_ptrs,
+                                           slot->h_ptrs,
+                                           3 * batched * sizeof(void*),
+                                           hipMemcpyHostToDevice,
+                                           stream));
+    }
+
+    // Launch every bucket, returning the first error
+    rocblas_status first_error = rocblas_status_success;
+    void**         d_ptrs      = slot ? slot->d_ptrs : nullptr;
+    for(auto& bucket : launching)
+    {
+        auto&          key   = bucket.key;
+        rocblas_int    count = rocblas_int(bucket.c.size());
+        rocblas_status launched;
+        if(count == 1)
+        {
+            launched = key.launch(handle, key, &bucket.a[0], &bucket.b[0], &bucket.c[0], 1);
+        }
+        else
+        {
+            launched = key.launch(handle, key, d_ptrs, d_ptrs + count, d_ptrs + 2 * count, count);
+            d_ptrs += 3 * count;
+        }
+        if(first_error == rocblas_status_success)
+            first_error = launched;
     }
+
+    if(slot)
+        RETURN_IF_HIP_ERROR(hipEventRecord(slot->event, stream));
+    return first_error;
+}
+
+void rocblas_gemm_batcher::launch(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    keep_status(launch_pending(handle));
+}
+
+rocblas_status rocblas_gemm_batcher::flush(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    keep_status(launch_pending(handle));
+    return take_status();
+}
+
+/*******************************************************************************
+ * rocblas_host_result_mailbox functions
+ ******************************************************************************/
+rocblas_host_result_mailbox::~rocblas_host_result_mailbox()
+{
+    // Callbacks in flight write to the mailboxes and return them to the free list
+    synchronize();
+
+    for(auto mailbox : free_mailboxes)
+    {
+        hipHostFree(mailbox->buffer);
+        delete mailbox;
+    }
+    if(event)
+        hipEventDestroy(event);
+}
+
+void rocblas_host_result_mailbox::write_result(hipStream_t, hipError_t error, void* data)
+{
+    auto mailbox = static_cast<mailbox_t*>(data);
+    auto owner   = mailbox->owner;
+    if(error == hipSuccess)
+        memcpy(mailbox->dst, mailbox->buffer, mailbox->bytes);
+
+    std::lock_guard<std::mutex> lock(owner->mutex);
+    if(error != hipSuccess && owner->status == rocblas_status_success)
+        owner->status = get_rocblas_status_for_hip_status(error);
+    owner->free_mailboxes.push_back(mailbox);
+    --owner->in_flight;
+    owner->written.notify_all();
+}
+
+rocblas_status
+    rocblas_host_result_mailbox::post(hipStream_t stream, void* dst, const void* src, size_t bytes)
+{
+    if(!event)
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    // Wait on the results in flight when there are too many
+    bool full;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        full = in_flight >= MAX_PENDING;
+    }
+    if(full)
+        RETURN_IF_ROCBLAS_ERROR(synchronize());
+
+    // Results posted on another stream are written first, so that the event covers them
+    if(this->stream && stream != this->stream)
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, event, 0));
+
+    // Take the smallest free mailbox which can hold the result
+    mailbox_t* mailbox = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto best = free_mailboxes.end();
+        for(auto it = free_mailboxes.begin(); it != free_mailboxes.end(); ++it)
+            if((*it)->capacity >= bytes
+               && (best == free_mailboxes.end() || (*it)->capacity < (*best)->capacity))
+                best = it;
+        if(best != free_mailboxes.end())
+        {
+            mailbox = *best;
+            free_mailboxes.erase(best);
+        }
+    }
+
+    if(!mailbox)
+    {
+        size_t capacity = MIN_CAPACITY;
+        while(capacity < bytes)
+            capacity *= 2;
+
+        void* buffer;
+        RETURN_IF_HIP_ERROR(hipHostMalloc(&buffer, capacity, hipHostMallocDefault));
+        mailbox = new mailbox_t{this, buffer, capacity};
+    }
+
+    mailbox->dst   = dst;
+    mailbox->bytes = bytes;
+
+    hipError_t error = hipMemcpyAsync(mailbox->buffer, src, bytes, hipMemcpyDeviceToHost, stream);
+    if(error == hipSuccess)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++in_flight;
+        error = hipStreamAddCallback(stream, write_result, mailbox, 0);
+        if(error != hipSuccess)
+            --in_flight;
+    }
+    if(error != hipSuccess)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        free_mailboxes.push_back(mailbox);
+        return get_rocblas_status_for_hip_status(error);
+    }
+
+    this->stream = stream;
+    RETURN_IF_HIP_ERROR(hipEventRecord(event, stream));
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_host_result_mailbox::get_event(hipEvent_t* event)
+{
+    if(!this->event)
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&this->event, hipEventDisableTiming));
+    *event = this->event;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_host_result_mailbox::synchronize()
+{
+    if(event)
+        RETURN_IF_HIP_ERROR(hipEventSynchronize(event));
+
+    // Wait for the callbacks to finish writing, as well as for the event
+    std::unique_lock<std::mutex> lock(mutex);
+    written.wait(lock, [this] { return in_flight == 0; });
+
+    rocblas_status first = status;
+    status               = rocblas_status_success;
+    return first;
+}
+
+/*******************************************************************************
+ * rocblas_trsm_inverse_cache functions
+ ******************************************************************************/
+rocblas_trsm_inverse_cache::~rocblas_trsm_inverse_cache()
+{
+    release();
+}
+
+void rocblas_trsm_inverse_cache::release()
+{
+    // hipFree waits for the kernels which may still be reading the inverses
+    for(auto& entry : entries)
+        hipFree(entry.invA.ptr);
+    for(auto& buffer : free_buffers)
+    {
+        hipEventDestroy(buffer.event);
+        hipFree(buffer.ptr);
+    }
+    entries.clear();
+    free_buffers.clear();
+}
+
+void rocblas_trsm_inverse_cache::evict(buffer_t buffer)
+{
+    // Without an event to order its reuse, e.g. when its stream has been destroyed since, the
+    // buffer is freed
+    if(hipEventCreateWithFlags(&buffer.event, hipEventDisableTiming) != hipSuccess)
+    {
+        hipFree(buffer.ptr);
+        return;
+    }
+    if(hipEventRecord(buffer.event, buffer.stream) != hipSuccess)
+    {
+        hipEventDestroy(buffer.event);
+        hipFree(buffer.ptr);
+        return;
+    }
+
+    free_buffers.push_back(buffer);
+    if(free_buffers.size() > MAX_FREE_BUFFERS)
+    {
+        hipEventDestroy(free_buffers.front().event);
+        hipFree(free_buffers.front().ptr);
+        free_buffers.erase(free_buffers.begin());
+    }
+}
+
+rocblas_status rocblas_trsm_inverse_cache::acquire(
+    const key_t& key, size_t bytes, hipStream_t stream, void** invA, bool* found)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // A hit becomes the most recently used entry
+    auto hit = std::find_if(entries.begin(), entries.end(), [&](const entry_t& entry) {
+        return entry.key == key;
+    });
+    if(hit != entries.end())
+    {
+        entry_t entry     = *hit;
+        entry.invA.stream = stream;
+        entries.erase(hit);
+        entries.push_back(entry);
+        ++hits;
+        *invA  = entry.invA.ptr;
+        *found = true;
+        return rocblas_status_success;
+    }
+
+    // The least recently used buffer is evicted without waiting for the kernels reading it.
+    // The inverses computed in it later are written after them in stream order, or after its
+    // event on another stream.
+    if(entries.size() >= MAX_ENTRIES)
+    {
+        evict(entries.front().invA);
+        entries.erase(entries.begin());
+    }
+
+    // The smallest evicted buffer which is large enough is reused
+    auto fit = free_buffers.end();
+    for(auto it = free_buffers.begin(); it != free_buffers.end(); ++it)
+        if(it->bytes >= bytes && (fit == free_buffers.end() || it->bytes < fit->bytes))
+            fit = it;
+
+    buffer_t buffer;
+    if(fit != free_buffers.end())
+    {
+        buffer = *fit;
+        free_buffers.erase(fit);
+        hipError_t status
+            = buffer.stream == stream ? hipSuccess : hipStreamWaitEvent(stream, buffer.event, 0);
+        hipEventDestroy(buffer.event);
+        if(status != hipSuccess)
+        {
+            hipFree(buffer.ptr);
+            return get_rocblas_status_for_hip_status(status);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR((hipMalloc)(&buffer.ptr, bytes));
+        buffer.bytes = bytes;
+    }
+    buffer.stream = stream;
+    buffer.event  = nullptr;
+
+    entries.push_back({key, buffer});
+    ++misses;
+    *invA  = buffer.ptr;
+    *found = false;
+    return rocblas_status_success;
+}
+
+void rocblas_trsm_inverse_cache::discard(const key_t& key)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = std::find_if(entries.begin(), entries.end(), [&](const entry_t& entry) {
+        return entry.key == key;
+    });
+    if(it != entries.end())
+    {
+        evict(it->invA);
+        entries.erase(it);
+    }
+}
+
+void rocblas_trsm_inverse_cache::set_generation(uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(generation != this->generation)
+    {
+        release();
+        this->generation = generation;
+    }
+}
+
+void rocblas_trsm_inverse_cache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    release();
+}
+
+void rocblas_trsm_inverse_cache::get_stats(size_t* hits, size_t* misses)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    *hits   = this->hits;
+    *misses = this->misses;
+}
+
+/*******************************************************************************
+ * Captured call sequences (rocblas_begin_capture and rocblas_graph_launch)
+ ******************************************************************************/
+rocblas_status
+    _rocblas_graph::capture(rocblas_handle handle, size_t workspace_bytes, launch_t launch)
+{
+    node_t         node{std::move(launch), handle->pointer_mode, nullptr};
+    rocblas_status status;
+    {
+        auto paused         = handle->pause_capture();
+        auto saved_solution = handle->push_graph_solution(nullptr, true);
+        status              = node.launch(handle, remapper(), nullptr, false);
+        node.solution       = handle->get_captured_graph_solution();
+    }
+
+    // Calls which fail, and device memory size queries, are not recorded
+    if(status == rocblas_status_success && !handle->is_device_memory_size_query())
+    {
+        nodes.push_back(std::move(node));
+        this->workspace_bytes = std::max(this->workspace_bytes, workspace_bytes);
+    }
+    return status;
+}
+
+rocblas_status _rocblas_graph::launch(rocblas_handle handle, const remapper& remap)
+{
+    // One workspace is shared by the nodes, which run in order on the stream
+    auto w_mem    = handle->device_malloc(workspace_bytes);
+    bool resolved = handle->getDevice() == device && !handle->check_numerics && w_mem;
+
+    for(auto& node : nodes)
+    {
+        auto solution           = resolved ? node.solution : nullptr;
+        auto saved_pointer_mode = handle->push_pointer_mode(node.pointer_mode);
+        auto saved_solution     = handle->push_graph_solution(solution, false);
+        RETURN_IF_ROCBLAS_ERROR(node.launch(handle, remap, static_cast<void*>(w_mem), resolved));
+    }
+    return rocblas_status_success;
 }
 
 /*******************************************************************************
@@ -604,6 +1220,49 @@ extern "C" rocblas_status rocblas_set_solution_fitness_query(rocblas_handle hand
     return rocblas_status_success;
 }
 
+/*******************************************************************************
+ * Force the Tensile solution used by gemm-like calls
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_solution_index(rocblas_handle handle, int32_t index)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(index < -1)
+        return rocblas_status_invalid_value;
+    handle->solution_index = index;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_get_solution_index(rocblas_handle handle, int32_t* index)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!index)
+        return rocblas_status_invalid_pointer;
+    *index = handle->solution_index;
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * Query the Tensile solutions which can compute gemm-like calls, for tuning
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_solution_candidates_query(rocblas_handle handle,
+                                                                int32_t*       indices,
+                                                                rocblas_int    capacity,
+                                                                rocblas_int*   count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(capacity < 0)
+        return rocblas_status_invalid_size;
+    if(count && capacity && !indices)
+        return rocblas_status_invalid_pointer;
+    handle->solution_candidates_query = {indices, capacity, count};
+    if(count)
+        *count = 0;
+    return rocblas_status_success;
+}
+
 /*******************************************************************************
  * Choose performance metric used to select solution
  ******************************************************************************/
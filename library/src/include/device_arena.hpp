@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_device_arena_stack manages a handle's device memory as a stack of
+ * arenas. Allocations are carved in LIFO order from the lowest arena at or
+ * above the current one which has room. When no arena has room, a new arena is
+ * added instead of reallocating, so existing allocations stay valid and no
+ * synchronizing free is needed on the allocation path. Arenas which are not in
+ * use are only released by trim() and release().
+ *
+ * The Backend performs the raw allocations, so the stack can be tested on the
+ * host with a mock backend. It must provide:
+ *
+ *   bool allocate(void** ptr, size_t size);
+ *   bool deallocate(void* ptr);
+ ******************************************************************************/
+template <typename Backend>
+class rocblas_device_arena_stack
+{
+    struct arena_t
+    {
+        void*  base;
+        size_t size;
+        size_t used;
+        bool   owned; // Whether the memory was allocated by the backend
+    };
+
+    Backend              backend;
+    std::vector<arena_t> arenas;
+    size_t               top        = 0; // Arena holding the most recent live allocation
+    size_t               bytes_used = 0; // Total bytes in use across all arenas
+    size_t               peak_used  = 0; // High-water mark of bytes_used
+
+    // Add an arena allocated by the backend, returning whether it succeeded
+    bool grow(size_t size)
+    {
+        void* base = nullptr;
+        if(!backend.allocate(&base, size))
+            return false;
+        arenas.push_back({base, size, 0, true});
+        return true;
+    }
+
+public:
+    // State saved by an allocation, used to check and restore LIFO order when it is freed
+    struct mark_t
+    {
+        size_t arena; // Arena the allocation was carved from
+        size_t offset; // Offset of the allocation in its arena
+        size_t prev_top; // Value of top before the allocation
+    };
+
+    explicit rocblas_device_arena_stack(Backend backend = Backend())
+        : backend(std::move(backend))
+    {
+    }
+
+    rocblas_device_arena_stack(const rocblas_device_arena_stack&) = delete;
+    rocblas_device_arena_stack& operator=(const rocblas_device_arena_stack&) = delete;
+
+    // Add an arena with existing memory; owned arenas are freed by the backend on release
+    void add_arena(void* base, size_t size, bool owned)
+    {
+        arenas.push_back({base, size, 0, owned});
+    }
+
+    // Allocate size bytes, adding an arena if none has room and grow_ok is true.
+    // A size of 0 succeeds with a nullptr and does not need to be deallocated.
+    bool allocate(size_t size, bool grow_ok, void** ptr, mark_t* mark)
+    {
+        *ptr = nullptr;
+        if(!size)
+            return true;
+
+        // Arenas above top are empty, and earlier arenas cannot be used without breaking LIFO order
+        size_t i = top;
+        while(i < arenas.size() && arenas[i].size - arenas[i].used < size)
+            ++i;
+
+        if(i == arenas.size())
+        {
+            if(!grow_ok)
+                return false;
+
+            // Grow geometrically, so that a workload reaches a steady state in few arenas
+            size_t new_size = std::max(size, capacity());
+            if(!grow(new_size))
+            {
+                // On failure, release the unused arenas and retry with only what is needed
+                trim();
+                if(!grow(size))
+                    return false;
+            }
+            i = arenas.size() - 1;
+        }
+
+        *mark = {i, arenas[i].used, top};
+        *ptr  = static_cast<char*>(arenas[i].base) + arenas[i].used;
+        arenas[i].used += size;
+        top = i;
+        bytes_used += size;
+        peak_used = std::max(peak_used, bytes_used);
+        return true;
+    }
+
+    // Free an allocation of size bytes, returning false if it was not the most recent one
+    bool deallocate(size_t size, const mark_t& mark)
+    {
+        if(mark.arena != top || arenas[top].used != mark.offset + size)
+            return false;
+        arenas[top].used = mark.offset;
+        top              = mark.prev_top;
+        bytes_used -= size;
+        return true;
+    }
+
+    // Largest allocation which can be made without adding an arena
+    size_t available() const
+    {
+        size_t avail = 0;
+        for(size_t i = top; i < arenas.size(); ++i)
+            avail = std::max(avail, arenas[i].size - arenas[i].used);
+        return avail;
+    }
+
+    // Release the arenas which are not in use, returning false if a backend free failed
+    bool trim()
+    {
+        bool   success = true;
+        size_t keep    = bytes_used ? top + 1 : 0;
+        while(arenas.size() > keep)
+        {
+            // Arenas which are not owned are kept, since they cannot be reallocated
+            if(!arenas.back().owned)
+                break;
+            success = backend.deallocate(arenas.back().base) && success;
+            arenas.pop_back();
+        }
+        if(arenas.size() <= top)
+            top = 0;
+        return success;
+    }
+
+    // Release all arenas. Nothing may be in use.
+    bool release()
+    {
+        bool success = true;
+        for(auto& arena : arenas)
+            if(arena.owned)
+                success = backend.deallocate(arena.base) && success;
+        arenas.clear();
+        top        = 0;
+        bytes_used = 0;
+        return success;
+    }
+
+    // Total bytes of all arenas
+    size_t capacity() const
+    {
+        size_t total = 0;
+        for(auto& arena : arenas)
+            total += arena.size;
+        return total;
+    }
+
+    // Bytes currently in use
+    size_t in_use() const
+    {
+        return bytes_used;
+    }
+
+    // Highest number of bytes in use at once
+    size_t high_water() const
+    {
+        return peak_used;
+    }
+
+    // Number of arenas
+    size_t num_arenas() const
+    {
+        return arenas.size();
+    }
+};
@@ -4,16 +4,23 @@
 
 #pragma once
 
+#include "device_arena.hpp"
 #include "macros.hpp"
 #include "rocblas.h"
+#include "rocblas_graph.hpp"
 #include "rocblas_ostream.hpp"
 #include "utility.hpp"
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <hip/hip_runtime.h>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 #ifdef WIN32
 #include <stdio.h>
 #define STDOUT_FILENO _fileno(stdout)
@@ -55,6 +62,406 @@ enum class rocblas_device_memory_ownership
 // helper function in handle.cpp
 static rocblas_status free_existing_device_memory(rocblas_handle);
 
+/*******************************************************************************
+ * Deferred numerical checking (rocblas_check_numerics_mode_deferred)
+ * The abnormal-flag records live in a persistent device buffer which is reset
+ * and copied back to pinned host memory in stream order. Records are reported
+ * once their copies have completed, instead of synchronizing on every check.
+ ******************************************************************************/
+class rocblas_check_numerics_deferred
+{
+    // Number of checks which can be pending before they must be waited on
+    static constexpr size_t MAX_PENDING = 256;
+
+    // A check whose record has not been reported yet
+    struct pending_t
+    {
+        const char* function_name;
+        int         check_numerics;
+        bool        is_input;
+    };
+
+    rocblas_check_numerics_t* d_records = nullptr; // Device records
+    rocblas_check_numerics_t* h_records = nullptr; // Pinned host copies of the records
+    hipEvent_t                event     = nullptr; // Recorded after the latest copy
+    hipStream_t               stream    = nullptr; // Stream of the pending checks
+    std::vector<pending_t>    pending; // Pending checks, in the order of their records
+    bool                      failed = false; // A reported fail-mode check found a NaN/Inf
+
+public:
+    rocblas_check_numerics_deferred() = default;
+    ~rocblas_check_numerics_deferred();
+
+    rocblas_check_numerics_deferred(const rocblas_check_numerics_deferred&) = delete;
+    rocblas_check_numerics_deferred& operator=(const rocblas_check_numerics_deferred&) = delete;
+
+    // Reset a device record in stream order, returning it in *record
+    rocblas_status begin(hipStream_t stream, rocblas_check_numerics_t** record);
+
+    // Copy the record returned by begin() back to the host, and return any reported failure
+    rocblas_status end(const char* function_name, int check_numerics, bool is_input);
+
+    // Report the pending checks; if wait is false, only if their records have been copied
+    rocblas_status harvest(bool wait);
+
+    // Return and clear the failure status of the reported checks
+    rocblas_status take_status()
+    {
+        bool fail = failed;
+        failed    = false;
+        return fail ? rocblas_status_check_numerics_fail : rocblas_status_success;
+    }
+};
+
+/*******************************************************************************
+ * Profile timing (ROCBLAS_LOG_PROFILE_TIMING)
+ * A profiled call is timed with a pair of events on the handle's stream: the
+ * start is recorded by log_profile, before the call launches its work, and the
+ * end when the call returns, by the rocblas_profile_scope of its entry point.
+ * The elapsed times are passed to the calls' sinks once the events have
+ * completed, instead of synchronizing on every call.
+ ******************************************************************************/
+class rocblas_profile_timer
+{
+public:
+    // Receives the elapsed time in milliseconds of a call profiled in entry
+    using sink_t = void (*)(void* entry, float ms);
+
+private:
+    // Number of calls which can be pending before the oldest must be waited on
+    static constexpr size_t MAX_PENDING = 256;
+
+    // The events bounding a call, and where its time goes; stop is null until it ends
+    struct record_t
+    {
+        hipEvent_t start;
+        hipEvent_t stop;
+        sink_t     sink;
+        void*      entry;
+    };
+
+    std::deque<record_t>    records; // Calls in the order of their events
+    std::vector<hipEvent_t> free_events; // Events which can be recorded again
+    hipStream_t             stream = nullptr; // Stream of the latest call
+    int                     depth  = 0; // Number of nested rocblas_profile_scope objects
+
+    rocblas_status record(hipEvent_t& event, hipStream_t stream);
+
+    friend class rocblas_profile_scope;
+
+public:
+    rocblas_profile_timer() = default;
+    ~rocblas_profile_timer();
+
+    rocblas_profile_timer(const rocblas_profile_timer&) = delete;
+    rocblas_profile_timer& operator=(const rocblas_profile_timer&) = delete;
+
+    // Start timing a call on stream, unless it is made by another rocBLAS call
+    rocblas_status start(hipStream_t stream, sink_t sink, void* entry);
+
+    // End the latest call, if it has not ended
+    rocblas_status stop();
+
+    // Pass the times of completed calls to their sinks; if wait is true, of all ended calls
+    rocblas_status harvest(bool wait);
+};
+
+    std::deque<record_t>    records; // Records in the order of their events
+    std::vector<hipEvent_t> free_events; // Events which can be recorded again
+    hipStream_t             stream = nullptr; // Stream of the latest record
+
+    rocblas_status record(hipStream_t stream, sink_t sink, void* entry);
+
+public:
+    rocblas_profile_timer() = default;
+    ~rocblas_profile_timer();
+
+    rocblas_profile_timer(const rocblas_profile_timer&) = delete;
+    rocblas_profile_timer& operator=(const rocblas_profile_timer&) = delete;
+
+    // Start timing a call on stream, ending the previous call
+    rocblas_status start(hipStream_t stream, sink_t sink, void* entry);
+
+    // End the latest call, e.g. before the handle's stream changes
+    rocblas_status stop();
+
+    // Pass the times of completed calls to their sinks; if wait is true, of all ended calls
+    rocblas_status harvest(bool wait);
+};
+
+/*******************************************************************************
+ * Deferred gemm batching (rocblas_gemm_batching_deferred)
+ * Small gemm calls are queued in buckets of calls with the same precision,
+ * transposes, sizes, leading dimensions and scalars, and each bucket is
+ * launched as one batched gemm when the queue is flushed. A call which reads
+ * or writes the C matrix of a queued call flushes the queue first, so the
+ * batched launches give the same results as the calls made in order.
+ ******************************************************************************/
+class rocblas_gemm_batcher
+{
+public:
+    struct key_t;
+
+    // Launches count gemms with the arguments of key. If count > 1, a, b and c are
+    // device arrays of pointers; otherwise they are host arrays of one pointer.
+    using launch_t = rocblas_status (*)(rocblas_handle     handle,
+                                        const key_t&       key,
+                                        const void* const* a,
+                                        const void* const* b,
+                                        void* const*       c,
+                                        rocblas_int        count);
+
+    // Arguments shared by the gemms of a bucket
+    struct key_t
+    {
+        launch_t          launch; // Launcher of the precision
+        rocblas_operation trans_a, trans_b;
+        rocblas_int       m, n, k, lda, ldb, ldc;
+        std::array<char, sizeof(rocblas_double_complex)> alpha, beta; // Host scalars, as bytes
+
+        bool operator==(const key_t& other) const
+        {
+            return launch == other.launch && trans_a == other.trans_a && trans_b == other.trans_b
+                   && m == other.m && n == other.n && k == other.k && lda == other.lda
+                   && ldb == other.ldb && ldc == other.ldc && alpha == other.alpha
+                   && beta == other.beta;
+        }
+    };
+
+    // Largest m, n or k of a gemm which is deferred
+    static constexpr rocblas_int MAX_SIZE = 256;
+
+private:
+    // Number of gemms which can be queued before they are launched
+    static constexpr size_t MAX_PENDING = 256;
+
+    // Number of pointer array buffers which can be in use by launched batches
+    static constexpr size_t N_SLOTS = 4;
+
+    struct bucket_t
+    {
+        key_t                    key;
+        std::vector<const void*> a, b;
+        std::vector<void*>       c;
+    };
+
+    // Byte range of a matrix
+    struct extent_t
+    {
+        const char* begin;
+        const char* end;
+    };
+
+    // Pinned and device pointer arrays, and an event recorded after the launches using them
+    struct slot_t
+    {
+        void**     h_ptrs = nullptr;
+        void**     d_ptrs = nullptr;
+        hipEvent_t event  = nullptr;
+    };
+
+    std::mutex                  mutex;
+    std::vector<bucket_t>       buckets; // Buckets in the order of their first gemms
+    std::vector<extent_t>       reads; // A and B of the queued gemms
+    std::vector<extent_t>       writes; // C of the queued gemms
+    std::atomic<size_t>         pending{0}; // Number of queued gemms
+    std::array<slot_t, N_SLOTS> slots;
+    size_t                      next_slot = 0;
+    rocblas_status              status    = rocblas_status_success; // First unreported error
+
+    // Launch the queued gemms; the mutex must be held
+    rocblas_status launch_pending(rocblas_handle handle);
+
+    // Keep the first error, to be returned by a later call
+    void keep_status(rocblas_status launched)
+    {
+        if(status == rocblas_status_success)
+            status = launched;
+    }
+
+    // Return and clear the first unreported error
+    rocblas_status take_status()
+    {
+        rocblas_status first = status;
+        status               = rocblas_status_success;
+        return first;
+    }
+
+public:
+    rocblas_gemm_batcher() = default;
+    ~rocblas_gemm_batcher();
+
+    rocblas_gemm_batcher(const rocblas_gemm_batcher&) = delete;
+    rocblas_gemm_batcher& operator=(const rocblas_gemm_batcher&) = delete;
+
+    // Queue a gemm whose matrices span the given bytes, launching the queue first if the
+    // gemm depends on a queued one. Returns the first error of earlier launches.
+    rocblas_status enqueue(rocblas_handle handle,
+                           const key_t&   key,
+                           const void*    a,
+                           size_t         a_bytes,
+                           const void*    b,
+                           size_t         b_bytes,
+                           void*          c,
+                           size_t         c_bytes);
+
+    // Launch the queued gemms, keeping any error to be returned by a later call
+    void launch(rocblas_handle handle);
+
+    // Launch the queued gemms, returning the first error of this or earlier launches
+    rocblas_status flush(rocblas_handle handle);
+
+    // Whether any gemms are queued
+    bool has_pending() const
+    {
+        return pending.load(std::memory_order_relaxed) != 0;
+    }
+};
+
+/*******************************************************************************
+ * Deferred host results (rocblas_host_result_deferred)
+ * A result which is returned to a host pointer is copied from device memory to
+ * a pinned mailbox in stream order, and a stream callback then copies it from
+ * the mailbox to the host pointer. An event recorded after the callback marks
+ * when the results of the calls made so far have been written, instead of
+ * synchronizing on every call.
+ ******************************************************************************/
+class rocblas_host_result_mailbox
+{
+    // Number of results which can be in flight before they must be waited on
+    static constexpr size_t MAX_PENDING = 256;
+
+    // Smallest capacity of a mailbox, in bytes
+    static constexpr size_t MIN_CAPACITY = 256;
+
+    // A pinned buffer, and the host pointer of the result which it holds
+    struct mailbox_t
+    {
+        rocblas_host_result_mailbox* owner;
+        void*                        buffer;
+        size_t                       capacity;
+        void*                        dst;
+        size_t                       bytes;
+    };
+
+    std::mutex              mutex; // Guards the members below, which callbacks change
+    std::condition_variable written; // Notified when a result has been written
+    std::vector<mailbox_t*> free_mailboxes; // Mailboxes which are not in flight
+    size_t                  in_flight = 0; // Number of results not yet written
+    rocblas_status          status    = rocblas_status_success; // First unreported error
+
+    hipEvent_t  event  = nullptr; // Recorded after the latest callback
+    hipStream_t stream = nullptr; // Stream of the latest callback
+
+    // Stream callback writing the result held by a mailbox to its host pointer
+    static void write_result(hipStream_t stream, hipError_t error, void* mailbox);
+
+public:
+    rocblas_host_result_mailbox() = default;
+    ~rocblas_host_result_mailbox();
+
+    rocblas_host_result_mailbox(const rocblas_host_result_mailbox&) = delete;
+    rocblas_host_result_mailbox& operator=(const rocblas_host_result_mailbox&) = delete;
+
+    // Copy bytes from the device pointer src to the host pointer dst, in stream order
+    rocblas_status post(hipStream_t stream, void* dst, const void* src, size_t bytes);
+
+    // Return the event which completes once the posted results have been written
+    rocblas_status get_event(hipEvent_t* event);
+
+    // Wait until the posted results have been written, and return the first error
+    rocblas_status synchronize();
+};
+
+/*******************************************************************************
+ * Cached trsm inverses (rocblas_trsm_inverse_cache_enabled)
+ * The inverses of the diagonal blocks of A which trsm computes with trtri are
+ * kept in device memory, keyed by the address, order, leading dimension, fill,
+ * diagonal and precision of A. A later trsm with the same A reuses them instead
+ * of computing them again. The caller sets a new generation when the contents
+ * of a cached A change, which frees the inverses of the earlier generation.
+ * The buffers of evicted inverses are kept for later misses instead of being
+ * freed, since hipFree waits for the kernels which may still be reading them.
+ * An event recorded on a buffer's last stream at its eviction orders its reuse
+ * on another stream, e.g. after rocblas_set_stream, after those kernels.
+ ******************************************************************************/
+class rocblas_trsm_inverse_cache
+{
+public:
+    // The triangular matrix whose inverses are cached
+    struct key_t
+    {
+        const void*      A;
+        rocblas_int      k, lda, block;
+        rocblas_fill     uplo;
+        rocblas_diagonal diag;
+        rocblas_datatype type;
+
+        bool operator==(const key_t& other) const
+        {
+            return A == other.A && k == other.k && lda == other.lda && block == other.block
+                   && uplo == other.uplo && diag == other.diag && type == other.type;
+        }
+    };
+
+private:
+    // Number of matrices whose inverses are kept; the least recently used are freed first
+    static constexpr size_t MAX_ENTRIES = 16;
+
+    // Number of evicted buffers which are kept; the oldest are freed first
+    static constexpr size_t MAX_FREE_BUFFERS = 4;
+
+    struct buffer_t
+    {
+        void*       ptr;
+        size_t      bytes;
+        hipStream_t stream; // Stream of the last kernels using the buffer
+        hipEvent_t  event; // Recorded on stream when the buffer is evicted
+    };
+
+    struct entry_t
+    {
+        key_t    key;
+        buffer_t invA;
+    };
+
+    std::mutex            mutex;
+    std::vector<entry_t>  entries; // Least recently used first
+    std::vector<buffer_t> free_buffers; // Evicted buffers, reused in the handle's stream order
+    uint64_t             generation = 0;
+    size_t               hits = 0, misses = 0;
+
+    // Free the inverses of all matrices, and the evicted buffers; the mutex must be held
+    void release();
+
+    // Keep the buffer of evicted inverses for later misses; the mutex must be held
+    void evict(buffer_t buffer);
+
+public:
+    rocblas_trsm_inverse_cache() = default;
+    ~rocblas_trsm_inverse_cache();
+
+    rocblas_trsm_inverse_cache(const rocblas_trsm_inverse_cache&) = delete;
+    rocblas_trsm_inverse_cache& operator=(const rocblas_trsm_inverse_cache&) = delete;
+
+    // Find the inverses of key, or allocate bytes of device memory for them, which the caller
+    // then computes on stream. *found is whether the inverses have already been computed.
+    rocblas_status
+        acquire(const key_t& key, size_t bytes, hipStream_t stream, void** invA, bool* found);
+
+    // Evict the inverses of key, which could not be computed
+    void discard(const key_t& key);
+
+    // Start a new generation of matrices, freeing the inverses of an earlier generation
+    void set_generation(uint64_t generation);
+
+    // Free the inverses of all matrices
+    void clear();
+
+    // Number of calls which reused and which computed inverses
+    void get_stats(size_t* hits, size_t* misses);
+};
+
 /*******************************************************************************
  * \brief rocblas_handle is a structure holding the rocblas library context.
  * It must be initialized using rocblas_create_handle() and the returned handle mus
@@ -193,12 +600,44 @@ public:
     // default atomics mode allows atomic operations
     rocblas_atomics_mode atomics_mode = rocblas_atomics_allowed;
 
+    // default gemm batching mode launches each gemm call immediately
+    rocblas_gemm_batching_mode gemm_batching_mode = rocblas_gemm_batching_none;
+
+    // queued gemm calls of rocblas_gemm_batching_deferred
+    rocblas_gemm_batcher gemm_batcher;
+
+    // default host result mode writes results to host pointers before returning
+    rocblas_host_result_mode host_result_mode = rocblas_host_result_blocking;
+
+    // results in flight of rocblas_host_result_deferred
+    rocblas_host_result_mailbox host_results;
+
+    // Whether results to host pointers are written in stream order
+    bool defer_host_results() const
+    {
+        return pointer_mode == rocblas_pointer_mode_host
+               && host_result_mode == rocblas_host_result_deferred;
+    }
+
+    // default trsm inverse cache mode computes the inverses of A in every trsm call
+    rocblas_trsm_inverse_cache_mode trsm_inverse_cache_mode = rocblas_trsm_inverse_cache_none;
+
+    // inverses of A kept by rocblas_trsm_inverse_cache_enabled
+    rocblas_trsm_inverse_cache trsm_inverses;
+
     // Selects the benchmark library to be used for solution selection
     rocblas_performance_metric performance_metric = rocblas_default_performance_metric;
 
     // default check_numerics_mode is no numeric_check
     rocblas_check_numerics_mode check_numerics = rocblas_check_numerics_mode_no_check;
 
+    // pending checks of rocblas_check_numerics_mode_deferred
+    rocblas_check_numerics_deferred check_numerics_deferred;
+
+    // timing of profile logging, enabled by ROCBLAS_LOG_PROFILE_TIMING
+    bool                  log_profile_timing = false;
+    rocblas_profile_timer profile_timer;
+
     // logging streams
     std::unique_ptr<rocblas_internal_ostream> log_trace_os;
     std::unique_ptr<rocblas_internal_ostream> log_bench_os;
@@ -216,14 +655,26 @@ public:
     friend bool(::rocblas_is_managing_device_memory)(_rocblas_handle*);
     friend bool(::rocblas_is_user_managing_device_memory)(_rocblas_handle*);
     friend rocblas_status(::rocblas_set_stream)(_rocblas_handle*, hipStream_t);
+    friend rocblas_status(::rocblas_get_device_memory_stats)(_rocblas_handle*, size_t*, size_t*);
+    friend rocblas_status(::rocblas_trim_device_memory)(_rocblas_handle*);
 
     // C interfaces that interact with the solution selection process
     friend rocblas_status(::rocblas_set_solution_fitness_query)(_rocblas_handle*, double*);
+    friend rocblas_status(::rocblas_set_solution_index)(_rocblas_handle*, int32_t);
+    friend rocblas_status(::rocblas_get_solution_index)(_rocblas_handle*, int32_t*);
+    friend rocblas_status(::rocblas_set_solution_candidates_query)(_rocblas_handle*,
+                                                                   int32_t*,
+                                                                   rocblas_int,
+                                                                   rocblas_int*);
     friend rocblas_status(::rocblas_set_performance_metric)(_rocblas_handle*,
                                                             rocblas_performance_metric);
     friend rocblas_status(::rocblas_get_performance_metric)(_rocblas_handle*,
                                                             rocblas_performance_metric*);
 
+    // C interfaces for capturing calls in graphs
+    friend rocblas_status(::rocblas_begin_capture)(_rocblas_handle*);
+    friend rocblas_status(::rocblas_end_capture)(_rocblas_handle*, rocblas_graph*);
+
     // Returns whether the current kernel call is a device memory size query
     bool is_device_memory_size_query() const
     {
@@ -236,6 +687,79 @@ public:
         return solution_fitness_query;
     }
 
+    // Solution candidates query, which receives the indices of the Tensile solutions which
+    // can compute a problem, instead of computing it
+    struct solution_candidates_query_t
+    {
+        int32_t*     indices;
+        rocblas_int  capacity;
+        rocblas_int* count;
+    };
+
+    // Get the solution candidates query, or nullptr if there is none
+    auto* get_solution_candidates_query() const
+    {
+        return solution_candidates_query.count ? &solution_candidates_query : nullptr;
+    }
+
+    // Get the Tensile solution index which is forced, or -1 if Tensile selects the solution
+    int32_t get_solution_index() const
+    {
+        return solution_index;
+    }
+
+    // Force the solution index of rocblas_gemm_algo_solution_index, and restore it on exit
+    auto push_solution_index(rocblas_gemm_algo algo, int32_t index)
+    {
+        return _pushed_state<int32_t>(
+            solution_index, algo == rocblas_gemm_algo_solution_index ? index : solution_index);
+    }
+
+    // Get the graph which is capturing the calls made on the handle, or nullptr
+    _rocblas_graph* get_capture() const
+    {
+        return capture_paused ? nullptr : capture.get();
+    }
+
+    // Stop capturing calls, and resume on exit
+    auto pause_capture()
+    {
+        return _pushed_state<bool>(capture_paused, true);
+    }
+
+    // Tensile solution of the graph node which is being captured, in which it is recorded,
+    // or replayed, in which it is used instead of the solution selection if it applies
+    struct graph_solution_t
+    {
+        const void* solution;
+        bool        capturing;
+    };
+
+    // Set the Tensile solution of the graph node, and restore it on exit
+    auto push_graph_solution(const void* solution, bool capturing)
+    {
+        return _pushed_state<graph_solution_t>(graph_solution, {solution, capturing});
+    }
+
+    // Get the Tensile solution of the graph node being replayed, or nullptr
+    const void* get_graph_solution() const
+    {
+        return graph_solution.capturing ? nullptr : graph_solution.solution;
+    }
+
+    // Get the Tensile solution recorded for the graph node being captured
+    const void* get_captured_graph_solution() const
+    {
+        return graph_solution.solution;
+    }
+
+    // Record the Tensile solution of a call if it is being captured
+    void record_graph_solution(const void* solution)
+    {
+        if(graph_solution.capturing)
+            graph_solution.solution = solution;
+    }
+
     // Sets the optimal size(s) of device memory for a kernel call
     // Maximum size is accumulated in device_memory_query_size
     // Returns rocblas_status_size_increased or rocblas_status_size_unchanged
@@ -260,6 +784,28 @@ public:
                                                 : rocblas_status_size_unchanged;
     }
 
+    // Size query of a nested call, such as a Tensile call, which is made while sizes are held
+    // allocated by its caller, so that they are added to the size which the call queries
+    template <typename F,
+              typename... Ss,
+              std::enable_if_t<sizeof...(Ss) && conjunction<std::is_convertible<Ss, size_t>...>{},
+                               int> = 0>
+    rocblas_status set_optimal_device_memory_size_nested(F call, Ss... sizes)
+    {
+        if(!device_memory_size_query)
+            return rocblas_status_size_query_mismatch;
+
+        size_t saved_query_size  = device_memory_query_size;
+        device_memory_query_size = 0;
+        rocblas_status status    = call();
+        size_t nested_size       = device_memory_query_size;
+        device_memory_query_size = saved_query_size;
+
+        if(status != rocblas_status_size_increased && status != rocblas_status_size_unchanged)
+            return status;
+        return set_optimal_device_memory_size(nested_size, sizes...);
+    }
+
     // Temporarily change pointer mode, returning object which restores old mode when destroyed
     auto push_pointer_mode(rocblas_pointer_mode mode)
     {
@@ -281,14 +827,52 @@ public:
         return stream;
     }
 
+    // Launch the gemms queued by rocblas_gemm_batching_deferred, so that the work of the rocBLAS
+    // call which is starting follows them on the stream. It is called on entry to the call,
+    // before any handle state is pushed. Device memory size queries keep the queue.
+    void launch_deferred_gemms()
+    {
+        if(gemm_batcher.has_pending() && !device_memory_size_query)
+            gemm_batcher.launch(this);
+    }
+
+    // Return the largest device memory allocation which can be made without growing
+    size_t get_available_device_memory() const
+    {
+        return device_arenas.available();
+    }
+
 private:
     // device memory work buffer
     static constexpr size_t DEFAULT_DEVICE_MEMORY_SIZE = 32 * 1024 * 1024;
 
+    // Backend of the device memory arenas, allocating on the handle's device
+    class _hip_arena_backend
+    {
+        int device;
+
+    public:
+        explicit _hip_arena_backend(int device)
+            : device(device)
+        {
+        }
+
+        bool allocate(void** ptr, size_t size)
+        {
+            _rocblas_saved_device_id saved_device_id(device);
+            return (hipMalloc)(ptr, size) == hipSuccess;
+        }
+
+        bool deallocate(void* ptr)
+        {
+            _rocblas_saved_device_id saved_device_id(device);
+            return (hipFree)(ptr) == hipSuccess;
+        }
+    };
+
+    using device_arena_stack = rocblas_device_arena_stack<_hip_arena_backend>;
+
     // Variables holding state of device memory allocation
-    void*                           device_memory            = nullptr;
-    size_t                          device_memory_size       = 0;
-    size_t                          device_memory_in_use     = 0;
     bool                            device_memory_size_query = false;
     rocblas_device_memory_ownership device_memory_owner;
     size_t                          device_memory_query_size;
@@ -296,30 +880,54 @@ private:
     // Solution fitness query (used for internal testing)
     double* solution_fitness_query = nullptr;
 
+    // Solution candidates query (used for tuning)
+    solution_candidates_query_t solution_candidates_query{nullptr, 0, nullptr};
+
+    // Tensile solution index forced for gemm-like calls, or -1 for Tensile's selection
+    int32_t solution_index = -1;
+
+    // Graph capturing the calls made on the handle, between rocblas_begin_capture and
+    // rocblas_end_capture, and whether capturing is paused while a captured call runs
+    std::unique_ptr<_rocblas_graph> capture;
+    bool                            capture_paused = false;
+
+    // Tensile solution of the graph node being captured or replayed
+    graph_solution_t graph_solution{nullptr, false};
+
     // rocblas by default take the system default stream 0 users cannot create
     hipStream_t stream = 0;
 
-#if ROCBLAS_REALLOC_ON_DEMAND
-    // Helper for device memory allocator
-    bool device_allocator(size_t size);
-#endif
-
     // Device ID is created at handle creation time and remains in effect for the life of the handle.
     const int device;
 
     // Arch ID is created at handle creation time and remains in effect for the life of the handle.
     const int arch;
 
+    // Stack of device memory arenas from which device_malloc() allocates
+    device_arena_stack device_arenas{_hip_arena_backend(device)};
+
+    // Helper for device memory allocator
+    // rocBLAS-managed memory grows by adding arenas if ROCBLAS_REALLOC_ON_DEMAND is set
+    bool device_allocate(size_t size, void** ptr, device_arena_stack::mark_t* mark)
+    {
+#if ROCBLAS_REALLOC_ON_DEMAND
+        bool grow = device_memory_owner == rocblas_device_memory_ownership::rocblas_managed;
+#else
+        bool grow = false;
+#endif
+        return device_arenas.allocate(size, grow, ptr, mark);
+    }
+
     // Opaque smart allocator class to perform device memory allocations
     // clang-format off
     class [[nodiscard]] _device_malloc : public rocblas_device_malloc_base
     {
     protected:
         // Order is important:
-        rocblas_handle handle;
-        size_t         prev_device_memory_in_use;
-        size_t         size;
-        bool           success;
+        rocblas_handle             handle;
+        size_t                     size;
+        device_arena_stack::mark_t mark;
+        bool                       success;
 
     private:
         std::vector<void*> pointers; // Important: must come last
@@ -335,20 +943,16 @@ private:
             size_t old;
             size_t offsets[] = {(old = size, size += roundup_device_memory_size(sizes), old)...};
 
-#if ROCBLAS_REALLOC_ON_DEMAND
-            success = handle->device_allocator(size);
-#else
-            success = size <= handle->device_memory_size - handle->device_memory_in_use;
-#endif
+            // We allocate the total amount needed, taking it from the handle's device memory arenas.
+            void* base;
+            success = handle->device_allocate(size, &base, &mark);
 
             // If allocation failed, return an array of nullptr's
             // If total size is 0, return an array of nullptr's, but leave it marked as successful
             if(!success || !size)
                 return decltype(pointers)(sizeof...(sizes));
 
-            // We allocate the total amount needed, taking it from the available device memory.
-            char* addr = static_cast<char*>(handle->device_memory) + handle->device_memory_in_use;
-            handle->device_memory_in_use += size;
+            char* addr = static_cast<char*>(base);
 
             // An array of pointers to all of the allocated arrays is formed.
             // If a size is 0, the corresponding pointer is nullptr
@@ -361,8 +965,8 @@ private:
         template <typename... Ss>
         explicit _device_malloc(rocblas_handle handle, Ss... sizes)
             : handle(handle)
-            , prev_device_memory_in_use(handle->device_memory_in_use)
             , size(0)
+            , mark{}
             , success(false)
             , pointers(allocate_pointers(size_t(sizes)...))
         {
@@ -371,22 +975,15 @@ private:
         // Constructor for allocating count pointers of a certain total size
         explicit _device_malloc(rocblas_handle handle, std::nullptr_t, size_t count, size_t total)
             : handle(handle)
-            , prev_device_memory_in_use(handle->device_memory_in_use)
             , size(roundup_device_memory_size(total))
-            , success(
-                    #if ROCBLAS_REALLOC_ON_DEMAND
-                        handle->device_allocator(size)
-                    #else
-                        size <= handle->device_memory_size - handle->device_memory_in_use
-                    #endif
-                     )
-            , pointers(count,
-                       success ? static_cast<char*>(handle->device_memory)
-                                     + handle->device_memory_in_use
-                               : nullptr)
+            , mark{}
+            , success(false)
+            , pointers(count)
         {
+            void* base;
+            success = handle->device_allocate(size, &base, &mark);
             if(success)
-                handle->device_memory_in_use += size;
+                std::fill(pointers.begin(), pointers.end(), base);
         }
 
         // Move constructor
@@ -398,8 +995,8 @@ private:
         // moves to, or the LIFO ordering will be violated and flagged.
         _device_malloc(_device_malloc&& other) noexcept
             : handle(other.handle)
-            , prev_device_memory_in_use(other.prev_device_memory_in_use)
             , size(other.size)
+            , mark(other.mark)
             , success(other.success)
             , pointers(std::move(other.pointers))
         {
@@ -424,9 +1021,9 @@ private:
             // If success == false or size == 0, the destructor is a no-op
             if(success && size)
             {
-                // Subtract size from the handle's device_memory_in_use, making sure
-                // it matches the device_memory_in_use when this object was created.
-                if((handle->device_memory_in_use -= size) != prev_device_memory_in_use)
+                // Return size to the handle's device memory arenas, making sure
+                // this is the most recent allocation which is still alive.
+                if(!handle->device_arenas.deallocate(size, mark))
                 {
                     rocblas_cerr
                         << "rocBLAS internal error: device_malloc() RAII object not "
@@ -475,7 +1072,7 @@ private:
     {
     public:
         explicit _gsu_malloc(rocblas_handle handle)
-            : _device_malloc(handle, handle->device_memory_size - handle->device_memory_in_use)
+            : _device_malloc(handle, handle->device_arenas.available())
         {
             handle->gsu_workspace_size = success ? size : 0;
             handle->gsu_workspace      = static_cast<void*>(*this);
@@ -521,6 +1118,68 @@ public:
     {
         return _gsu_malloc(this);
     };
+
+    // Temporarily reduce the GSU memory passed to Tensile, to use its end for other purposes
+    auto push_gsu_workspace_size(size_t size)
+    {
+        return _pushed_state<size_t>(gsu_workspace_size, size);
+    }
+
+    // Size of the device memory used by reduce_to_host_results() for bytes bytes of results
+    size_t host_results_size(size_t bytes) const
+    {
+        return defer_host_results() ? bytes : 0;
+    }
+
+    // Calls reduce(results) for a reduction which writes bytes bytes of results. When results
+    // to host pointers are written in stream order, reduce is called in device pointer mode
+    // with device memory instead, which is then posted to the host pointer results.
+    template <typename T, typename F>
+    rocblas_status reduce_to_host_results(T* results, size_t bytes, F reduce)
+    {
+        if(!defer_host_results())
+            return reduce(results);
+
+        auto mem = device_malloc(bytes);
+        if(!mem)
+            return rocblas_status_memory_error;
+
+        rocblas_status status;
+        {
+            auto saved_pointer_mode = push_pointer_mode(rocblas_pointer_mode_device);
+            status                  = reduce(static_cast<T*>(mem));
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        return host_results.post(get_stream(), results, static_cast<void*>(mem), bytes);
+    }
+};
+
+// Bounds the time of a profiled rocBLAS call with ROCBLAS_LOG_PROFILE_TIMING: it is
+// declared on entry to the call, and the end of the call is recorded when the outermost
+// scope on the handle is destroyed. Calls made by other rocBLAS calls are not timed
+// separately. handle may be null.
+class rocblas_profile_scope
+{
+    rocblas_profile_timer* timer;
+
+public:
+    explicit rocblas_profile_scope(rocblas_handle handle)
+        : timer(handle && handle->log_profile_timing ? &handle->profile_timer : nullptr)
+    {
+        if(timer)
+            timer->depth++;
+    }
+
+    ~rocblas_profile_scope()
+    {
+        if(timer && !--timer->depth)
+            timer->stop();
+    }
+
+    rocblas_profile_scope(const rocblas_profile_scope&) = delete;
+    rocblas_profile_scope& operator=(const rocblas_profile_scope&) = delete;
 };
 
 // For functions which don't use temporary device memory, and won't be likely
@@ -7,6 +7,8 @@
 #include "handle.hpp"
 #include "rocblas_ostream.hpp"
 #include "tuple_helper.hpp"
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdlib>
 #include <iomanip>
@@ -15,12 +17,86 @@
 #include <map>
 #include <memory>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+/************************************************************************************
+ * Histogram of call latencies in microseconds, with SUB_BUCKETS logarithmic buckets
+ * per power of 2, so that percentiles are accurate to within about 4.5%
+ ************************************************************************************/
+class rocblas_latency_histogram
+{
+    static constexpr int SUB_BUCKETS = 8;
+    static constexpr int NUM_BUCKETS = 1 + 32 * SUB_BUCKETS; // Up to about an hour
+
+    std::array<uint64_t, NUM_BUCKETS> buckets{};
+    uint64_t                          count    = 0;
+    double                            total_us = 0;
+    double                            min_us   = std::numeric_limits<double>::infinity();
+    double                            max_us   = 0;
+
+    // Bucket 0 holds times below 1us, and bucket b > 0 holds [2^((b-1)/S), 2^(b/S)) us
+    static int bucket(double us)
+    {
+        return us >= 1 ? std::min(NUM_BUCKETS - 1, 1 + int(std::log2(us) * SUB_BUCKETS)) : 0;
+    }
+
+    // Geometric midpoint of a bucket
+    static double midpoint(int b)
+    {
+        return b ? std::exp2((b - 0.5) / SUB_BUCKETS) : 0.5;
+    }
+
+public:
+    void add(double us)
+    {
+        buckets[bucket(us)]++;
+        count++;
+        total_us += us;
+        min_us = std::min(min_us, us);
+        max_us = std::max(max_us, us);
+    }
+
+    void merge(const rocblas_latency_histogram& other)
+    {
+        for(int b = 0; b < NUM_BUCKETS; ++b)
+            buckets[b] += other.buckets[b];
+        count += other.count;
+        total_us += other.total_us;
+        min_us = std::min(min_us, other.min_us);
+        max_us = std::max(max_us, other.max_us);
+    }
+
+    uint64_t calls() const
+    {
+        return count;
+    }
+
+    double total() const
+    {
+        return total_us;
+    }
+
+    // The p'th percentile, clamped to the range of the recorded times
+    double percentile(double p) const
+    {
+        if(!count)
+            return 0;
+        uint64_t rank = std::max(uint64_t(1), uint64_t(std::ceil(p / 100 * count)));
+        uint64_t seen = 0;
+        for(int b = 0; b < NUM_BUCKETS; ++b)
+        {
+            seen += buckets[b];
+            if(seen >= rank)
+                return std::min(max_us, std::max(min_us, midpoint(b)));
+        }
+        return max_us;
+    }
+};
 
 /************************************************************************************
  * Profile kernel arguments
@@ -28,49 +104,71 @@
 template <typename TUP>
 class argument_profile
 {
+    using hash_t  = typename tuple_helper::hash_t<TUP>;
+    using equal_t = typename tuple_helper::equal_t<TUP>;
+
+    struct shard_t;
+
+    // Call count and latencies of an argument tuple in a shard
+    struct entry_t
+    {
+        shard_t*                  shard;
+        size_t                    count = 0;
+        rocblas_latency_histogram latency;
+    };
+
+    // Each thread counts calls in its own shard, whose mutex is only contended when
+    // the profile is dumped, or when a call's time is reported by another thread
+    struct shard_t
+    {
+        std::mutex                                        mutex;
+        std::unordered_map<TUP, entry_t, hash_t, equal_t> map;
+    };
+
     // Output stream
     mutable rocblas_internal_ostream os;
 
-    // Mutex for multithreaded access to table
-    mutable std::shared_timed_mutex mutex;
+    // Mutex for the list of shards
+    mutable std::mutex mutex;
+
+    // The shards are never freed, since pending timings of handles may outlive the profile
+    std::vector<shard_t*> shards;
 
-    // Table mapping argument tuples into counts
-    // size_t is used for the map target type since atomic types are not movable, and
-    // the map elements will only be moved when we hold an exclusive lock to the map.
-    std::unordered_map<TUP,
-                       size_t,
-                       typename tuple_helper::hash_t<TUP>,
-                       typename tuple_helper::equal_t<TUP>>
-        map;
+    // Get the calling thread's shard
+    shard_t& get_shard()
+    {
+        static thread_local shard_t* shard = nullptr;
+        if(!shard)
+        {
+            shard = new shard_t;
+            std::lock_guard<std::mutex> lock(mutex);
+            shards.push_back(shard);
+        }
+        return *shard;
+    }
 
 public:
-    // A tuple of arguments is looked up in an unordered map.
+    // A tuple of arguments is looked up in the calling thread's shard.
     // A count of the number of calls with these arguments is kept.
     // arg is assumed to be an rvalue for efficiency
-    void operator()(TUP&& arg)
+    // Returns the entry of the tuple, which can be passed to add_time()
+    entry_t* operator()(TUP&& arg)
     {
-        { // Acquire a shared lock for reading map
-            std::shared_lock<std::shared_timed_mutex> lock(mutex);
-
-            // Look up the tuple in the map
-            auto p = map.find(arg);
+        auto&                       shard = get_shard();
+        std::lock_guard<std::mutex> lock(shard.mutex);
 
-            // If tuple already exists, atomically increment count and return
-            if(p != map.end())
-            {
-                __atomic_fetch_add(&p->second, 1, __ATOMIC_SEQ_CST);
-                return;
-            }
-        } // Release shared lock
-
-        { // Acquire an exclusive lock for modifying map
-            std::lock_guard<std::shared_timed_mutex> lock(mutex);
+        // If doesn't already exist, insert tuple by moving arg and initializing count to 0.
+        auto& entry = shard.map.emplace(std::move(arg), entry_t{&shard}).first->second;
+        entry.count++;
+        return &entry;
+    }
 
-            // If doesn't already exist, insert tuple by moving arg and initializing count to 0.
-            // Increment the count after searching for tuple and returning old or new match.
-            // We hold a lock to the map, so we don't have to increment the count atomically.
-            map.emplace(std::move(arg), 0).first->second++;
-        } // Release exclusive lock
+    // Add the time of a call to the entry returned by operator()
+    static void add_time(void* e, float ms)
+    {
+        auto*                       entry = static_cast<entry_t*>(e);
+        std::lock_guard<std::mutex> lock(entry->shard->mutex);
+        entry->latency.add(ms * 1000.0);
     }
 
     // Constructor
@@ -80,21 +178,62 @@ public:
     {
     }
 
-    // Dump the current profile
+    // Dump the current profile, in decreasing order of total time and then of call count
     void dump() const
     {
-        // Acquire an exclusive lock to use map
-        std::lock_guard<std::shared_timed_mutex> lock(mutex);
+        // Merge the shards
+        std::unordered_map<TUP, std::pair<size_t, rocblas_latency_histogram>, hash_t, equal_t>
+            merged;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(auto* shard : shards)
+            {
+                std::lock_guard<std::mutex> shard_lock(shard->mutex);
+                for(const auto& p : shard->map)
+                {
+                    auto& m = merged[p.first];
+                    m.first += p.second.count;
+                    m.second.merge(p.second.latency);
+                }
+            }
+        }
+
+        std::vector<const typename decltype(merged)::value_type*> sorted;
+        for(const auto& p : merged)
+            sorted.push_back(&p);
+        std::stable_sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+            return a->second.second.total() != b->second.second.total()
+                       ? a->second.second.total() > b->second.second.total()
+                       : a->second.first > b->second.first;
+        });
 
         // Clear the output buffer
         os.clear();
 
-        // Print all of the tuples in the map
-        for(const auto& p : map)
+        // Print all of the tuples, with their latencies in microseconds if they were timed
+        for(const auto* p : sorted)
         {
+            const auto& latency = p->second.second;
             os << "- ";
-            tuple_helper::print_tuple_pairs(
-                os, std::tuple_cat(p.first, std::make_tuple("call_count", p.second)));
+            if(!latency.calls())
+                tuple_helper::print_tuple_pairs(
+                    os, std::tuple_cat(p->first, std::make_tuple("call_count", p->second.first)));
+            else
+                tuple_helper::print_tuple_pairs(
+                    os,
+                    std::tuple_cat(p->first,
+                                   std::make_tuple("call_count",
+                                                   p->second.first,
+                                                   "timed_count",
+                                                   latency.calls(),
+                                                   "total_us",
+                                                   std::round(latency.total()),
+                                                   "p50_us",
+                                                   std::round(latency.percentile(50)),
+                                                   "p95_us",
+                                                   std::round(latency.percentile(95)),
+                                                   "p99_us",
+                                                   std::round(latency.percentile(99)))));
         }
 
         // Flush out the dump
@@ -116,7 +255,8 @@ public:
 // if profile logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_profile) != 0
 // log_profile will call argument_profile to profile actual arguments,
-// keeping count of the number of times each set of arguments is used
+// keeping count of the number of times each set of arguments is used,
+// and with ROCBLAS_LOG_PROFILE_TIMING, timing each call on the handle's stream
 template <typename... Ts>
 void log_profile(rocblas_handle handle, const char* func, Ts&&... xs)
 {
@@ -125,13 +265,18 @@ void log_profile(rocblas_handle handle, const char* func, Ts&&... xs)
         "rocblas_function", func, "atomics_mode", handle->atomics_mode, std::forward<Ts>(xs)...);
 
     // Set up profile
-    static argument_profile<decltype(tup)> profile(*handle->log_profile_os);
+    using profile_t = argument_profile<decltype(tup)>;
+    static profile_t profile(*handle->log_profile_os);
 
     // Add at_quick_exit handler in case the program exits early
     static int aqe = at_quick_exit([] { profile.~argument_profile(); });
 
     // Profile the tuple
-    profile(std::move(tup));
+    auto* entry = profile(std::move(tup));
+
+    // Time the call, ignoring errors so that profiling cannot fail the call
+    if(handle->log_profile_timing)
+        handle->profile_timer.start(handle->get_stream(), profile_t::add_time, entry);
 }
 
 /********************************************
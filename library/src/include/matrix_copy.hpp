@@ -0,0 +1,300 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*******************************************************************************
+ * rocblas_matrix_copy_plan describes how a strided batched matrix is copied on
+ * the device in a single operation:
+ *
+ *   memcpy_1d: the matrices are contiguous, and are copied with one memcpy
+ *   memcpy_2d: the columns, or the matrices, are evenly spaced, and are copied
+ *              as the rows of one 2D memcpy
+ *   kernel:    the matrices are copied by one kernel launch, which loads vectors
+ *              of up to 16 bytes when the sizes, leading dimensions, strides
+ *              and addresses allow it
+ ******************************************************************************/
+struct rocblas_matrix_copy_plan
+{
+    enum method_t
+    {
+        none,
+        memcpy_1d,
+        memcpy_2d,
+        kernel,
+    };
+
+    method_t method    = none;
+    size_t   width     = 0; // Bytes copied by memcpy_1d, or per row by memcpy_2d
+    size_t   height    = 0; // Rows copied by memcpy_2d
+    size_t   src_pitch = 0; // Bytes between rows of memcpy_2d
+    size_t   dst_pitch = 0;
+    size_t   vector    = 1; // Elements per load of the kernel
+};
+
+/*******************************************************************************
+ * Plan the copy of batch_count matrices of n1 x n2 elements of elem_size bytes.
+ * src and dst are the addresses of the first matrices, or nullptr for arrays of
+ * pointers, which are always copied by the kernel one element at a time.
+ ******************************************************************************/
+inline rocblas_matrix_copy_plan rocblas_plan_matrix_copy(size_t         elem_size,
+                                                         const void*    src,
+                                                         rocblas_int    ld_src,
+                                                         rocblas_stride stride_src,
+                                                         const void*    dst,
+                                                         rocblas_int    ld_dst,
+                                                         rocblas_stride stride_dst,
+                                                         rocblas_int    n1,
+                                                         rocblas_int    n2,
+                                                         rocblas_int    batch_count)
+{
+    rocblas_matrix_copy_plan plan;
+    if(n1 <= 0 || n2 <= 0 || batch_count <= 0)
+        return plan;
+
+    if(!src || !dst)
+    {
+        plan.method = rocblas_matrix_copy_plan::kernel;
+        return plan;
+    }
+
+    // The strides of a single matrix are irrelevant
+    if(batch_count == 1)
+    {
+        stride_src = rocblas_stride(ld_src) * n2;
+        stride_dst = rocblas_stride(ld_dst) * n2;
+    }
+
+    if(src == dst && ld_src == ld_dst && stride_src == stride_dst)
+        return plan; // no copy if src matrix == dst matrix
+
+    if(stride_src == rocblas_stride(ld_src) * n2 && stride_dst == rocblas_stride(ld_dst) * n2)
+    {
+        // The columns of all of the matrices are evenly spaced
+        if(n1 == ld_src && n1 == ld_dst)
+        {
+            plan.method = rocblas_matrix_copy_plan::memcpy_1d;
+            plan.width  = elem_size * n1 * n2 * batch_count;
+        }
+        else
+        {
+            plan.method    = rocblas_matrix_copy_plan::memcpy_2d;
+            plan.width     = elem_size * n1;
+            plan.height    = size_t(n2) * batch_count;
+            plan.src_pitch = elem_size * ld_src;
+            plan.dst_pitch = elem_size * ld_dst;
+        }
+        return plan;
+    }
+
+    rocblas_stride matrix_size = rocblas_stride(n1) * n2;
+    if(n1 == ld_src && n1 == ld_dst && stride_src >= matrix_size && stride_dst >= matrix_size)
+    {
+        // The matrices are contiguous and evenly spaced
+        plan.method    = rocblas_matrix_copy_plan::memcpy_2d;
+        plan.width     = elem_size * matrix_size;
+        plan.height    = batch_count;
+        plan.src_pitch = elem_size * stride_src;
+        plan.dst_pitch = elem_size * stride_dst;
+        return plan;
+    }
+
+    // Use the widest vector whose loads and stores are aligned
+    plan.method = rocblas_matrix_copy_plan::kernel;
+    for(size_t bytes = 16; bytes > elem_size; bytes /= 2)
+    {
+        size_t v = bytes / elem_size;
+        if(bytes % elem_size || n1 % v || ld_src % v || ld_dst % v || stride_src % v
+           || stride_dst % v || uintptr_t(src) % bytes || uintptr_t(dst) % bytes)
+            continue;
+        plan.vector = v;
+        break;
+    }
+    return plan;
+}
+
+// Word of N bytes, which is loaded and stored as one vector
+template <size_t N>
+struct alignas(N) rocblas_copy_word
+{
+    char bytes[N];
+};
+
+/*******************************************************************************
+ * Copy kernel over words of type W, which are vectors of the matrix elements.
+ * rows, lda and ldb are in words; offsets and strides are in elements.
+ ******************************************************************************/
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename W, typename U, typename V>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+    rocblas_copy_matrix_kernel(rocblas_int    rows,
+                               rocblas_int    cols,
+                               U              a,
+                               rocblas_stride offset_a,
+                               rocblas_int    lda,
+                               rocblas_stride stride_a,
+                               V              b,
+                               rocblas_stride offset_b,
+                               rocblas_int    ldb,
+                               rocblas_stride stride_b)
+{
+    auto* xa = reinterpret_cast<const W*>(load_ptr_batch(a, hipBlockIdx_z, offset_a, stride_a));
+    auto* xb = reinterpret_cast<W*>(load_ptr_batch(b, hipBlockIdx_z, offset_b, stride_b));
+
+    size_t tx = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+    size_t ty = hipBlockIdx_y * DIM_Y + hipThreadIdx_y;
+
+    if(tx < rows && ty < cols)
+        xb[tx + ldb * ty] = xa[tx + lda * ty];
+}
+
+template <typename W, typename U, typename V>
+rocblas_status rocblas_copy_matrix_launch(rocblas_handle handle,
+                                          rocblas_int    rows,
+                                          rocblas_int    cols,
+                                          U              src,
+                                          rocblas_stride offset_src,
+                                          rocblas_int    ld_src,
+                                          rocblas_stride stride_src,
+                                          V              dst,
+                                          rocblas_stride offset_dst,
+                                          rocblas_int    ld_dst,
+                                          rocblas_stride stride_dst,
+                                          rocblas_int    batch_count)
+{
+    static constexpr rocblas_int DIM_X = 128;
+    static constexpr rocblas_int DIM_Y = 8;
+
+    dim3 grid((rows - 1) / DIM_X + 1, (cols - 1) / DIM_Y + 1, batch_count);
+    dim3 threads(DIM_X, DIM_Y);
+
+    hipLaunchKernelGGL((rocblas_copy_matrix_kernel<DIM_X, DIM_Y, W>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       rows,
+                       cols,
+                       src,
+                       offset_src,
+                       ld_src,
+                       stride_src,
+                       dst,
+                       offset_dst,
+                       ld_dst,
+                       stride_dst);
+    return rocblas_status_success;
+}
+
+// Address of the first matrix for planning, or nullptr for arrays of pointers
+template <typename T>
+inline const void* rocblas_matrix_copy_address(const T* p, rocblas_stride offset)
+{
+    return p + offset;
+}
+
+template <typename T>
+inline const void* rocblas_matrix_copy_address(const T* const* p, rocblas_stride offset)
+{
+    return nullptr;
+}
+
+/*******************************************************************************
+ * Copy batch_count matrices of n1 x n2 elements of type T on the handle's
+ * stream, with a single memcpy or kernel launch. src and dst may be strided
+ * pointers or arrays of pointers, with offsets in elements.
+ ******************************************************************************/
+template <typename T, typename U, typename V>
+rocblas_status rocblas_copy_matrix(rocblas_handle handle,
+                                   rocblas_int    n1,
+                                   rocblas_int    n2,
+                                   U              src,
+                                   rocblas_stride offset_src,
+                                   rocblas_int    ld_src,
+                                   rocblas_stride stride_src,
+                                   V              dst,
+                                   rocblas_stride offset_dst,
+                                   rocblas_int    ld_dst,
+                                   rocblas_stride stride_dst,
+                                   rocblas_int    batch_count)
+{
+    const void* src_address = rocblas_matrix_copy_address(src, offset_src);
+    const void* dst_address = rocblas_matrix_copy_address(dst, offset_dst);
+
+    auto plan = rocblas_plan_matrix_copy(sizeof(T),
+                                         src_address,
+                                         ld_src,
+                                         stride_src,
+                                         dst_address,
+                                         ld_dst,
+                                         stride_dst,
+                                         n1,
+                                         n2,
+                                         batch_count);
+
+    switch(plan.method)
+    {
+    case rocblas_matrix_copy_plan::none:
+        return rocblas_status_success;
+
+    case rocblas_matrix_copy_plan::memcpy_1d:
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(const_cast<void*>(dst_address),
+                                           src_address,
+                                           plan.width,
+                                           hipMemcpyDeviceToDevice,
+                                           handle->get_stream()));
+        return rocblas_status_success;
+
+    case rocblas_matrix_copy_plan::memcpy_2d:
+        RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(const_cast<void*>(dst_address),
+                                             plan.dst_pitch,
+                                             src_address,
+                                             plan.src_pitch,
+                                             plan.width,
+                                             plan.height,
+                                             hipMemcpyDeviceToDevice,
+                                             handle->get_stream()));
+        return rocblas_status_success;
+
+    case rocblas_matrix_copy_plan::kernel:
+        break;
+    }
+
+    rocblas_int v = plan.vector;
+#define ROCBLAS_COPY_MATRIX_LAUNCH(W)             \
+    rocblas_copy_matrix_launch<W>(handle,         \
+                                  n1 / v,         \
+                                  n2,             \
+                                  src,            \
+                                  offset_src,     \
+                                  ld_src / v,     \
+                                  stride_src,     \
+                                  dst,            \
+                                  offset_dst,     \
+                                  ld_dst / v,     \
+                                  stride_dst,     \
+                                  batch_count)
+
+    switch(v > 1 ? v * sizeof(T) : 0)
+    {
+    case 2:
+        return ROCBLAS_COPY_MATRIX_LAUNCH(rocblas_copy_word<2>);
+    case 4:
+        return ROCBLAS_COPY_MATRIX_LAUNCH(rocblas_copy_word<4>);
+    case 8:
+        return ROCBLAS_COPY_MATRIX_LAUNCH(rocblas_copy_word<8>);
+    case 16:
+        return ROCBLAS_COPY_MATRIX_LAUNCH(rocblas_copy_word<16>);
+    default:
+        return ROCBLAS_COPY_MATRIX_LAUNCH(T);
+    }
+
+#undef ROCBLAS_COPY_MATRIX_LAUNCH
+}
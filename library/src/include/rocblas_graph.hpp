@@ -0,0 +1,127 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+/*******************************************************************************
+ * Captured call sequences (rocblas_begin_capture and rocblas_graph_launch)
+ * While a handle is capturing, each supported call runs as usual, and is also
+ * recorded in the graph as a node. A node holds the call resolved past its
+ * logging, argument checks, workspace sizing and Tensile solution selection,
+ * so that replaying it only launches its kernels. The pointers of a node are
+ * passed through the remaps of the launch, which replace the buffers of the
+ * captured calls with new ones.
+ ******************************************************************************/
+struct _rocblas_graph
+{
+    // Replacement of pointers into the captured buffers of rocblas_graph_launch
+    class remapper
+    {
+        struct range_t
+        {
+            const char* begin;
+            const char* end;
+            char*       replacement;
+        };
+
+        std::vector<range_t> ranges; // Sorted by begin, and not overlapping
+
+    public:
+        // Set the remaps, returning rocblas_status_invalid_value if their buffers overlap
+        rocblas_status assign(const rocblas_graph_remap* remaps, rocblas_int count)
+        {
+            ranges.clear();
+            for(rocblas_int i = 0; i < count; ++i)
+            {
+                auto begin = static_cast<const char*>(remaps[i].captured);
+                if(remaps[i].size)
+                    ranges.push_back(
+                        {begin, begin + remaps[i].size, static_cast<char*>(remaps[i].replacement)});
+            }
+
+            std::sort(ranges.begin(), ranges.end(), [](const range_t& a, const range_t& b) {
+                return a.begin < b.begin;
+            });
+            for(size_t i = 1; i < ranges.size(); ++i)
+                if(ranges[i].begin < ranges[i - 1].end)
+                    return rocblas_status_invalid_value;
+            return rocblas_status_success;
+        }
+
+        // Return the replacement of ptr, or ptr if it is not in a remapped buffer
+        template <typename T>
+        T* operator()(T* ptr) const
+        {
+            auto p  = reinterpret_cast<const char*>(ptr);
+            auto it = std::upper_bound(
+                ranges.begin(), ranges.end(), p, [](const char* addr, const range_t& range) {
+                    return addr < range.begin;
+                });
+            if(it == ranges.begin() || p >= (--it)->end)
+                return ptr;
+            return reinterpret_cast<T*>(it->replacement + (p - it->begin));
+        }
+    };
+
+    // A scalar argument of a captured call. On the host, its value is kept, so that the
+    // scalar need not outlive the call, unless its address is remapped, in which case the
+    // replacement is read when the call is replayed. On the device, it is a pointer.
+    template <typename T>
+    class scalar_t
+    {
+        const T* ptr;
+        T        value;
+        bool     on_host;
+
+    public:
+        scalar_t(const T* ptr, rocblas_pointer_mode mode)
+            : ptr(ptr)
+            , value(mode == rocblas_pointer_mode_host && ptr ? *ptr : T{})
+            , on_host(mode == rocblas_pointer_mode_host)
+        {
+        }
+
+        const T* operator()(const remapper& remap) const
+        {
+            const T* replaced = remap(ptr);
+            return on_host && ptr && replaced == ptr ? &value : replaced;
+        }
+    };
+
+    // Run a captured call with its pointers remapped. If resolved is true, the call is
+    // launched from its resolution, using workspace, which has at least the size given
+    // when the call was captured; otherwise it goes through the normal dispatch of the call.
+    using launch_t = std::function<rocblas_status(
+        rocblas_handle handle, const remapper& remap, void* workspace, bool resolved)>;
+
+    struct node_t
+    {
+        launch_t             launch;
+        rocblas_pointer_mode pointer_mode; // Pointer mode of the captured call
+        const void*          solution; // Tensile solution of the captured call, or nullptr
+    };
+
+    const int           device; // Device of the capturing handle
+    std::vector<node_t> nodes;
+    size_t              workspace_bytes = 0; // Largest workspace of the nodes
+
+    explicit _rocblas_graph(int device)
+        : device(device)
+    {
+    }
+
+    // Run a call made on the capturing handle through its normal dispatch, and record it
+    // if it succeeds
+    rocblas_status capture(rocblas_handle handle, size_t workspace_bytes, launch_t launch);
+
+    // Replay the nodes on the handle's stream, with their pointers remapped. Nodes go through
+    // normal dispatch if the handle's device differs from the capturing handle's, if
+    // numerical checking is enabled, or if the workspace cannot be allocated.
+    rocblas_status launch(rocblas_handle handle, const remapper& remap);
+};
@@ -6,6 +6,7 @@
 
 #include "rocblas.h"
 #include "utility.hpp"
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <condition_variable>
@@ -109,9 +110,68 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
         // Queue of tasks
         std::queue<task_t> queue;
 
+        /*********************************************************************
+         * Asynchronous mode (ROCBLAS_LOG_ASYNC) replaces the promise per    *
+         * message with a bounded lock-free ring of messages, which the      *
+         * worker thread drains in batches coalesced into single writes.     *
+         *********************************************************************/
+
+        // Policy when the ring is full
+        enum class async_policy
+        {
+            sync, // Asynchronous mode is off; every message is waited on
+            block, // Wait for room in the ring
+            drop, // Discard the message and count it
+        };
+
+        // Slot of the ring; seq implements the bounded MPMC queue sequencing
+        struct async_cell
+        {
+            std::atomic<size_t> seq{0};
+            std::string         str;
+        };
+
+        // Policy and ring storage, fixed at construction
+        async_policy                  policy = async_policy::sync;
+        std::unique_ptr<async_cell[]> ring;
+        size_t                        ring_mask = 0;
+
+        // Producer and consumer positions; write_pos is published after each batch
+        alignas(64) std::atomic<size_t> enqueue_pos{0};
+        alignas(64) std::atomic<size_t> dequeue_pos{0};
+        std::atomic<size_t>             write_pos{0};
+
+        // Number of messages dropped because the ring was full
+        std::atomic<size_t> dropped{0};
+
+        // Set when the worker thread is sleeping, or when it must exit
+        std::atomic<bool> sleeping{false};
+        std::atomic<bool> done{false};
+
+        // Signaled by the worker thread after each batch is written
+        std::condition_variable drained;
+
+        // Fulfilled by the worker thread when it exits
+        std::promise<void> exited;
+
+        // Read ROCBLAS_LOG_ASYNC and ROCBLAS_LOG_ASYNC_QUEUE_SIZE
+        void init_async();
+
+        // Try to push a message into the ring, returning false if the ring is full
+        bool async_push(std::string& str);
+
+        // Pop a message from the ring into str, returning false if the ring is empty
+        bool async_pop(std::string& str);
+
+        // Wake up the worker thread if it is sleeping
+        void async_wake();
+
         // Worker thread which waits for and handles tasks sequentially
         void thread_function();
 
+        // Worker thread which drains the ring in batches
+        void async_thread_function();
+
     public:
         // Worker constructor creates a worker thread for a raw filehandle
         explicit worker(int fd);
@@ -119,6 +179,9 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
         // Send a string to be written
         void send(std::string);
 
+        // Wait until every message sent so far has been written
+        void drain();
+
         // Destroy a worker when all std::shared_ptr references to it are gone
         ~worker();
     };
@@ -210,6 +273,7 @@ public:
     }
 
     // For testing to allow file closing and deletion
+    // Pending asynchronous log messages are written before the workers are released
     static void clear_workers();
 
     // Convert stream output to string
@@ -446,6 +510,30 @@ public:
         return os;
     }
 
+    // gemm batching mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream&  os,
+                                                rocblas_gemm_batching_mode mode)
+    {
+        os.os << rocblas_gemm_batching_mode_to_string(mode);
+        return os;
+    }
+
+    // host result mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
+                                                rocblas_host_result_mode  mode)
+    {
+        os.os << rocblas_host_result_mode_to_string(mode);
+        return os;
+    }
+
+    // trsm inverse cache mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream&       os,
+                                                rocblas_trsm_inverse_cache_mode mode)
+    {
+        os.os << rocblas_trsm_inverse_cache_mode_to_string(mode);
+        return os;
+    }
+
     // gemm flags output
     friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
                                                 rocblas_gemm_flags        flags)
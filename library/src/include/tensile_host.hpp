@@ -359,6 +359,20 @@ struct RocblasContractionProblem
 template <typename Ti, typename To, typename Tc>
 rocblas_status runContractionProblem(RocblasContractionProblem<Ti, To, Tc> const& problem);
 
+/*******************************************************************************
+ * runContractionProblemDeviceScalars() solves a RocblasContractionProblem in  *
+ * device pointer mode, without copying alpha and beta to the host. Tensile    *
+ * computes A*B into device memory, and a kernel then reads alpha and beta on  *
+ * the device to compute D = alpha*A*B + beta*C. It is called by               *
+ * runContractionProblem(), which takes alpha and beta on the host. alpha and  *
+ * beta are copied to the host instead when A*B does not fit in device memory, *
+ * or when tuned is true, i.e. the tuning database has an entry for problem.   *
+ *******************************************************************************/
+template <typename Ti, typename To, typename Tc>
+rocblas_status
+    runContractionProblemDeviceScalars(RocblasContractionProblem<Ti, To, Tc> const& problem,
+                                       bool                                         tuned);
+
 /***********************************************************************************
  * Whether Tensile has been initialized for at least one device (used for testing) *
  ***********************************************************************************/
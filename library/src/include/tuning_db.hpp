@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_tuning_db maps gemm problems to the index of the Tensile solution
+ * which was measured to be the fastest for them, overriding Tensile's own
+ * selection. It is read from the file named by ROCBLAS_TENSILE_TUNING_DB,
+ * which rocblas-bench --tune writes. Each line of the file is one entry:
+ *
+ *   arch a_type c_type compute_type transA transB m n k batch_count lda ldb ldc ldd index
+ *
+ * e.g. "gfx908 f16_r f16_r f32_r N T 1024 512 64 1 1024 512 1024 1024 1234".
+ * Blank lines and text following a '#' are ignored. Only the entries of one
+ * architecture are kept, and a later entry for a problem replaces an earlier
+ * one, so that a file can be appended to by later tuning runs.
+ ******************************************************************************/
+struct rocblas_tuning_db_key
+{
+    std::string a_type, c_type, compute_type;
+    char        trans_a, trans_b;
+    int64_t     m, n, k, batch_count, lda, ldb, ldc, ldd;
+
+    auto tie() const
+    {
+        return std::tie(
+            a_type, c_type, compute_type, trans_a, trans_b, m, n, k, batch_count, lda, ldb, ldc, ldd);
+    }
+
+    bool operator==(const rocblas_tuning_db_key& other) const
+    {
+        return tie() == other.tie();
+    }
+};
+
+class rocblas_tuning_db
+{
+    struct hash_t
+    {
+        size_t operator()(const rocblas_tuning_db_key& key) const
+        {
+            size_t h = std::hash<std::string>{}(key.a_type);
+            for(int64_t x : {key.m, key.n, key.k, key.batch_count, key.lda, key.ldb, key.ldc})
+                h = h * 31 + std::hash<int64_t>{}(x);
+            return h * 31 + (size_t(key.trans_a) << 8 | size_t(key.trans_b));
+        }
+    };
+
+    std::unordered_map<rocblas_tuning_db_key, int32_t, hash_t> entries;
+
+public:
+    // Read the entries of arch from is, returning the numbers of the lines which are malformed
+    std::vector<size_t> read(std::istream& is, const std::string& arch)
+    {
+        std::vector<size_t> bad_lines;
+        std::string         line;
+        for(size_t line_num = 1; std::getline(is, line); ++line_num)
+        {
+            line = line.substr(0, line.find('#'));
+
+            std::istringstream    iss(line);
+            std::string           entry_arch;
+            rocblas_tuning_db_key key;
+            int32_t               index;
+            if(!(iss >> entry_arch))
+                continue;
+
+            std::string rest;
+            if(!(iss >> key.a_type >> key.c_type >> key.compute_type >> key.trans_a >> key.trans_b
+                 >> key.m >> key.n >> key.k >> key.batch_count >> key.lda >> key.ldb >> key.ldc
+                 >> key.ldd >> index)
+               || iss >> rest)
+                bad_lines.push_back(line_num);
+            else if(entry_arch == arch)
+                entries[key] = index;
+        }
+        return bad_lines;
+    }
+
+    // Return the solution index of the problem, or -1 if it has no entry
+    int32_t find(const rocblas_tuning_db_key& key) const
+    {
+        auto it = entries.find(key);
+        return it == entries.end() ? -1 : it->second;
+    }
+
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    // Write an entry in the format which read() accepts
+    static void write(std::ostream&                os,
+                      const std::string&           arch,
+                      const rocblas_tuning_db_key& key,
+                      int32_t                      index)
+    {
+        os << arch << ' ' << key.a_type << ' ' << key.c_type << ' ' << key.compute_type << ' '
+           << key.trans_a << ' ' << key.trans_b << ' ' << key.m << ' ' << key.n << ' ' << key.k
+           << ' ' << key.batch_count << ' ' << key.lda << ' ' << key.ldb << ' ' << key.ldc << ' '
+           << key.ldd << ' ' << index << '\n';
+    }
+};
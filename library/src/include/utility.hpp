@@ -291,6 +291,26 @@ constexpr const char* rocblas_atomics_mode_to_string(rocblas_atomics_mode mode)
     return mode != rocblas_atomics_not_allowed ? "atomics_allowed" : "atomics_not_allowed";
 }
 
+// Convert gemm batching mode to string
+constexpr const char* rocblas_gemm_batching_mode_to_string(rocblas_gemm_batching_mode mode)
+{
+    return mode == rocblas_gemm_batching_deferred ? "gemm_batching_deferred" : "gemm_batching_none";
+}
+
+// Convert host result mode to string
+constexpr const char* rocblas_host_result_mode_to_string(rocblas_host_result_mode mode)
+{
+    return mode == rocblas_host_result_deferred ? "host_result_deferred" : "host_result_blocking";
+}
+
+// Convert trsm inverse cache mode to string
+constexpr const char*
+    rocblas_trsm_inverse_cache_mode_to_string(rocblas_trsm_inverse_cache_mode mode)
+{
+    return mode == rocblas_trsm_inverse_cache_enabled ? "trsm_inverse_cache_enabled"
+                                                      : "trsm_inverse_cache_none";
+}
+
 // Convert gemm flags to string
 constexpr const char* rocblas_gemm_flags_to_string(rocblas_gemm_flags)
 {
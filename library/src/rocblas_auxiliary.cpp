@@ -7,8 +7,13 @@
 #include "rocblas-auxiliary.h"
 #include <cctype>
 #include <cstdlib>
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 /* ============================================================================================ */
 
@@ -102,6 +107,374 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief get gemm batching mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_gemm_batching_mode(rocblas_handle              handle,
+                                                         rocblas_gemm_batching_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->gemm_batching_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_gemm_batching_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set gemm batching mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemm_batching_mode(rocblas_handle             handle,
+                                                         rocblas_gemm_batching_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_gemm_batching_mode", mode);
+    if(mode != rocblas_gemm_batching_none && mode != rocblas_gemm_batching_deferred)
+        return rocblas_status_invalid_value;
+    handle->gemm_batching_mode = mode;
+
+    // Calls which were queued are launched when deferral stops
+    if(mode == rocblas_gemm_batching_none)
+        return handle->gemm_batcher.flush(handle);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief launch the gemm calls queued by rocblas_gemm_batching_deferred
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_flush_gemm_batches(rocblas_handle handle)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_flush_gemm_batches");
+    return handle->gemm_batcher.flush(handle);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get host result mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_host_result_mode(rocblas_handle            handle,
+                                                       rocblas_host_result_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->host_result_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_host_result_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set host result mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_host_result_mode(rocblas_handle           handle,
+                                                       rocblas_host_result_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_host_result_mode", mode);
+    if(mode != rocblas_host_result_blocking && mode != rocblas_host_result_deferred)
+        return rocblas_status_invalid_value;
+    handle->host_result_mode = mode;
+
+    // Results in flight are written before blocking mode returns
+    if(mode == rocblas_host_result_blocking)
+        return handle->host_results.synchronize();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the event marking when the deferred host results have been written
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_host_results_event(rocblas_handle handle, hipEvent_t* event)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_host_results_event");
+    if(!event)
+        return rocblas_status_invalid_pointer;
+    return handle->host_results.get_event(event);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief wait for the deferred host results
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_synchronize_host_results(rocblas_handle handle)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_synchronize_host_results");
+    return handle->host_results.synchronize();
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get trsm inverse cache mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_trsm_inverse_cache_mode(
+    rocblas_handle handle, rocblas_trsm_inverse_cache_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->trsm_inverse_cache_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_trsm_inverse_cache_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set trsm inverse cache mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_trsm_inverse_cache_mode(
+    rocblas_handle handle, rocblas_trsm_inverse_cache_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_trsm_inverse_cache_mode", mode);
+    if(mode != rocblas_trsm_inverse_cache_none && mode != rocblas_trsm_inverse_cache_enabled)
+        return rocblas_status_invalid_value;
+    handle->trsm_inverse_cache_mode = mode;
+
+    // The cached inverses are freed when the cache is disabled
+    if(mode == rocblas_trsm_inverse_cache_none)
+        handle->trsm_inverses.clear();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set the generation of the matrices whose trsm inverses are cached
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_trsm_inverse_generation(rocblas_handle handle,
+                                                              uint64_t       generation)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_trsm_inverse_generation", generation);
+    handle->trsm_inverses.set_generation(generation);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the numbers of hits and misses of the trsm inverse cache
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_trsm_inverse_cache_stats(rocblas_handle handle, size_t* hits, size_t* misses)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!hits || !misses)
+        return rocblas_status_invalid_pointer;
+    handle->trsm_inverses.get_stats(hits, misses);
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_trsm_inverse_cache_stats", *hits, *misses);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief start capturing the calls made on a handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_begin_capture(rocblas_handle handle)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_begin_capture");
+    if(handle->capture)
+        return rocblas_status_invalid_value;
+    handle->capture = std::make_unique<_rocblas_graph>(handle->getDevice());
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief stop capturing the calls made on a handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_end_capture(rocblas_handle handle, rocblas_graph* graph)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_end_capture");
+    if(!graph)
+        return rocblas_status_invalid_pointer;
+    if(!handle->capture)
+        return rocblas_status_invalid_value;
+    *graph = handle->capture.release();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief replay the calls of a graph on a handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_graph_launch(rocblas_handle             handle,
+                                               rocblas_graph              graph,
+                                               const rocblas_graph_remap* remaps,
+                                               rocblas_int                remap_count)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_graph_launch", graph, remap_count);
+    if(remap_count < 0)
+        return rocblas_status_invalid_size;
+    if(!graph || (remap_count && !remaps))
+        return rocblas_status_invalid_pointer;
+
+    // Replayed calls would be missing from a graph being captured
+    if(handle->get_capture())
+        return rocblas_status_invalid_value;
+
+    _rocblas_graph::remapper remap;
+    RETURN_IF_ROCBLAS_ERROR(remap.assign(remaps, remap_count));
+    handle->launch_deferred_gemms();
+    return graph->launch(handle, remap);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the number of calls captured in a graph
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_graph_get_node_count(rocblas_graph graph, rocblas_int* node_count)
+try
+{
+    if(!graph || !node_count)
+        return rocblas_status_invalid_pointer;
+    *node_count = rocblas_int(graph->nodes.size());
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief destroy a graph
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_graph_destroy(rocblas_graph graph)
+try
+{
+    delete graph;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief wait for and report deferred numerical checks
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_synchronize_check_numerics(rocblas_handle handle)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_synchronize_check_numerics");
+    RETURN_IF_ROCBLAS_ERROR(handle->check_numerics_deferred.harvest(true));
+    return handle->check_numerics_deferred.take_status();
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief query the preferable supported int8 input layout for gemm by device
  ******************************************************************************/
@@ -159,114 +532,666 @@ try
     // call destructor
     delete handle;
 
-    return rocblas_status_success;
-}
-catch(...)
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   set rocblas stream used for all subsequent library function calls.
+ *   If not set, all hip kernels will take the default NULL stream.
+ *   stream must be created before this call
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_stream(rocblas_handle handle, hipStream_t stream)
+try
+{
+    // If handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // Log rocblas_set_stream
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_stream", stream);
+
+    // If the stream is unchanged, return immediately
+    if(stream == handle->stream)
+        return rocblas_status_success;
+
+    // The new stream must be valid
+    if(stream != 0 && hipStreamQuery(stream) == hipErrorInvalidResourceHandle)
+        return rocblas_status_invalid_value;
+
+    // Launch the deferred gemms on the old stream
+    handle->gemm_batcher.launch(handle);
+
+    // Set the new stream
+    handle->stream = stream;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   get rocblas stream used for all subsequent library function calls.
+ *   If not set, all hip kernels will take the default NULL stream.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream_id)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stream_id)
+        return rocblas_status_invalid_pointer;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_stream", *stream_id);
+
+    // Work which the caller enqueues on the stream follows the deferred gemms
+    handle->launch_deferred_gemms();
+    *stream_id = handle->get_stream();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief  Non-unit stride vector and matrix copies on device. Vectors and
+     matrices are void pointers with element size elem_size
+ ******************************************************************************/
+constexpr rocblas_int NB_X         = 256;
+constexpr rocblas_int MATRIX_DIM_X = 128;
+constexpr rocblas_int MATRIX_DIM_Y = 8;
+
+ROCBLAS_KERNEL void rocblas_copy_void_ptr_vector_kernel(rocblas_int n,
+                                                        rocblas_int elem_size,
+                                                        const void* x,
+                                                        rocblas_int incx,
+                                                        void*       y,
+                                                        rocblas_int incy)
+{
+    size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(tid < n)
+    {
+        memcpy(
+            (char*)y + tid * incy * elem_size, (const char*)x + tid * incx * elem_size, elem_size);
+    }
+}
+
+ROCBLAS_KERNEL void rocblas_copy_void_ptr_matrix_kernel(rocblas_int rows,
+                                                        rocblas_int cols,
+                                                        size_t      elem_size,
+                                                        const void* a,
+                                                        rocblas_int lda,
+                                                        void*       b,
+                                                        rocblas_int ldb)
+{
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(tx < rows && ty < cols)
+        memcpy((char*)b + (tx + ldb * ty) * elem_size,
+               (const char*)a + (tx + lda * ty) * elem_size,
+               elem_size);
+}
+
+// Copy a rows x cols matrix on the device, on the null stream unless another is given.
+// A vector is treated as a matrix with one row, whose leading dimension is its increment.
+static void rocblas_copy_void_ptr_matrix(rocblas_int rows,
+                                         rocblas_int cols,
+                                         rocblas_int elem_size,
+                                         const void* a,
+                                         rocblas_int lda,
+                                         void*       b,
+                                         rocblas_int ldb,
+                                         hipStream_t stream = 0)
+{
+    if(rows == 1)
+    {
+        hipLaunchKernelGGL(rocblas_copy_void_ptr_vector_kernel,
+                           dim3((cols - 1) / NB_X + 1),
+                           dim3(NB_X),
+                           0,
+                           stream,
+                           cols,
+                           elem_size,
+                           a,
+                           lda,
+                           b,
+                           ldb);
+    }
+    else
+    {
+        hipLaunchKernelGGL(rocblas_copy_void_ptr_matrix_kernel,
+                           dim3((rows - 1) / MATRIX_DIM_X + 1, (cols - 1) / MATRIX_DIM_Y + 1),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           stream,
+                           rows,
+                           cols,
+                           elem_size,
+                           a,
+                           lda,
+                           b,
+                           ldb);
+    }
+}
+
+/*******************************************************************************
+ * Process-wide pool of staging buffers for rocblas_set/get_vector/matrix.
+ * Each buffer pairs a pinned host buffer with a device buffer of the same size,
+ * and an event marking when the last transfer using the buffer has completed.
+ * Buffers are created on first use and kept for reuse by later calls, instead
+ * of being allocated and freed for every chunk of every call.
+ ******************************************************************************/
+class rocblas_staging_pool
+{
+public:
+    // arbitrarily assign buffer size to 1Mb
+    static constexpr size_t BUFF_BYTES = 1048576;
+
+    struct buffer
+    {
+        void*      host   = nullptr;
+        void*      device = nullptr;
+        hipEvent_t event  = nullptr;
+    };
+
+    // Get a buffer for the current device, allocating one if none are free
+    std::unique_ptr<buffer> acquire(int device_id)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto&                       free_list = free_buffers[device_id];
+            if(!free_list.empty())
+            {
+                auto buf = std::move(free_list.back());
+                free_list.pop_back();
+                return buf;
+            }
+        }
+
+        auto buf = std::make_unique<buffer>();
+        if(hipHostMalloc(&buf->host, BUFF_BYTES) != hipSuccess
+           || (hipMalloc)(&buf->device, BUFF_BYTES) != hipSuccess
+           || hipEventCreateWithFlags(&buf->event, hipEventDisableTiming) != hipSuccess)
+        {
+            destroy(*buf);
+            return nullptr;
+        }
+        return buf;
+    }
+
+    // Return an idle buffer to the pool, or free it if the pool is full
+    void release(int device_id, std::unique_ptr<buffer> buf)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto&                       free_list = free_buffers[device_id];
+            if(free_list.size() < MAX_FREE_BUFFERS)
+            {
+                free_list.push_back(std::move(buf));
+                return;
+            }
+        }
+        destroy(*buf);
+    }
+
+    // The pool is never destroyed, to avoid HIP calls during static destruction
+    static rocblas_staging_pool& instance()
+    {
+        static auto* pool = new rocblas_staging_pool;
+        return *pool;
+    }
+
+private:
+    // Maximum number of idle buffers kept per device
+    static constexpr size_t MAX_FREE_BUFFERS = 8;
+
+    std::mutex                                                   mutex;
+    std::unordered_map<int, std::vector<std::unique_ptr<buffer>>> free_buffers;
+
+    static void destroy(buffer& buf)
+    {
+        if(buf.event)
+            hipEventDestroy(buf.event);
+        if(buf.device)
+            (hipFree)(buf.device);
+        if(buf.host)
+            hipHostFree(buf.host);
+    }
+};
+
+// N staging buffers borrowed from the pool, so that packing or unpacking
+// one chunk on the host overlaps the transfers and kernels of the other chunks.
+// clang-format off
+template <size_t N>
+class [[nodiscard]] rocblas_staging_buffers
+{
+    int                                           device_id;
+    std::unique_ptr<rocblas_staging_pool::buffer> bufs[N];
+
+public:
+    rocblas_staging_buffers()
+    {
+        hipGetDevice(&device_id);
+        for(auto& buf : bufs)
+            buf = rocblas_staging_pool::instance().acquire(device_id);
+    }
+
+    // Wait for outstanding transfers, then return the buffers to the pool
+    ~rocblas_staging_buffers()
+    {
+        for(auto& buf : bufs)
+            if(buf)
+            {
+                hipEventSynchronize(buf->event);
+                rocblas_staging_pool::instance().release(device_id, std::move(buf));
+            }
+    }
+
+    explicit operator bool() const
+    {
+        return std::all_of(std::begin(bufs), std::end(bufs), [](auto& buf) { return !!buf; });
+    }
+
+    rocblas_staging_pool::buffer& operator[](size_t i)
+    {
+        return *bufs[i % N];
+    }
+
+    rocblas_staging_buffers(const rocblas_staging_buffers&) = delete;
+    rocblas_staging_buffers& operator=(const rocblas_staging_buffers&) = delete;
+};
+
+using rocblas_double_buffer = rocblas_staging_buffers<2>;
+// clang-format on
+
+// Copy cols columns of col_bytes bytes each between two host matrices
+static void rocblas_copy_host_columns(
+    size_t col_bytes, size_t cols, const void* a, size_t lda_bytes, void* b, size_t ldb_bytes)
 {
-    return exception_to_rocblas_status();
+    if(lda_bytes == col_bytes && ldb_bytes == col_bytes)
+        memcpy(b, a, col_bytes * cols);
+    else
+        for(size_t i = 0; i < cols; i++)
+            memcpy((char*)b + i * ldb_bytes, (const char*)a + i * lda_bytes, col_bytes);
 }
 
 /*******************************************************************************
- *! \brief   set rocblas stream used for all subsequent library function calls.
- *   If not set, all hip kernels will take the default NULL stream.
- *   stream must be created before this call
+ *! \brief   copies void* matrix a_h with leading dimension lda on host to void*
+     matrix b_d with leading dimension ldb on device, through staging buffers.
+     Chunks of columns are packed into a pinned host buffer and transferred
+     asynchronously, alternating between two buffers, so that packing chunk
+     i+1 overlaps the transfer and unpacking of chunk i. A vector is treated
+     as a matrix with one row, whose leading dimension is its increment.
  ******************************************************************************/
-extern "C" rocblas_status rocblas_set_stream(rocblas_handle handle, hipStream_t stream)
-try
+static rocblas_status rocblas_staged_set_matrix(rocblas_int rows,
+                                                rocblas_int cols,
+                                                rocblas_int elem_size,
+                                                const void* a_h,
+                                                rocblas_int lda,
+                                                void*       b_d,
+                                                rocblas_int ldb)
 {
-    // If handle not valid
-    if(!handle)
-        return rocblas_status_invalid_handle;
+    size_t col_bytes = size_t(elem_size) * rows;
+    size_t n_cols    = rocblas_staging_pool::BUFF_BYTES / col_bytes; // columns in buffer
+    size_t n_copy    = (cols - 1) / n_cols + 1; // number of times buffer is copied
 
-    // Log rocblas_set_stream
-    if(handle->layer_mode & rocblas_layer_mode_log_trace)
-        log_trace(handle, "rocblas_set_stream", stream);
+    rocblas_double_buffer bufs;
+    if(!bufs)
+        return rocblas_status_memory_error;
 
-    // If the stream is unchanged, return immediately
-    if(stream == handle->stream)
-        return rocblas_status_success;
+    for(size_t i_copy = 0; i_copy < n_copy; i_copy++)
+    {
+        auto&       buf         = bufs[i_copy];
+        size_t      i_start     = i_copy * n_cols;
+        size_t      n_cols_max  = std::min(cols - i_start, n_cols);
+        void*       b_d_start   = (char*)b_d + i_start * ldb * size_t(elem_size);
+        const void* a_h_start   = (const char*)a_h + i_start * lda * size_t(elem_size);
+        size_t      contig_size = col_bytes * n_cols_max;
 
-    // The new stream must be valid
-    if(stream != 0 && hipStreamQuery(stream) == hipErrorInvalidResourceHandle)
-        return rocblas_status_invalid_value;
+        // wait until the previous transfer out of this buffer has completed
+        PRINT_IF_HIP_ERROR(hipEventSynchronize(buf.event));
 
-    // Set the new stream
-    handle->stream = stream;
+        // host matrix -> pinned host buffer
+        rocblas_copy_host_columns(
+            col_bytes, n_cols_max, a_h_start, lda * size_t(elem_size), buf.host, col_bytes);
+
+        if(ldb == rows)
+        {
+            // pinned host buffer -> contiguous device matrix
+            PRINT_IF_HIP_ERROR(
+                hipMemcpyAsync(b_d_start, buf.host, contig_size, hipMemcpyHostToDevice, 0));
+        }
+        else
+        {
+            // pinned host buffer -> device buffer -> non-contiguous device matrix
+            PRINT_IF_HIP_ERROR(
+                hipMemcpyAsync(buf.device, buf.host, contig_size, hipMemcpyHostToDevice, 0));
+            rocblas_copy_void_ptr_matrix(
+                rows, n_cols_max, elem_size, buf.device, rows, b_d_start, ldb);
+        }
+        PRINT_IF_HIP_ERROR(hipEventRecord(buf.event, 0));
+    }
     return rocblas_status_success;
 }
-catch(...)
-{
-    return exception_to_rocblas_status();
-}
 
 /*******************************************************************************
- *! \brief   get rocblas stream used for all subsequent library function calls.
- *   If not set, all hip kernels will take the default NULL stream.
+ *! \brief   copies void* matrix a_d with leading dimension lda on device to
+     void* matrix b_h with leading dimension ldb on host, through staging
+     buffers. Chunk i+1 is gathered and transferred while chunk i is unpacked
+     on the host.
  ******************************************************************************/
-extern "C" rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream_id)
-try
+static rocblas_status rocblas_staged_get_matrix(rocblas_int rows,
+                                                rocblas_int cols,
+                                                rocblas_int elem_size,
+                                                const void* a_d,
+                                                rocblas_int lda,
+                                                void*       b_h,
+                                                rocblas_int ldb)
 {
-    // if handle not valid
-    if(!handle)
-        return rocblas_status_invalid_handle;
-    if(!stream_id)
-        return rocblas_status_invalid_pointer;
-    if(handle->layer_mode & rocblas_layer_mode_log_trace)
-        log_trace(handle, "rocblas_get_stream", *stream_id);
-    *stream_id = handle->get_stream();
+    size_t col_bytes = size_t(elem_size) * rows;
+    size_t n_cols    = rocblas_staging_pool::BUFF_BYTES / col_bytes; // columns in buffer
+    size_t n_copy    = (cols - 1) / n_cols + 1; // number of times buffer is copied
+
+    rocblas_double_buffer bufs;
+    if(!bufs)
+        return rocblas_status_memory_error;
+
+    for(size_t i_copy = 0; i_copy <= n_copy; i_copy++)
+    {
+        // start transferring chunk i_copy
+        if(i_copy < n_copy)
+        {
+            auto&       buf         = bufs[i_copy];
+            size_t      i_start     = i_copy * n_cols;
+            size_t      n_cols_max  = std::min(cols - i_start, n_cols);
+            const void* a_d_start   = (const char*)a_d + i_start * lda * size_t(elem_size);
+            size_t      contig_size = col_bytes * n_cols_max;
+
+            if(lda == rows)
+            {
+                // contiguous device matrix -> pinned host buffer
+                PRINT_IF_HIP_ERROR(
+                    hipMemcpyAsync(buf.host, a_d_start, contig_size, hipMemcpyDeviceToHost, 0));
+            }
+            else
+            {
+                // non-contiguous device matrix -> device buffer -> pinned host buffer
+                rocblas_copy_void_ptr_matrix(
+                    rows, n_cols_max, elem_size, a_d_start, lda, buf.device, rows);
+                PRINT_IF_HIP_ERROR(
+                    hipMemcpyAsync(buf.host, buf.device, contig_size, hipMemcpyDeviceToHost, 0));
+            }
+            PRINT_IF_HIP_ERROR(hipEventRecord(buf.event, 0));
+        }
+
+        // meanwhile, unpack chunk i_copy - 1 once it has arrived
+        if(i_copy > 0)
+        {
+            auto&  buf        = bufs[i_copy - 1];
+            size_t i_start    = (i_copy - 1) * n_cols;
+            size_t n_cols_max = std::min(cols - i_start, n_cols);
+            void*  b_h_start  = (char*)b_h + i_start * ldb * size_t(elem_size);
+
+            PRINT_IF_HIP_ERROR(hipEventSynchronize(buf.event));
+
+            // pinned host buffer -> host matrix
+            rocblas_copy_host_columns(
+                col_bytes, n_cols_max, buf.host, col_bytes, b_h_start, ldb * size_t(elem_size));
+        }
+    }
     return rocblas_status_success;
 }
-catch(...)
-{
-    return exception_to_rocblas_status();
-}
 
 /*******************************************************************************
- *! \brief  Non-unit stride vector copy on device. Vectors are void pointers
-     with element size elem_size
+ * Process-wide ring of non-blocking streams for each device, on which the
+ * column panels of rocblas_set/get_matrix_async_panels are transferred, so that
+ * the transfers of consecutive panels overlap each other and work waiting on
+ * the panels which have already arrived. The streams are never destroyed.
  ******************************************************************************/
-// arbitrarily assign max buffer size to 1Mb
-constexpr size_t      VEC_BUFF_MAX_BYTES = 1048576;
-constexpr rocblas_int NB_X               = 256;
-
-ROCBLAS_KERNEL void rocblas_copy_void_ptr_vector_kernel(rocblas_int n,
-                                                        rocblas_int elem_size,
-                                                        const void* x,
-                                                        rocblas_int incx,
-                                                        void*       y,
-                                                        rocblas_int incy)
+class rocblas_transfer_streams
 {
-    size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    if(tid < n)
+public:
+    static constexpr size_t N_STREAMS = 4;
+
+    // Get the streams of the current device, creating them on first use
+    static const hipStream_t* get(int device_id)
     {
-        memcpy(
-            (char*)y + tid * incy * elem_size, (const char*)x + tid * incx * elem_size, elem_size);
+        static auto* streams = new rocblas_transfer_streams;
+
+        std::lock_guard<std::mutex> lock(streams->mutex);
+        auto&                       ring = streams->rings[device_id];
+        for(auto& stream : ring)
+            if(!stream && hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) != hipSuccess)
+            {
+                stream = nullptr;
+                return nullptr;
+            }
+        return ring.data();
     }
-}
 
-/* ============================================================================================ */
-// TODO: Need to replace this with new device memory allocation system
+private:
+    std::mutex                                                    mutex;
+    std::unordered_map<int, std::array<hipStream_t, N_STREAMS>> rings;
+};
 
-// device_malloc wraps hipMalloc and provides same API as malloc
-static void* device_malloc(size_t byte_size)
+/*******************************************************************************
+ *! \brief   copies a rows x cols void* matrix between host and device in panels
+     of panel_cols columns. Panel i is transferred on ring stream i % N_STREAMS
+     after the work already queued on stream, and panel_events[i], if given,
+     is recorded when it has arrived. stream waits for all panels.
+
+     Pinned host matrices are copied directly, so the call returns once every
+     panel is queued. Other host matrices are staged through pinned buffers,
+     packing or unpacking on the host while other chunks are transferred, and
+     the call returns when the host matrix has been read or written; then the
+     panel events of a get mark when the device panels have been read.
+ ******************************************************************************/
+// Whether ptr is host memory allocated or registered with HIP
+static bool rocblas_is_pinned_host_pointer(const void* ptr)
 {
-    void* pointer = nullptr;
-    PRINT_IF_HIP_ERROR((hipMalloc)(&pointer, byte_size));
-    return pointer;
+    hipPointerAttribute_t attr;
+    if(hipPointerGetAttributes(&attr, ptr) != hipSuccess)
+    {
+        hipGetLastError(); // clear the error of an unknown pointer
+        return false;
+    }
+    return attr.memoryType == hipMemoryTypeHost;
 }
 
-// device_free wraps hipFree and provides same API as free
-static void device_free(void* ptr)
+static rocblas_status rocblas_matrix_async_panels(hipMemcpyKind kind,
+                                                  rocblas_int   rows,
+                                                  rocblas_int   cols,
+                                                  rocblas_int   elem_size,
+                                                  const void*   a,
+                                                  rocblas_int   lda,
+                                                  void*         b,
+                                                  rocblas_int   ldb,
+                                                  rocblas_int   panel_cols,
+                                                  hipEvent_t*   panel_events,
+                                                  hipStream_t   stream)
 {
-    PRINT_IF_HIP_ERROR((hipFree)(ptr));
-}
+    constexpr size_t N_STREAMS = rocblas_transfer_streams::N_STREAMS;
+
+    const bool set    = kind == hipMemcpyHostToDevice;
+    const bool pinned = rocblas_is_pinned_host_pointer(set ? a : b);
+
+    size_t col_bytes = size_t(elem_size) * rows;
+    size_t lda_bytes = size_t(elem_size) * lda;
+    size_t ldb_bytes = size_t(elem_size) * ldb;
+    size_t n_panels  = (cols - 1) / size_t(panel_cols) + 1;
+    size_t n_rings   = std::min(n_panels, N_STREAMS);
+
+    // Columns of the chunks staged through each buffer. A column larger than a
+    // buffer is copied directly, which HIP stages synchronously.
+    size_t chunk_cols = pinned ? 0 : rocblas_staging_pool::BUFF_BYTES / col_bytes;
+
+    std::unique_ptr<rocblas_staging_buffers<N_STREAMS>> bufs;
+    if(chunk_cols)
+    {
+        bufs = std::make_unique<rocblas_staging_buffers<N_STREAMS>>();
+        if(!*bufs)
+            return rocblas_status_memory_error;
+    }
+
+    int device_id;
+    RETURN_IF_HIP_ERROR(hipGetDevice(&device_id));
+    const hipStream_t* ring = rocblas_transfer_streams::get(device_id);
+    if(!ring)
+        return rocblas_status_internal_error;
+
+    // events[0] is recorded on stream before the panels, and events[1 + s] on
+    // ring stream s after its last panel. Events may be destroyed while pending.
+    hipEvent_t events[1 + N_STREAMS] = {};
+    auto       destroy_events        = [&] {
+        for(auto& event : events)
+            if(event)
+                hipEventDestroy(event);
+    };
+    for(auto& event : events)
+        if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+        {
+            event = nullptr;
+            destroy_events();
+            return rocblas_status_internal_error;
+        }
+
+    PRINT_IF_HIP_ERROR(hipEventRecord(events[0], stream));
+    for(size_t s = 0; s < n_rings; s++)
+        PRINT_IF_HIP_ERROR(hipStreamWaitEvent(ring[s], events[0], 0));
+
+    auto panel_copy = [&](size_t col, size_t n_cols, hipStream_t s) {
+        auto a_start = (const char*)a + col * lda_bytes;
+        auto b_start = (char*)b + col * ldb_bytes;
+        if(lda == rows && ldb == rows)
+            PRINT_IF_HIP_ERROR(hipMemcpyAsync(b_start, a_start, col_bytes * n_cols, kind, s));
+        else
+            PRINT_IF_HIP_ERROR(hipMemcpy2DAsync(
+                b_start, ldb_bytes, a_start, lda_bytes, col_bytes, n_cols, kind, s));
+    };
+
+    if(!chunk_cols)
+    {
+        for(size_t p = 0; p < n_panels; p++)
+        {
+            size_t col = p * panel_cols;
+            panel_copy(col, std::min(cols - col, size_t(panel_cols)), ring[p % N_STREAMS]);
+            if(panel_events)
+                PRINT_IF_HIP_ERROR(hipEventRecord(panel_events[p], ring[p % N_STREAMS]));
+        }
+    }
+    else
+    {
+        auto& buffers = *bufs;
+
+        // Chunks of the host matrix waiting to be unpacked from their buffers
+        struct pending
+        {
+            char*  b_h;
+            size_t n_cols;
+        };
+        pending waiting[N_STREAMS] = {};
+        auto    unpack             = [&](size_t i) {
+            auto& chunk = waiting[i % N_STREAMS];
+            if(chunk.b_h)
+            {
+                auto& buf = buffers[i];
+                PRINT_IF_HIP_ERROR(hipEventSynchronize(buf.event));
+                rocblas_copy_host_columns(
+                    col_bytes, chunk.n_cols, buf.host, col_bytes, chunk.b_h, ldb_bytes);
+                chunk.b_h = nullptr;
+            }
+        };
+
+        size_t i_chunk = 0;
+        for(size_t p = 0; p < n_panels; p++)
+        {
+            hipStream_t s         = ring[p % N_STREAMS];
+            size_t      panel_end = std::min(size_t(cols), (p + 1) * panel_cols);
+            for(size_t col = p * panel_cols; col < panel_end; col += chunk_cols, i_chunk++)
+            {
+                size_t n_cols      = std::min(panel_end - col, chunk_cols);
+                size_t contig_size = col_bytes * n_cols;
+                auto&  buf         = buffers[i_chunk];
+                auto   a_start     = (const char*)a + col * lda_bytes;
+                auto   b_start     = (char*)b + col * ldb_bytes;
+
+                if(set)
+                {
+                    // wait until the previous transfer out of this buffer has completed
+                    PRINT_IF_HIP_ERROR(hipEventSynchronize(buf.event));
+
+                    // host matrix -> pinned host buffer
+                    rocblas_copy_host_columns(
+                        col_bytes, n_cols, a_start, lda_bytes, buf.host, col_bytes);
+
+                    if(ldb == rows)
+                    {
+                        // pinned host buffer -> contiguous device matrix
+                        PRINT_IF_HIP_ERROR(hipMemcpyAsync(
+                            b_start, buf.host, contig_size, hipMemcpyHostToDevice, s));
+                    }
+                    else
+                    {
+                        // pinned host buffer -> device buffer -> non-contiguous device matrix
+                        PRINT_IF_HIP_ERROR(hipMemcpyAsync(
+                            buf.device, buf.host, contig_size, hipMemcpyHostToDevice, s));
+                        rocblas_copy_void_ptr_matrix(
+                            rows, n_cols, elem_size, buf.device, rows, b_start, ldb, s);
+                    }
+                }
+                else
+                {
+                    // the buffer is free once its previous chunk is unpacked
+                    unpack(i_chunk);
+
+                    if(lda == rows)
+                    {
+                        // contiguous device matrix -> pinned host buffer
+                        PRINT_IF_HIP_ERROR(hipMemcpyAsync(
+                            buf.host, a_start, contig_size, hipMemcpyDeviceToHost, s));
+                    }
+                    else
+                    {
+                        // non-contiguous device matrix -> device buffer -> pinned host buffer
+                        rocblas_copy_void_ptr_matrix(
+                            rows, n_cols, elem_size, a_start, lda, buf.device, rows, s);
+                        PRINT_IF_HIP_ERROR(hipMemcpyAsync(
+                            buf.host, buf.device, contig_size, hipMemcpyDeviceToHost, s));
+                    }
+                    waiting[i_chunk % N_STREAMS] = {b_start, n_cols};
+                }
+                PRINT_IF_HIP_ERROR(hipEventRecord(buf.event, s));
+            }
+            if(panel_events)
+                PRINT_IF_HIP_ERROR(hipEventRecord(panel_events[p], s));
+        }
+
+        // unpack the last chunks
+        for(size_t i = 0; i < N_STREAMS; i++)
+            unpack(i_chunk + i);
+    }
 
-using rocblas_unique_ptr = std::unique_ptr<void, void (*)(void*)>;
+    // stream continues after every panel has arrived
+    for(size_t s = 0; s < n_rings; s++)
+    {
+        PRINT_IF_HIP_ERROR(hipEventRecord(events[1 + s], ring[s]));
+        PRINT_IF_HIP_ERROR(hipStreamWaitEvent(stream, events[1 + s], 0));
+    }
+    destroy_events();
+    return rocblas_status_success;
+}
 
 /*******************************************************************************
  *! \brief   copies void* vector x with stride incx on host to void* vector
      y with stride incy on device. Vectors have n elements of size elem_size.
-  TODO: Need to replace device memory allocation with new system
  ******************************************************************************/
 extern "C" rocblas_status rocblas_set_vector(rocblas_int n,
                                              rocblas_int elem_size,
@@ -285,105 +1210,21 @@ try
 
     if(incx == 1 && incy == 1) // contiguous host vector -> contiguous device vector
     {
-        PRINT_IF_HIP_ERROR(hipMemcpy(y_d, x_h, elem_size * n, hipMemcpyHostToDevice));
+        PRINT_IF_HIP_ERROR(hipMemcpy(y_d, x_h, size_t(elem_size) * n, hipMemcpyHostToDevice));
+    }
+    else if(elem_size > rocblas_staging_pool::BUFF_BYTES) // element too large for buffer
+    {
+        PRINT_IF_HIP_ERROR(hipMemcpy2D(y_d,
+                                       size_t(elem_size) * incy,
+                                       x_h,
+                                       size_t(elem_size) * incx,
+                                       elem_size,
+                                       n,
+                                       hipMemcpyHostToDevice));
     }
     else // either non-contiguous host vector or non-contiguous device vector
     {
-        size_t bytes_to_copy = static_cast<size_t>(elem_size) * static_cast<size_t>(n);
-        size_t temp_byte_size
-            = bytes_to_copy < VEC_BUFF_MAX_BYTES ? bytes_to_copy : VEC_BUFF_MAX_BYTES;
-        int n_elem = temp_byte_size / elem_size; // number of elements in buffer
-        int n_copy = ((n - 1) / n_elem) + 1; // number of times buffer is copied
-
-        int  blocks = (n_elem - 1) / NB_X + 1; // parameters for device kernel
-        dim3 grid(blocks);
-        dim3 threads(NB_X);
-
-        size_t x_h_byte_stride = (size_t)elem_size * incx;
-        size_t y_d_byte_stride = (size_t)elem_size * incy;
-        size_t t_h_byte_stride = (size_t)elem_size;
-
-        for(int i_copy = 0; i_copy < n_copy; i_copy++)
-        {
-            int         i_start     = i_copy * n_elem;
-            int         n_elem_max  = n - i_start < n_elem ? n - i_start : n_elem;
-            int         contig_size = n_elem_max * elem_size;
-            void*       y_d_start   = (char*)y_d + i_start * y_d_byte_stride;
-            const void* x_h_start   = (const char*)x_h + i_start * x_h_byte_stride;
-
-            if((incx != 1) && (incy != 1))
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous host vector -> host buffer
-                for(size_t i_b = 0, i_x = i_start; i_b < n_elem_max; i_b++, i_x++)
-                {
-                    memcpy((char*)t_h + i_b * t_h_byte_stride,
-                           (const char*)x_h + i_x * x_h_byte_stride,
-                           elem_size);
-                }
-                // host buffer -> device buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_d, t_h, contig_size, hipMemcpyHostToDevice));
-                // device buffer -> non-contiguous device vector
-                hipLaunchKernelGGL(rocblas_copy_void_ptr_vector_kernel,
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   n_elem_max,
-                                   elem_size,
-                                   t_d,
-                                   1,
-                                   y_d_start,
-                                   incy);
-            }
-            else if(incx == 1 && incy != 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // contiguous host vector -> device buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_d, x_h_start, contig_size, hipMemcpyHostToDevice));
-                // device buffer -> non-contiguous device vector
-                hipLaunchKernelGGL(rocblas_copy_void_ptr_vector_kernel,
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   n_elem_max,
-                                   elem_size,
-                                   t_d,
-                                   1,
-                                   y_d_start,
-                                   incy);
-            }
-            else if(incx != 1 && incy == 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                // non-contiguous host vector -> host buffer
-                for(size_t i_b = 0, i_x = i_start; i_b < n_elem_max; i_b++, i_x++)
-                {
-                    memcpy((char*)t_h + i_b * t_h_byte_stride,
-                           (const char*)x_h + i_x * x_h_byte_stride,
-                           elem_size);
-                }
-                // host buffer -> contiguous device vector
-                PRINT_IF_HIP_ERROR(hipMemcpy(y_d_start, t_h, contig_size, hipMemcpyHostToDevice));
-            }
-        }
+        return rocblas_staged_set_matrix(1, n, elem_size, x_h, incx, y_d, incy);
     }
     return rocblas_status_success;
 }
@@ -413,106 +1254,21 @@ try
 
     if(incx == 1 && incy == 1) // congiguous device vector -> congiguous host vector
     {
-        PRINT_IF_HIP_ERROR(hipMemcpy(y_h, x_d, elem_size * n, hipMemcpyDeviceToHost));
+        PRINT_IF_HIP_ERROR(hipMemcpy(y_h, x_d, size_t(elem_size) * n, hipMemcpyDeviceToHost));
+    }
+    else if(elem_size > rocblas_staging_pool::BUFF_BYTES) // element too large for buffer
+    {
+        PRINT_IF_HIP_ERROR(hipMemcpy2D(y_h,
+                                       size_t(elem_size) * incy,
+                                       x_d,
+                                       size_t(elem_size) * incx,
+                                       elem_size,
+                                       n,
+                                       hipMemcpyDeviceToHost));
     }
     else // either device or host vector is non-contiguous
     {
-        size_t bytes_to_copy = static_cast<size_t>(elem_size) * static_cast<size_t>(n);
-        size_t temp_byte_size
-            = bytes_to_copy < VEC_BUFF_MAX_BYTES ? bytes_to_copy : VEC_BUFF_MAX_BYTES;
-        int n_elem = temp_byte_size / elem_size; // number elements in buffer
-        int n_copy = ((n - 1) / n_elem) + 1; // number of times buffer is copied
-
-        int  blocks = (n_elem - 1) / NB_X + 1; // parameters for device kernel
-        dim3 grid(blocks);
-        dim3 threads(NB_X);
-
-        size_t x_d_byte_stride = (size_t)elem_size * incx;
-        size_t y_h_byte_stride = (size_t)elem_size * incy;
-        size_t t_h_byte_stride = (size_t)elem_size;
-
-        for(int i_copy = 0; i_copy < n_copy; i_copy++)
-        {
-            int i_start           = i_copy * n_elem;
-            int n_elem_max        = n - (n_elem * i_copy) < n_elem ? n - (n_elem * i_copy) : n_elem;
-            int contig_size       = elem_size * n_elem_max;
-            const void* x_d_start = (const char*)x_d + i_start * x_d_byte_stride;
-            void*       y_h_start = (char*)y_h + i_start * y_h_byte_stride;
-
-            if(incx != 1 && incy != 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous device vector -> device buffer
-                hipLaunchKernelGGL(rocblas_copy_void_ptr_vector_kernel,
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   n_elem_max,
-                                   elem_size,
-                                   x_d_start,
-                                   incx,
-                                   t_d,
-                                   1);
-                // device buffer -> host buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_h, t_d, contig_size, hipMemcpyDeviceToHost));
-                // host buffer -> non-contiguous host vector
-                for(size_t i_b = 0, i_y = i_start; i_b < n_elem_max; i_b++, i_y++)
-                {
-                    memcpy((char*)y_h + i_y * y_h_byte_stride,
-                           (const char*)t_h + i_b * t_h_byte_stride,
-                           elem_size);
-                }
-            }
-            else if(incx == 1 && incy != 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                // congiguous device vector -> host buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_h, x_d_start, contig_size, hipMemcpyDeviceToHost));
-
-                // host buffer -> non-contiguous host vector
-                for(size_t i_b = 0, i_y = i_start; i_b < n_elem_max; i_b++, i_y++)
-                {
-                    memcpy((char*)y_h + i_y * y_h_byte_stride,
-                           (const char*)t_h + i_b * t_h_byte_stride,
-                           elem_size);
-                }
-            }
-            else if(incx != 1 && incy == 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous device vector -> device buffer
-                hipLaunchKernelGGL(rocblas_copy_void_ptr_vector_kernel,
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   n_elem_max,
-                                   elem_size,
-                                   x_d_start,
-                                   incx,
-                                   t_d,
-                                   1);
-                // device buffer -> contiguous host vector
-                PRINT_IF_HIP_ERROR(hipMemcpy(y_h_start, t_d, contig_size, hipMemcpyDeviceToHost));
-            }
-        }
+        return rocblas_staged_get_matrix(1, n, elem_size, x_d, incx, y_h, incy);
     }
     return rocblas_status_success;
 }
@@ -607,32 +1363,6 @@ catch(...) // catch all exceptions
     return exception_to_rocblas_status();
 }
 
-/*******************************************************************************
- *! \brief  Matrix copy on device. Matrices are void pointers with element
-     size elem_size
- ******************************************************************************/
-
-constexpr size_t      MAT_BUFF_MAX_BYTES = 1048576;
-constexpr rocblas_int MATRIX_DIM_X       = 128;
-constexpr rocblas_int MATRIX_DIM_Y       = 8;
-
-ROCBLAS_KERNEL void rocblas_copy_void_ptr_matrix_kernel(rocblas_int rows,
-                                                        rocblas_int cols,
-                                                        size_t      elem_size,
-                                                        const void* a,
-                                                        rocblas_int lda,
-                                                        void*       b,
-                                                        rocblas_int ldb)
-{
-    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
-
-    if(tx < rows && ty < cols)
-        memcpy((char*)b + (tx + ldb * ty) * elem_size,
-               (const char*)a + (tx + lda * ty) * elem_size,
-               elem_size);
-}
-
 /*******************************************************************************
  *! \brief   copies void* matrix a_h with leading dimentsion lda on host to
      void* matrix b_d with leading dimension ldb on device. Matrices have
@@ -663,7 +1393,7 @@ try
         PRINT_IF_HIP_ERROR(hipMemcpy(b_d, a_h, bytes_to_copy, hipMemcpyHostToDevice));
     }
     // matrix colums too large to fit in temp buffer, copy matrix col by col
-    else if(rows * elem_size > MAT_BUFF_MAX_BYTES)
+    else if(size_t(rows) * elem_size > rocblas_staging_pool::BUFF_BYTES)
     {
         for(size_t i = 0; i < cols; i++)
         {
@@ -677,105 +1407,7 @@ try
     // columns
     else
     {
-        size_t bytes_to_copy = static_cast<size_t>(elem_size) * static_cast<size_t>(rows)
-                               * static_cast<size_t>(cols);
-        size_t temp_byte_size
-            = bytes_to_copy < MAT_BUFF_MAX_BYTES ? bytes_to_copy : MAT_BUFF_MAX_BYTES;
-        int n_cols = temp_byte_size / (elem_size * rows); // number of columns in buffer
-        int n_copy = ((cols - 1) / n_cols) + 1; // number of times buffer is copied
-
-        rocblas_int blocksX = ((rows - 1) / MATRIX_DIM_X) + 1; // parameters for device kernel
-        rocblas_int blocksY = ((n_cols - 1) / MATRIX_DIM_Y) + 1;
-        dim3        grid(blocksX, blocksY);
-        dim3        threads(MATRIX_DIM_X, MATRIX_DIM_Y);
-
-        size_t lda_h_byte = (size_t)elem_size * lda;
-        size_t ldb_d_byte = (size_t)elem_size * ldb;
-        size_t ldt_h_byte = (size_t)elem_size * rows;
-
-        for(int i_copy = 0; i_copy < n_copy; i_copy++)
-        {
-            size_t      i_start     = i_copy * n_cols;
-            int         n_cols_max  = cols - i_start < n_cols ? cols - i_start : n_cols;
-            int         contig_size = elem_size * rows * n_cols_max;
-            void*       b_d_start   = (char*)b_d + i_start * ldb_d_byte;
-            const void* a_h_start   = (const char*)a_h + i_start * lda_h_byte;
-
-            if((lda != rows) && (ldb != rows))
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous host matrix -> host buffer
-                for(size_t i_t = 0, i_a = i_start; i_t < n_cols_max; i_t++, i_a++)
-                {
-                    memcpy((char*)t_h + i_t * ldt_h_byte,
-                           (const char*)a_h + i_a * lda_h_byte,
-                           ldt_h_byte);
-                }
-                // host buffer -> device buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_d, t_h, contig_size, hipMemcpyHostToDevice));
-                // device buffer -> non-contiguous device matrix
-                hipLaunchKernelGGL(rocblas_copy_void_ptr_matrix_kernel,
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   rows,
-                                   n_cols_max,
-                                   elem_size,
-                                   t_d,
-                                   rows,
-                                   b_d_start,
-                                   ldb);
-            }
-            else if(lda == rows && ldb != rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // contiguous host matrix -> device buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_d, a_h_start, contig_size, hipMemcpyHostToDevice));
-                // device buffer -> non-contiguous device matrix
-                hipLaunchKernelGGL(rocblas_copy_void_ptr_matrix_kernel,
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   rows,
-                                   n_cols_max,
-                                   elem_size,
-                                   t_d,
-                                   rows,
-                                   b_d_start,
-                                   ldb);
-            }
-            else if(lda != rows && ldb == rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                // non-contiguous host matrix -> host buffer
-                for(size_t i_t = 0, i_a = i_start; i_t < n_cols_max; i_t++, i_a++)
-                {
-                    memcpy((char*)t_h + i_t * ldt_h_byte,
-                           (const char*)a_h + i_a * lda_h_byte,
-                           ldt_h_byte);
-                }
-                // host buffer -> contiguous device matrix
-                PRINT_IF_HIP_ERROR(hipMemcpy(b_d_start, t_h, contig_size, hipMemcpyHostToDevice));
-            }
-        }
+        return rocblas_staged_set_matrix(rows, cols, elem_size, a_h, lda, b_d, ldb);
     }
     return rocblas_status_success;
 }
@@ -813,7 +1445,7 @@ try
         PRINT_IF_HIP_ERROR(hipMemcpy(b_h, a_d, bytes_to_copy, hipMemcpyDeviceToHost));
     }
     // columns too large for temp buffer, hipMemcpy column by column
-    else if(rows * elem_size > MAT_BUFF_MAX_BYTES)
+    else if(size_t(rows) * elem_size > rocblas_staging_pool::BUFF_BYTES)
     {
         for(size_t i = 0; i < cols; i++)
         {
@@ -827,103 +1459,7 @@ try
     // columns
     else
     {
-        size_t bytes_to_copy = elem_size * static_cast<size_t>(rows) * cols;
-        size_t temp_byte_size
-            = bytes_to_copy < MAT_BUFF_MAX_BYTES ? bytes_to_copy : MAT_BUFF_MAX_BYTES;
-        int n_cols = temp_byte_size / (elem_size * rows); // number of columns in buffer
-        int n_copy = ((cols - 1) / n_cols) + 1; // number times buffer copied
-
-        rocblas_int blocksX = ((rows - 1) / MATRIX_DIM_X) + 1; // parameters for device kernel
-        rocblas_int blocksY = ((n_cols - 1) / MATRIX_DIM_Y) + 1;
-        dim3        grid(blocksX, blocksY);
-        dim3        threads(MATRIX_DIM_X, MATRIX_DIM_Y);
-
-        size_t lda_d_byte = (size_t)elem_size * lda;
-        size_t ldb_h_byte = (size_t)elem_size * ldb;
-        size_t ldt_h_byte = (size_t)elem_size * rows;
-
-        for(int i_copy = 0; i_copy < n_copy; i_copy++)
-        {
-            int         i_start     = i_copy * n_cols;
-            int         n_cols_max  = cols - i_start < n_cols ? cols - i_start : n_cols;
-            size_t      contig_size = elem_size * (size_t)rows * n_cols_max;
-            const void* a_d_start   = (const char*)a_d + i_start * lda_d_byte;
-            void*       b_h_start   = (char*)b_h + i_start * ldb_h_byte;
-            if(lda != rows && ldb != rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous device matrix -> device buffer
-                hipLaunchKernelGGL(rocblas_copy_void_ptr_matrix_kernel,
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   rows,
-                                   n_cols_max,
-                                   elem_size,
-                                   a_d_start,
-                                   lda,
-                                   t_d,
-                                   rows);
-                // device buffer -> host buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_h, t_d, contig_size, hipMemcpyDeviceToHost));
-                // host buffer -> non-contiguous host matrix
-                for(size_t i_t = 0, i_b = i_start; i_t < n_cols_max; i_t++, i_b++)
-                {
-                    memcpy((char*)b_h + i_b * ldb_h_byte,
-                           (const char*)t_h + i_t * ldt_h_byte,
-                           ldt_h_byte);
-                }
-            }
-            else if(lda == rows && ldb != rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                // congiguous device matrix -> host buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_h, a_d_start, contig_size, hipMemcpyDeviceToHost));
-                // host buffer -> non-contiguous host matrix
-                for(size_t i_t = 0, i_b = i_start; i_t < n_cols_max; i_t++, i_b++)
-                {
-                    memcpy((char*)b_h + i_b * ldb_h_byte,
-                           (const char*)t_h + i_t * ldt_h_byte,
-                           ldt_h_byte);
-                }
-            }
-            else if(lda != rows && ldb == rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous device matrix -> device buffer
-                hipLaunchKernelGGL(rocblas_copy_void_ptr_matrix_kernel,
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   rows,
-                                   n_cols_max,
-                                   elem_size,
-                                   a_d_start,
-                                   lda,
-                                   t_d,
-                                   rows);
-                // device temp buffer -> contiguous host matrix
-                PRINT_IF_HIP_ERROR(hipMemcpy(b_h_start, t_d, contig_size, hipMemcpyDeviceToHost));
-            }
-        }
+        return rocblas_staged_get_matrix(rows, cols, elem_size, a_d, lda, b_h, ldb);
     }
     return rocblas_status_success;
 }
@@ -1027,6 +1563,90 @@ catch(...) // catch all exceptions
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ *! \brief   copies void* matrix a_h with leading dimension lda on host to
+     void* matrix b_d with leading dimension ldb on device in panels of
+     panel_cols columns, recording panel_events[i] when panel i has arrived.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_matrix_async_panels(rocblas_int rows,
+                                                          rocblas_int cols,
+                                                          rocblas_int elem_size,
+                                                          const void* a_h,
+                                                          rocblas_int lda,
+                                                          void*       b_d,
+                                                          rocblas_int ldb,
+                                                          rocblas_int panel_cols,
+                                                          hipEvent_t* panel_events,
+                                                          hipStream_t stream)
+try
+{
+    if(rows == 0 || cols == 0) // quick return
+        return rocblas_status_success;
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || rows > lda || rows > ldb || elem_size <= 0
+       || panel_cols <= 0)
+        return rocblas_status_invalid_size;
+    if(!a_h || !b_d)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_matrix_async_panels(hipMemcpyHostToDevice,
+                                       rows,
+                                       cols,
+                                       elem_size,
+                                       a_h,
+                                       lda,
+                                       b_d,
+                                       ldb,
+                                       panel_cols,
+                                       panel_events,
+                                       stream);
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   copies void* matrix a_d with leading dimension lda on device to
+     void* matrix b_h with leading dimension ldb on host in panels of
+     panel_cols columns, recording panel_events[i] when panel i has been read.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_matrix_async_panels(rocblas_int rows,
+                                                          rocblas_int cols,
+                                                          rocblas_int elem_size,
+                                                          const void* a_d,
+                                                          rocblas_int lda,
+                                                          void*       b_h,
+                                                          rocblas_int ldb,
+                                                          rocblas_int panel_cols,
+                                                          hipEvent_t* panel_events,
+                                                          hipStream_t stream)
+try
+{
+    if(rows == 0 || cols == 0) // quick return
+        return rocblas_status_success;
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || rows > lda || rows > ldb || elem_size <= 0
+       || panel_cols <= 0)
+        return rocblas_status_invalid_size;
+    if(!a_d || !b_h)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_matrix_async_panels(hipMemcpyDeviceToHost,
+                                       rows,
+                                       cols,
+                                       elem_size,
+                                       a_d,
+                                       lda,
+                                       b_h,
+                                       ldb,
+                                       panel_cols,
+                                       panel_events,
+                                       stream);
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
 // Convert rocblas_status to string
 extern "C" const char* rocblas_status_to_string(rocblas_status status)
 {
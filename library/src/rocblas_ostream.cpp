@@ -6,7 +6,9 @@
 static void rocblas_abort_once [[noreturn]] ();
 
 #include "rocblas_ostream.hpp"
+#include <algorithm>
 #include <csignal>
+#include <cstring>
 #include <fcntl.h>
 #include <iostream>
 #include <type_traits>
@@ -177,6 +179,12 @@ void rocblas_internal_ostream::flush()
 void rocblas_internal_ostream::clear_workers()
 {
     std::lock_guard<std::recursive_mutex> lock(worker_map_mutex());
+
+    // Write any pending asynchronous messages, even for workers which are still referenced
+    for(auto& entry : worker_map())
+        if(entry.second)
+            entry.second->drain();
+
     worker_map().clear();
 }
 
@@ -199,6 +207,26 @@ std::ostream& rocblas_internal_ostream::yaml_off(std::ostream& os)
 // Empty strings tell the worker thread to exit
 void rocblas_internal_ostream::worker::send(std::string str)
 {
+    // In asynchronous mode, queue the message and return without waiting for it
+    if(policy != async_policy::sync)
+    {
+        if(policy == async_policy::block)
+        {
+            while(!async_push(str))
+            {
+                async_wake();
+                std::this_thread::yield();
+            }
+        }
+        else if(!async_push(str))
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        async_wake();
+        return;
+    }
+
     // Create a promise to wait for the operation to complete
     std::promise<void> promise;
 
@@ -280,6 +308,169 @@ void rocblas_internal_ostream::worker::thread_function()
     }
 }
 
+/***********************************************************************
+ * Asynchronous mode                                                   *
+ ***********************************************************************/
+
+// Maximum number of bytes coalesced into a single write
+static constexpr size_t async_batch_bytes = 1 << 18;
+
+// Default number of messages in the ring
+static constexpr size_t async_default_queue_size = 4096;
+
+// How long the worker thread sleeps before checking the ring again
+static constexpr auto async_poll_interval = std::chrono::milliseconds(10);
+
+// Read the asynchronous mode settings from the environment
+// ROCBLAS_LOG_ASYNC=block (or 1) waits when the ring is full, ROCBLAS_LOG_ASYNC=drop discards
+void rocblas_internal_ostream::worker::init_async()
+{
+    const char* mode = getenv("ROCBLAS_LOG_ASYNC");
+    if(!mode || !*mode || !strcmp(mode, "0"))
+        return;
+
+    policy = !strcmp(mode, "drop") ? async_policy::drop : async_policy::block;
+
+    size_t      size     = async_default_queue_size;
+    const char* size_env = getenv("ROCBLAS_LOG_ASYNC_QUEUE_SIZE");
+    if(size_env && *size_env)
+        size = std::max<size_t>(strtoull(size_env, nullptr, 0), 2);
+
+    // Round up to a power of 2 so that positions can be masked
+    size_t capacity = 2;
+    while(capacity < size)
+        capacity *= 2;
+
+    ring.reset(new async_cell[capacity]);
+    ring_mask = capacity - 1;
+    for(size_t i = 0; i < capacity; ++i)
+        ring[i].seq.store(i, std::memory_order_relaxed);
+}
+
+// Bounded multi-producer queue: a producer claims a position and then publishes the slot
+bool rocblas_internal_ostream::worker::async_push(std::string& str)
+{
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    while(true)
+    {
+        async_cell& cell = ring[pos & ring_mask];
+        size_t      seq  = cell.seq.load(std::memory_order_acquire);
+        auto        diff = static_cast<ptrdiff_t>(seq - pos);
+        if(!diff)
+        {
+            if(enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.str = std::move(str);
+                cell.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if(diff < 0)
+            return false; // Full
+        else
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+    }
+}
+
+// Only the worker thread pops, so dequeue_pos needs no compare-exchange
+bool rocblas_internal_ostream::worker::async_pop(std::string& str)
+{
+    size_t      pos  = dequeue_pos.load(std::memory_order_relaxed);
+    async_cell& cell = ring[pos & ring_mask];
+    if(cell.seq.load(std::memory_order_acquire) != pos + 1)
+        return false; // Empty, or the producer has not published the slot yet
+
+    str = std::move(cell.str);
+    cell.str.clear();
+    cell.seq.store(pos + ring_mask + 1, std::memory_order_release);
+    dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+    return true;
+}
+
+// Producers only take the mutex when the worker thread is sleeping
+void rocblas_internal_ostream::worker::async_wake()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(sleeping.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cond.notify_one();
+    }
+}
+
+// Worker thread which writes batches of messages from the ring
+void rocblas_internal_ostream::worker::async_thread_function()
+{
+    // Clear any errors in the FILE
+    clearerr(file);
+
+    std::string batch, str;
+    bool        error = false;
+
+    while(true)
+    {
+        // Messages pushed before done was set are guaranteed to be visible below
+        bool finish = done.load(std::memory_order_acquire);
+
+        // Coalesce as many messages as are ready into one buffer
+        batch.clear();
+        while(batch.size() < async_batch_bytes && async_pop(str))
+            batch += str;
+
+        if(batch.size())
+        {
+            // Write the batch with a single write, unless an earlier write failed
+            if(!error)
+            {
+                fwrite(batch.data(), 1, batch.size(), file);
+
+                // Detect any error and flush the C FILE stream
+                if(ferror(file) || fflush(file))
+                {
+                    perror("Error writing log file");
+                    error = true;
+                }
+            }
+
+            // Publish progress to drain()
+            std::lock_guard<std::mutex> lock(mutex);
+            write_pos.store(dequeue_pos.load(std::memory_order_relaxed),
+                            std::memory_order_release);
+            drained.notify_all();
+        }
+        else if(finish)
+        {
+            break;
+        }
+        else
+        {
+            // Sleep until a producer wakes us, rechecking the ring after announcing it
+            std::unique_lock<std::mutex> lock(mutex);
+            sleeping.store(true);
+            size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+            if(ring[pos & ring_mask].seq.load() != pos + 1 && !done.load())
+                cond.wait_for(lock, async_poll_interval);
+            sleeping.store(false);
+        }
+    }
+
+    // Tell the destructor that all messages have been written
+    exited.set_value();
+}
+
+// Wait until every message sent so far has been written
+void rocblas_internal_ostream::worker::drain()
+{
+    // Synchronous sends have already been written
+    if(policy == async_policy::sync)
+        return;
+
+    size_t                       target = enqueue_pos.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.notify_one();
+    drained.wait(lock, [&] { return write_pos.load(std::memory_order_acquire) >= target; });
+}
+
 // Constructor creates a worker thread from a file descriptor
 rocblas_internal_ostream::worker::worker(int fd)
 {
@@ -297,8 +488,14 @@ rocblas_internal_ostream::worker::worker(int fd)
         rocblas_abort();
     }
 
+    // Read the asynchronous mode settings
+    init_async();
+
     // Create a worker thread, capturing *this
-    thread = std::thread([=] { thread_function(); });
+    if(policy == async_policy::sync)
+        thread = std::thread([=] { thread_function(); });
+    else
+        thread = std::thread([=] { async_thread_function(); });
 
     // Detatch from the worker thread
     thread.detach();
@@ -306,8 +503,31 @@ rocblas_internal_ostream::worker::worker(int fd)
 
 rocblas_internal_ostream::worker::~worker()
 {
-    // Tell worker thread to exit, by sending it an empty string
-    send({});
+    if(policy == async_policy::sync)
+    {
+        // Tell worker thread to exit, by sending it an empty string
+        send({});
+    }
+    else
+    {
+        // No producers remain, so tell the worker thread to drain the ring and exit
+        auto future = exited.get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.store(true, std::memory_order_release);
+            cond.notify_one();
+        }
+#ifdef WIN32
+        future.wait_for(std::chrono::seconds(1));
+#else
+        future.get();
+#endif
+        if(size_t count = dropped.load())
+            fprintf(stderr,
+                    "rocBLAS warning: %zu log messages were dropped because the "
+                    "ROCBLAS_LOG_ASYNC queue was full\n",
+                    count);
+    }
 
     // Close the FILE
     if(file)
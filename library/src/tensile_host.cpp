@@ -13,6 +13,30 @@ extern "C" void rocblas_shutdown();
 // In the old Tensile client, rocblas_initialize() is a no-op
 extern "C" void rocblas_initialize() {}
 
+// In the old Tensile client, there is no solution cache
+extern "C" rocblas_status
+    rocblas_get_solution_cache_stats(rocblas_handle handle, size_t* hits, size_t* misses)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!hits || !misses)
+        return rocblas_status_invalid_pointer;
+    *hits = *misses = 0;
+    return rocblas_status_success;
+}
+
+// In the old Tensile client, there is no tuning database
+extern "C" rocblas_status
+    rocblas_get_tuning_db_stats(rocblas_handle handle, size_t* entries, size_t* hits)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!entries || !hits)
+        return rocblas_status_invalid_pointer;
+    *entries = *hits = 0;
+    return rocblas_status_success;
+}
+
 #else
 
 /*****************************************************************************
@@ -21,6 +45,7 @@ extern "C" void rocblas_initialize() {}
  *****************************************************************************/
 
 #include "tensile_host.hpp"
+#include "tuning_db.hpp"
 //#include <Tensile/AMDGPU.hpp>
 #include <Tensile/Contractions.hpp>
 #include <Tensile/EmbeddedLibrary.hpp>
@@ -31,14 +56,20 @@ extern "C" void rocblas_initialize() {}
 #include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/hip/HipUtils.hpp>
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <complex>
+#include <cstring>
 #include <exception>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #ifdef WIN32
@@ -50,8 +81,12 @@ extern "C" void rocblas_initialize() {}
 #define ROCBLAS_LIB_PATH "C:/hipSDK/rocblas/bin"
 #else
 #include <dlfcn.h>
+#include <elf.h>
+#include <fcntl.h>
 #include <glob.h>
 #include <libgen.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #define ROCBLAS_LIB_PATH "/opt/rocm/rocblas/lib"
 #endif
@@ -206,6 +241,35 @@ namespace
         }
     };
 
+    /*******************************************************************
+     * Size of GSU workspace. We set it to max size_t if this is a size *
+     * query, otherwise we round the handle's workspace size down.      *
+     *******************************************************************/
+    size_t GetTensileWorkspaceSize(rocblas_handle handle)
+    {
+        return handle->is_device_memory_size_query()
+                   ? ~size_t{0}
+                   : (handle->gsu_workspace_size / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
+                         * HPA_GSU_WORKSPACE_SIZE_GRANULARITY;
+    }
+
+    /*********************************************************************
+     * The restriction of alpha in a Tensile Problem. It is made after    *
+     * alpha is converted to Tensile's type, so that e.g. a float alpha  *
+     * which rounds to a half 1 for HPA half restricts solutions to 1.   *
+     * If k==0, we do not need to dereference prob.alpha, and alpha = 0. *
+     *********************************************************************/
+    template <typename Ti, typename To, typename Tc>
+    auto GetTensileAlphaRestriction(const RocblasContractionProblem<Ti, To, Tc>& prob)
+    {
+        typename AlphaBeta<Ti, To, Tc>::tensile_type tensileAlpha;
+        if(prob.k)
+            AlphaBeta<Ti, To, Tc>::copy(&tensileAlpha, prob.alpha);
+        else
+            memset(&tensileAlpha, 0, sizeof(tensileAlpha));
+        return Tensile::toScalarValueEnum(tensileAlpha);
+    }
+
     /****************************************************************
      * Construct a Tensile Problem from a RocblasContractionProblem *
      ****************************************************************/
@@ -311,12 +375,8 @@ namespace
                                     {prob.row_stride_d, prob.col_stride_d, prob.batch_stride_d},
                                     prob.buffer_offset_d};
 
-        // Size of GSU workspace. We set it to max size_t if this is a size query.
-        size_t workspace_size
-            = prob.handle->is_device_memory_size_query()
-                  ? ~size_t{0}
-                  : (prob.handle->gsu_workspace_size / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
-                        * HPA_GSU_WORKSPACE_SIZE_GRANULARITY;
+        // Size of GSU workspace
+        size_t workspace_size = GetTensileWorkspaceSize(prob.handle);
 
         // The ContractionProblem
         Tensile::ContractionProblem tensileProblem{a,
@@ -368,14 +428,7 @@ namespace
 
         // alpha and beta are stored by value in Tensile::TypedContractionInputs
         // alpha and beta are copied from host to Tensile::TypedContractionInputs
-        // If k==0, we do not need to dereference prob.alpha and can set tensileAlpha=0
-        // Not positive if this is necessary here as well
-        typename AlphaBeta<Ti, To, Tc>::tensile_type tensileAlpha;
-        if(prob.k)
-            AlphaBeta<Ti, To, Tc>::copy(&tensileAlpha, prob.alpha);
-        else
-            memset(&tensileAlpha, 0, sizeof(tensileAlpha));
-        tensileProblem.setAlphaRestriction(Tensile::toScalarValueEnum(tensileAlpha));
+        tensileProblem.setAlphaRestriction(GetTensileAlphaRestriction(prob));
 
         // Add problem predicates for CEqualsD
         tensileProblem.setCEqualsD(prob.C == prob.D);
@@ -438,6 +491,494 @@ namespace
         return inputs;
     }
 
+    /*****************************************************************************
+     * SolutionCacheKey captures every property of a RocblasContractionProblem   *
+     * which can influence Tensile's solution selection, independent of the      *
+     * pointers. It is packed into machine words so that it can be compared with *
+     * relaxed atomic loads by the lock-free SolutionCache readers below.        *
+     *****************************************************************************/
+    struct SolutionCacheKey
+    {
+        static constexpr size_t NUM_WORDS = 25;
+        uint64_t                words[NUM_WORDS];
+
+        uint64_t hash() const
+        {
+            // 64-bit FNV-1a over the words
+            uint64_t h = 0xcbf29ce484222325;
+            for(auto w : words)
+                h = (h ^ w) * 0x100000001b3;
+            return h;
+        }
+    };
+
+    template <typename Ti, typename To, typename Tc>
+    SolutionCacheKey MakeSolutionCacheKey(const RocblasContractionProblem<Ti, To, Tc>& prob,
+                                          size_t workspace_size)
+    {
+        // Same K as in ConstructTensileProblem(), where alpha==0 is optimized into K=0
+        size_t k = prob.k && *prob.alpha ? prob.k : 0;
+
+        rocblas_performance_metric metric;
+        rocblas_get_performance_metric(prob.handle, &metric);
+
+        // Small enumerations and boolean properties, packed into one word each
+        uint64_t types = uint64_t(tensile_datatype<Ti>) | uint64_t(tensile_datatype<To>) << 16
+                         | uint64_t(tensile_datatype<Tc>) << 32;
+        uint64_t modes = uint64_t(prob.trans_a) | uint64_t(prob.trans_b) << 8
+                         | uint64_t(prob.handle->atomics_mode) << 16 | uint64_t(metric) << 24
+                         | uint64_t(prob.strided_batch) << 32 | uint64_t(prob.C == prob.D) << 33;
+        // beta's category and alpha's restriction, as ConstructTensileProblem() passes them
+        uint64_t scalars = uint64_t(int64_t(value_category(*prob.beta)) + 1)
+                           | uint64_t(GetTensileAlphaRestriction(prob)) << 8;
+
+        return {{types,
+                 modes,
+                 uint64_t(prob.flags),
+                 scalars,
+                 prob.m,
+                 prob.n,
+                 k,
+                 prob.batch_count,
+                 workspace_size,
+                 prob.row_stride_a,
+                 prob.col_stride_a,
+                 prob.batch_stride_a,
+                 prob.buffer_offset_a,
+                 prob.row_stride_b,
+                 prob.col_stride_b,
+                 prob.batch_stride_b,
+                 prob.buffer_offset_b,
+                 prob.row_stride_c,
+                 prob.col_stride_c,
+                 prob.batch_stride_c,
+                 prob.buffer_offset_c,
+                 prob.row_stride_d,
+                 prob.col_stride_d,
+                 prob.batch_stride_d,
+                 prob.buffer_offset_d}};
+    }
+
+    /*******************************************************************************
+     * SolutionCache is a bounded, direct-mapped memo of findBestSolution() results *
+     * for one device. Each slot is protected by a sequence lock, so that lookups  *
+     * never block: a reader which races with a writer simply reports a miss.      *
+     * Insertions are serialized by a mutex, and only happen on misses.            *
+     *******************************************************************************/
+    class SolutionCache
+    {
+        struct slot_s
+        {
+            std::atomic<uint32_t>                       seq;
+            std::atomic<uint64_t>                       key[SolutionCacheKey::NUM_WORDS];
+            std::atomic<Tensile::ContractionSolution*> solution;
+        };
+
+        size_t                    m_size;
+        std::unique_ptr<slot_s[]> m_slots;
+        std::atomic<size_t>       m_hits{0};
+        std::atomic<size_t>       m_misses{0};
+        std::mutex                m_mutex;
+
+        // Solutions are owned by the library, which outlives the cache, but we
+        // keep references to the solutions we hand out to be safe
+        std::unordered_set<std::shared_ptr<Tensile::ContractionSolution>> m_owned;
+
+        // Default number of slots, which can be changed by the
+        // ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE environment variable (0 disables the cache)
+        static constexpr size_t DEFAULT_SIZE = 1024;
+
+        static size_t cache_size()
+        {
+            static const size_t size = [] {
+                const char* env = getenv("ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE");
+                return env ? size_t(strtoul(env, nullptr, 0)) : DEFAULT_SIZE;
+            }();
+            return size;
+        }
+
+    public:
+        SolutionCache()
+            : m_size(cache_size())
+            , m_slots(m_size ? new slot_s[m_size]() : nullptr)
+        {
+        }
+
+        // Return the cached solution for key, or nullptr on a miss
+        Tensile::ContractionSolution* find(const SolutionCacheKey& key)
+        {
+            if(m_size)
+            {
+                auto&    slot = m_slots[key.hash() % m_size];
+                uint32_t seq  = slot.seq.load(std::memory_order_acquire);
+                if(!(seq & 1))
+                {
+                    auto* solution = slot.solution.load(std::memory_order_relaxed);
+                    bool  match    = solution != nullptr;
+                    for(size_t i = 0; match && i < SolutionCacheKey::NUM_WORDS; ++i)
+                        match = slot.key[i].load(std::memory_order_relaxed) == key.words[i];
+
+                    // Make sure the slot was not modified while we were reading it
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if(match && slot.seq.load(std::memory_order_relaxed) == seq)
+                    {
+                        m_hits.fetch_add(1, std::memory_order_relaxed);
+                        return solution;
+                    }
+                }
+            }
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        // Insert a solution for key, replacing whatever occupies its slot
+        void insert(const SolutionCacheKey&                              key,
+                    const std::shared_ptr<Tensile::ContractionSolution>& solution)
+        {
+            if(!m_size || !solution)
+                return;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_owned.insert(solution);
+
+            auto&    slot = m_slots[key.hash() % m_size];
+            uint32_t seq  = slot.seq.load(std::memory_order_relaxed);
+
+            // An odd sequence number marks the slot as being written
+            slot.seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for(size_t i = 0; i < SolutionCacheKey::NUM_WORDS; ++i)
+                slot.key[i].store(key.words[i], std::memory_order_relaxed);
+            slot.solution.store(solution.get(), std::memory_order_relaxed);
+            slot.seq.store(seq + 2, std::memory_order_release);
+        }
+
+        size_t hits() const
+        {
+            return m_hits.load(std::memory_order_relaxed);
+        }
+
+        size_t misses() const
+        {
+            return m_misses.load(std::memory_order_relaxed);
+        }
+    };
+
+    /*****************************************************************************
+     * TuningDB holds the tuning database entries of one device, which give the  *
+     * solution to use for a problem instead of findBestSolution(). The entries  *
+     * are read from the file named by ROCBLAS_TENSILE_TUNING_DB when the device *
+     * is initialized, and are not modified afterwards, so readers need no lock. *
+     *****************************************************************************/
+    class TuningDB
+    {
+        rocblas_tuning_db   m_db;
+        std::atomic<size_t> m_hits{0};
+
+        // Return the solution index of the problem's entry, or -1 if it has none
+        template <typename Ti, typename To, typename Tc>
+        int32_t lookup(const RocblasContractionProblem<Ti, To, Tc>& prob) const
+        {
+            if(!m_db.size())
+                return -1;
+
+            // Packed int8x4 is named by its element type
+            constexpr bool int8x4 = std::is_same<Ti, rocblas_int8x4>{};
+
+            rocblas_tuning_db_key key{int8x4 ? "i8_r" : rocblas_precision_string<Ti>,
+                                      rocblas_precision_string<To>,
+                                      rocblas_precision_string<Tc>,
+                                      rocblas_transpose_letter(prob.trans_a),
+                                      rocblas_transpose_letter(prob.trans_b),
+                                      int64_t(prob.m),
+                                      int64_t(prob.n),
+                                      int64_t(prob.k),
+                                      int64_t(prob.batch_count),
+                                      int64_t(prob.col_stride_a),
+                                      int64_t(prob.col_stride_b),
+                                      int64_t(prob.col_stride_c),
+                                      int64_t(prob.col_stride_d)};
+
+            return m_db.find(key);
+        }
+
+    public:
+        void load(const std::string& arch)
+        {
+            const char* path = getenv("ROCBLAS_TENSILE_TUNING_DB");
+            if(!path || !*path)
+                return;
+
+            std::ifstream ifs(path);
+            if(!ifs)
+            {
+                rocblas_cerr << "\nrocBLAS warning: Cannot open tuning database " << path
+                             << std::endl;
+                return;
+            }
+
+            for(auto line : m_db.read(ifs, arch))
+                rocblas_cerr << "\nrocBLAS warning: Ignoring malformed tuning database entry at "
+                             << path << ":" << line << std::endl;
+        }
+
+        // Return the solution index for the problem, or -1 if it has no entry
+        template <typename Ti, typename To, typename Tc>
+        int32_t find(const RocblasContractionProblem<Ti, To, Tc>& prob)
+        {
+            int32_t index = lookup(prob);
+            if(index >= 0)
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        // Whether the problem has an entry, without counting it as a hit
+        template <typename Ti, typename To, typename Tc>
+        bool contains(const RocblasContractionProblem<Ti, To, Tc>& prob) const
+        {
+            return lookup(prob) >= 0;
+        }
+
+        size_t size() const
+        {
+            return m_db.size();
+        }
+
+        size_t hits() const
+        {
+            return m_hits.load(std::memory_order_relaxed);
+        }
+    };
+
+    /*****************************************************************************
+     * CodeObjectIndex maps kernel names to the code object files defining them, *
+     * so that a code object is only loaded when a selected solution launches    *
+     * one of its kernels. The files are memory-mapped to read the symbol tables *
+     * of their ELF images, including those inside clang offload bundles.        *
+     * Loading on demand only applies to implicit initialization: it is disabled *
+     * by setting ROCBLAS_TENSILE_LAZY_LOAD=0, and rocblas_initialize() loads    *
+     * every code object.                                                        *
+     *****************************************************************************/
+    class CodeObjectIndex
+    {
+        struct file_s
+        {
+            std::string       path;
+            std::atomic<bool> loaded{false};
+        };
+
+        // Files are only added before the adapter is published, so readers need no lock
+        std::vector<std::unique_ptr<file_s>>    m_files;
+        std::unordered_map<std::string, size_t> m_kernels;
+        std::atomic<size_t>                     m_num_loaded{0};
+        std::mutex                              m_mutex;
+
+#ifndef WIN32
+        // Read a little-endian 64-bit value at pos, advancing pos
+        static bool read_u64(const char* data, size_t size, size_t& pos, uint64_t& value)
+        {
+            if(size - pos < sizeof(value))
+                return false;
+            memcpy(&value, data + pos, sizeof(value));
+            pos += sizeof(value);
+            return true;
+        }
+
+        // Index the kernels of an ELF image, returning whether any were found
+        bool index_elf(size_t file, const char* data, size_t size)
+        {
+            Elf64_Ehdr ehdr;
+            if(size < sizeof(ehdr) || memcmp(data, ELFMAG, SELFMAG)
+               || data[EI_CLASS] != ELFCLASS64)
+                return false;
+            memcpy(&ehdr, data, sizeof(ehdr));
+            if(ehdr.e_shoff > size || ehdr.e_shentsize != sizeof(Elf64_Shdr)
+               || ehdr.e_shnum > (size - ehdr.e_shoff) / sizeof(Elf64_Shdr))
+                return false;
+
+            auto section = [&](size_t i) {
+                Elf64_Shdr shdr;
+                memcpy(&shdr, data + ehdr.e_shoff + i * sizeof(shdr), sizeof(shdr));
+                return shdr;
+            };
+
+            bool found = false;
+            for(size_t i = 0; i < ehdr.e_shnum; ++i)
+            {
+                Elf64_Shdr symtab = section(i);
+                if((symtab.sh_type != SHT_SYMTAB && symtab.sh_type != SHT_DYNSYM)
+                   || symtab.sh_link >= ehdr.e_shnum)
+                    continue;
+                Elf64_Shdr strtab = section(symtab.sh_link);
+                if(symtab.sh_offset > size || symtab.sh_size > size - symtab.sh_offset
+                   || strtab.sh_offset > size || strtab.sh_size > size - strtab.sh_offset)
+                    continue;
+
+                for(size_t off = 0; off + sizeof(Elf64_Sym) <= symtab.sh_size;
+                    off += sizeof(Elf64_Sym))
+                {
+                    Elf64_Sym sym;
+                    memcpy(&sym, data + symtab.sh_offset + off, sizeof(sym));
+                    if(sym.st_shndx == SHN_UNDEF || sym.st_name >= strtab.sh_size)
+                        continue;
+
+                    const char* name = data + strtab.sh_offset + sym.st_name;
+                    size_t      len  = strnlen(name, strtab.sh_size - sym.st_name);
+
+                    // Kernels have a <kernel>.kd descriptor, or are STT_AMDGPU_HSA_KERNEL (10)
+                    // symbols in older code objects; other functions are indexed harmlessly
+                    int type = ELF64_ST_TYPE(sym.st_info);
+                    if(len > 3 && !memcmp(name + len - 3, ".kd", 3))
+                        len -= 3;
+                    else if(type != STT_FUNC && type != 10)
+                        continue;
+
+                    if(len)
+                    {
+                        m_kernels.emplace(std::string(name, len), file);
+                        found = true;
+                    }
+                }
+            }
+            return found;
+        }
+
+        // Index the kernels of a code object, which may be a clang offload bundle of ELF images
+        bool index_image(size_t file, const char* data, size_t size)
+        {
+            static constexpr char bundle_magic[] = "__CLANG_OFFLOAD_BUNDLE__";
+            size_t                pos            = sizeof(bundle_magic) - 1;
+            if(size < pos || memcmp(data, bundle_magic, pos))
+                return index_elf(file, data, size);
+
+            uint64_t entries;
+            bool     found = false;
+            if(!read_u64(data, size, pos, entries))
+                return false;
+            for(uint64_t i = 0; i < entries; ++i)
+            {
+                uint64_t offset, bytes, triple_size;
+                if(!read_u64(data, size, pos, offset) || !read_u64(data, size, pos, bytes)
+                   || !read_u64(data, size, pos, triple_size) || triple_size > size - pos)
+                    return false;
+                pos += triple_size;
+                if(offset <= size && bytes <= size - offset
+                   && index_elf(file, data + offset, bytes))
+                    found = true;
+            }
+            return found;
+        }
+
+        // Memory-map a code object and index its kernels
+        bool index_file(size_t file, const std::string& path)
+        {
+            int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if(fd < 0)
+                return false;
+
+            bool        found = false;
+            struct stat st;
+            if(!fstat(fd, &st) && st.st_size > 0)
+            {
+                size_t size = st.st_size;
+                void*  data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(data != MAP_FAILED)
+                {
+                    found = index_image(file, static_cast<const char*>(data), size);
+                    munmap(data, size);
+                }
+            }
+            close(fd);
+            return found;
+        }
+#endif
+
+        void load(Tensile::hip::SolutionAdapter& adapter, file_s& file)
+        {
+            adapter.loadCodeObjectFile(file.path.c_str());
+            file.loaded.store(true, std::memory_order_release);
+            m_num_loaded.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Load the code objects which are not loaded yet; m_mutex must be held
+        void load_remaining(Tensile::hip::SolutionAdapter& adapter)
+        {
+            for(auto& file : m_files)
+                if(!file->loaded.load(std::memory_order_relaxed))
+                    load(adapter, *file);
+        }
+
+    public:
+        static bool lazy_load()
+        {
+            static const bool lazy = [] {
+                const char* env = getenv("ROCBLAS_TENSILE_LAZY_LOAD");
+                return !env || strcmp(env, "0");
+            }();
+            return lazy;
+        }
+
+        // Add a code object, which is loaded now if its kernels cannot be indexed
+        void add(Tensile::hip::SolutionAdapter& adapter, const std::string& path)
+        {
+            m_files.push_back(std::make_unique<file_s>());
+            m_files.back()->path = path;
+#ifndef WIN32
+            if(lazy_load() && index_file(m_files.size() - 1, path))
+                return;
+#endif
+            load(adapter, *m_files.back());
+        }
+
+        // Load the code objects defining the kernels, if they are not already loaded
+        void require(Tensile::hip::SolutionAdapter&               adapter,
+                     const std::vector<Tensile::KernelInvocation>& kernels)
+        {
+            if(m_num_loaded.load(std::memory_order_relaxed) == m_files.size())
+                return;
+
+            for(auto& kernel : kernels)
+            {
+                auto it = m_kernels.find(kernel.kernelName);
+                if(it != m_kernels.end()
+                   && m_files[it->second]->loaded.load(std::memory_order_acquire))
+                    continue;
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(it != m_kernels.end())
+                {
+                    if(!m_files[it->second]->loaded.load(std::memory_order_relaxed))
+                        load(adapter, *m_files[it->second]);
+                }
+                else
+                {
+                    // A kernel which is not indexed may be in any code object, so load them all
+                    load_remaining(adapter);
+                }
+            }
+        }
+
+        // Load every code object which is not already loaded
+        void load_all(Tensile::hip::SolutionAdapter& adapter)
+        {
+            if(m_num_loaded.load(std::memory_order_relaxed) == m_files.size())
+                return;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            load_remaining(adapter);
+        }
+
+        size_t num_loaded() const
+        {
+            return m_num_loaded.load(std::memory_order_relaxed);
+        }
+
+        size_t num_files() const
+        {
+            return m_files.size();
+        }
+    };
+
     /**************************************************
      * The TensileHost struct interfaces with Tensile *
      **************************************************/
@@ -453,6 +994,19 @@ namespace
         {
             mutable std::atomic<Tensile::hip::SolutionAdapter*> adapter{nullptr};
             mutable std::mutex                                  mutex;
+
+            // Set once, before adapter is published
+            mutable std::shared_ptr<Tensile::Hardware> hardware;
+
+            // Cache of selected solutions for this device
+            mutable SolutionCache cache;
+
+            // Tuning database entries for this device, set once before adapter is published
+            mutable TuningDB tuning_db;
+
+            // Code objects for this device, and the time taken to initialize it
+            mutable CodeObjectIndex code_objects;
+            mutable double          startup_ms = 0;
         };
 
         // Each device contains an adapter
@@ -522,7 +1076,9 @@ namespace
          * Initialize adapter and library according to environment variables *
          * and default paths based on librocblas.so location and GPU         *
          *********************************************************************/
-        void initialize(Tensile::hip::SolutionAdapter& adapter, rocblas_int deviceId)
+        void initialize(Tensile::hip::SolutionAdapter& adapter,
+                        CodeObjectIndex&               code_objects,
+                        rocblas_int                    deviceId)
         {
             std::string path;
 #ifndef WIN32
@@ -589,7 +1145,8 @@ namespace
                     path += "/" + processor;
             }
 
-            // only load modules for the current architecture
+            // only load modules for the current architecture, and unless lazy loading is
+            // disabled, only index them here and load them when their kernels are launched
             auto dir = path + "/*" + processor + "*co";
 
             bool no_match = false;
@@ -602,7 +1159,7 @@ namespace
                 do
                 {
                     std::string codeObjectFile = path + "\\" + finddata.cFileName;
-                    adapter.loadCodeObjectFile(codeObjectFile.c_str());
+                    code_objects.add(adapter, codeObjectFile);
                 } while(FindNextFileA(hfine, &finddata));
             }
             else
@@ -616,7 +1173,7 @@ namespace
             if(!g)
             {
                 for(size_t i = 0; i < glob_result.gl_pathc; ++i)
-                    adapter.loadCodeObjectFile(glob_result.gl_pathv[i]);
+                    code_objects.add(adapter, glob_result.gl_pathv[i]);
             }
             else if(g == GLOB_NOMATCH)
             {
@@ -660,6 +1217,9 @@ namespace
                     rocblas_abort();
                 }
 
+                // The whole library is parsed here, even though code objects are loaded lazily.
+                // TODO: Parse it lazily too, which needs a Tensile library file format that can
+                // be split by architecture or read on demand.
                 auto lib = Tensile::LoadLibraryFile<Tensile::ContractionProblem>(path);
                 if(!lib)
                     rocblas_cerr << "\nrocBLAS error: Could not load " << path << std::endl;
@@ -689,8 +1249,13 @@ namespace
     auto& get_library_and_adapter(
         std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>>* library
         = nullptr,
-        std::shared_ptr<hipDeviceProp_t>* deviceProp = nullptr,
-        int                               device     = -1)
+        std::shared_ptr<hipDeviceProp_t>*    deviceProp   = nullptr,
+        int                                  device       = -1,
+        std::shared_ptr<Tensile::Hardware>** hardware     = nullptr,
+        SolutionCache**                      cache        = nullptr,
+        CodeObjectIndex**                    code_objects = nullptr,
+        double*                              startup_ms   = nullptr,
+        TuningDB**                           tuning_db    = nullptr)
     try
     {
         // TensileHost is initialized on the first call
@@ -712,11 +1277,23 @@ namespace
             adapter = a.adapter.load(std::memory_order_relaxed);
             if(!adapter)
             {
+                auto start = std::chrono::steady_clock::now();
+
                 // Allocate a new adapter using the current HIP device
                 adapter = new Tensile::hip::SolutionAdapter;
 
                 // Initialize the adapter and possibly the library
-                host.initialize(*adapter, device);
+                host.initialize(*adapter, a.code_objects, device);
+
+                // The Tensile hardware description of this device does not change
+                hipDeviceProp_t prop;
+                HIP_CHECK_EXC(hipGetDeviceProperties(&prop, device));
+                a.hardware = Tensile::hip::GetDevice(prop);
+                a.tuning_db.load(rocblas_internal_get_arch_name());
+
+                a.startup_ms = std::chrono::duration<double, std::milli>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
 
                 // Atomically change the adapter stored for this device ID
                 a.adapter.store(adapter, std::memory_order_release);
@@ -728,6 +1305,16 @@ namespace
             *library = host.get_library();
         if(deviceProp)
             *deviceProp = host.get_device_property();
+        if(hardware)
+            *hardware = &a.hardware;
+        if(cache)
+            *cache = &a.cache;
+        if(code_objects)
+            *code_objects = &a.code_objects;
+        if(startup_ms)
+            *startup_ms = a.startup_ms;
+        if(tuning_db)
+            *tuning_db = &a.tuning_db;
 
         return *adapter;
     }
@@ -745,6 +1332,43 @@ namespace
         rocblas_abort();
     }
 
+    /*******************************************************************
+     * Return the library's solution with the given index, if it can   *
+     * compute the problem on the hardware, and nullptr otherwise      *
+     *******************************************************************/
+    std::shared_ptr<Tensile::ContractionSolution>
+        GetSolution(const Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>& library,
+                    int32_t                                                          index,
+                    const Tensile::ContractionProblem&                               problem,
+                    const Tensile::Hardware&                                         hardware)
+    {
+        auto it = library.solutions.find(index);
+        if(it == library.solutions.end())
+            return nullptr;
+        auto& solution = it->second;
+        return (*solution->hardwarePredicate)(hardware) && (*solution->problemPredicate)(problem)
+                   ? solution
+                   : nullptr;
+    }
+
+    /*******************************************************************
+     * Return the indices of the solutions which can compute the       *
+     * problem on the hardware, in increasing order                    *
+     *******************************************************************/
+    std::vector<int32_t> FindCandidateSolutions(
+        const Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>& library,
+        const Tensile::ContractionProblem&                               problem,
+        const Tensile::Hardware&                                         hardware)
+    {
+        std::vector<int32_t> indices;
+        for(auto& solution : library.findAllSolutions(problem, hardware))
+            if((*solution->problemPredicate)(problem))
+                indices.push_back(solution->index);
+        std::sort(indices.begin(), indices.end());
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+        return indices;
+    }
+
     /**************************************************************************
     * We normally print error messages only once, to avoid excessive logging *
     **************************************************************************/
@@ -774,23 +1398,97 @@ namespace
 template <typename Ti, typename To, typename Tc>
 rocblas_status runContractionProblem(const RocblasContractionProblem<Ti, To, Tc>& prob)
 {
-    rocblas_status                                status = rocblas_status_internal_error;
-    std::shared_ptr<Tensile::ContractionSolution> solution;
+    // Tensile takes alpha and beta by value, so device scalars are applied after it runs,
+    // unless the tuning database has an entry for the problem as it is given
+    if(prob.handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        TuningDB* tuning_db;
+        get_library_and_adapter(nullptr,
+                                nullptr,
+                                prob.handle->getDevice(),
+                                nullptr,
+                                nullptr,
+                                nullptr,
+                                nullptr,
+                                &tuning_db);
+        return runContractionProblemDeviceScalars(prob, tuning_db->contains(prob));
+    }
+
+    rocblas_status                      status   = rocblas_status_internal_error;
+    const Tensile::ContractionSolution* solution = nullptr;
 
     try
     {
         std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> library;
-        std::shared_ptr<hipDeviceProp_t>                                             deviceProp;
-        std::shared_ptr<Tensile::Hardware>                                           hardware;
-
-        auto& adapter = get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
+        std::shared_ptr<Tensile::Hardware>*                                          hardware;
+        SolutionCache*                                                               cache;
+        CodeObjectIndex*                                                             code_objects;
+        TuningDB*                                                                    tuning_db;
+
+        auto& adapter = get_library_and_adapter(&library,
+                                                nullptr,
+                                                prob.handle->getDevice(),
+                                                &hardware,
+                                                &cache,
+                                                &code_objects,
+                                                nullptr,
+                                                &tuning_db);
+
+        auto  tensile_prob     = ConstructTensileProblem(prob);
+        auto  handle           = prob.handle;
+        auto* fitness_query    = handle->get_solution_fitness_query();
+        auto* candidates_query = handle->get_solution_candidates_query();
+        auto  forced_index     = handle->get_solution_index();
+
+        // Candidates queries report the solutions which can compute the problem
+        if(candidates_query)
+        {
+            auto candidates = FindCandidateSolutions(*library, tensile_prob, **hardware);
+            *candidates_query->count = rocblas_int(candidates.size());
+            std::copy_n(candidates.begin(),
+                        std::min(candidates.size(), size_t(candidates_query->capacity)),
+                        candidates_query->indices);
+            return rocblas_status_success;
+        }
 
-        hardware            = Tensile::hip::GetDevice(*deviceProp);
-        auto  tensile_prob  = ConstructTensileProblem(prob);
-        auto  handle        = prob.handle;
-        auto* fitness_query = handle->get_solution_fitness_query();
+        // Fitness queries always go through Tensile's solution selection
+        if(fitness_query)
+        {
+            solution = library->findBestSolution(tensile_prob, **hardware, fitness_query).get();
+        }
+        else if(forced_index >= 0)
+        {
+            // A forced solution bypasses the cache, and must be able to compute the problem
+            solution = GetSolution(*library, forced_index, tensile_prob, **hardware).get();
+            if(!solution)
+                return rocblas_status_invalid_value;
+        }
+        else
+        {
+            // A replayed graph node uses the solution of its captured call, if it still applies
+            auto* replayed = handle->get_graph_solution();
+            solution       = static_cast<const Tensile::ContractionSolution*>(replayed);
+            if(solution && !(*solution->problemPredicate)(tensile_prob))
+                solution = nullptr;
 
-        solution = library->findBestSolution(tensile_prob, *hardware, fitness_query);
+            if(!solution)
+            {
+                auto key = MakeSolutionCacheKey(prob, GetTensileWorkspaceSize(handle));
+                solution = cache->find(key);
+                if(!solution)
+                {
+                    // The tuning database overrides findBestSolution() when its solution applies
+                    std::shared_ptr<Tensile::ContractionSolution> best;
+                    int32_t                                       tuned = tuning_db->find(prob);
+                    if(tuned >= 0)
+                        best = GetSolution(*library, tuned, tensile_prob, **hardware);
+                    if(!best)
+                        best = library->findBestSolution(tensile_prob, **hardware);
+                    cache->insert(key, best);
+                    solution = best.get();
+                }
+            }
+        }
 
         if(!solution)
         {
@@ -812,11 +1510,11 @@ rocblas_status runContractionProblem(const RocblasContractionProblem<Ti, To, Tc>
             }
             else
             {
+                handle->record_graph_solution(solution);
+                auto kernels = solution->solve(tensile_prob, GetTensileInputs(prob), **hardware);
+                code_objects->require(adapter, kernels);
                 adapter.launchKernels(
-                    solution->solve(tensile_prob, GetTensileInputs(prob), *hardware),
-                    handle->get_stream(),
-                    handle->startEvent,
-                    handle->stopEvent);
+                    kernels, handle->get_stream(), handle->startEvent, handle->stopEvent);
                 status = rocblas_status_success;
             }
         }
@@ -837,13 +1535,93 @@ rocblas_status runContractionProblem(const RocblasContractionProblem<Ti, To, Tc>
     return status;
 }
 
-/***************************************************************
- * ! \brief  Initialize rocBLAS for the current HIP device, to *
- * avoid costly startup time at the first call on that device. *
- ***************************************************************/
+/*****************************************************************
+ * ! \brief  Initialize rocBLAS for the current HIP device, to   *
+ * avoid costly startup time at the first call on that device.   *
+ * All of the device's code objects are loaded, since an explicit *
+ * initialization should leave no loading for later calls.        *
+ *****************************************************************/
 extern "C" void rocblas_initialize()
 {
-    get_library_and_adapter();
+    CodeObjectIndex* code_objects;
+    auto&            adapter
+        = get_library_and_adapter(nullptr, nullptr, -1, nullptr, nullptr, &code_objects);
+    code_objects->load_all(adapter);
+}
+
+/******************************************************************************
+ * Return the hit and miss counts of the solution cache of the handle's device *
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_solution_cache_stats(rocblas_handle handle, size_t* hits, size_t* misses)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!hits || !misses)
+        return rocblas_status_invalid_pointer;
+
+    SolutionCache* cache;
+    get_library_and_adapter(nullptr, nullptr, handle->getDevice(), nullptr, &cache);
+    *hits   = cache->hits();
+    *misses = cache->misses();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/******************************************************************************
+ * Return the number of tuning database entries of the handle's device, and   *
+ * the number of solution selections which they have served                   *
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_tuning_db_stats(rocblas_handle handle, size_t* entries, size_t* hits)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!entries || !hits)
+        return rocblas_status_invalid_pointer;
+
+    TuningDB* tuning_db;
+    get_library_and_adapter(
+        nullptr, nullptr, handle->getDevice(), nullptr, nullptr, nullptr, nullptr, &tuning_db);
+    *entries = tuning_db->size();
+    *hits    = tuning_db->hits();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/***********************************************************************************
+ * Get the time taken to initialize Tensile for the handle's device, and the number *
+ * of code objects for the device which have been loaded out of those available     *
+ ***********************************************************************************/
+extern "C" rocblas_status rocblas_get_tensile_load_stats(rocblas_handle handle,
+                                                         double*        startup_ms,
+                                                         size_t*        loaded_code_objects,
+                                                         size_t*        total_code_objects)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!startup_ms || !loaded_code_objects || !total_code_objects)
+        return rocblas_status_invalid_pointer;
+
+    CodeObjectIndex* code_objects;
+    get_library_and_adapter(
+        nullptr, nullptr, handle->getDevice(), nullptr, nullptr, &code_objects, startup_ms);
+    *loaded_code_objects = code_objects->num_loaded();
+    *total_code_objects  = code_objects->num_files();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
 }
 
 /******************************************************************************